@@ -0,0 +1,155 @@
+/**@file
+ * @brief	ILI9341 Fonts Header file.
+ *
+ * @defgroup ili9341_fonts ILI9341 Fonts module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions and structures that together draw text, with bitmap fonts
+ *          that are stored in flash memory, on the screen of an ILI9341 Device that has been initialized with the
+ *          @ref ili9341 .
+ *
+ * @details Each string is drawn as a single opaque text box (i.e., its glyphs over a background color), whose pixels
+ *          are rendered into one of the two strip buffers of this module (see @ref ILI9341_FONTS_STRIP_PIXELS ) while
+ *          the other one is being sent by DMA. The whole text box is written through a single Address Window, so that
+ *          a string costs the 11 bytes of ILI9341 Commands of that Address Window plus its pixels, regardless of how
+ *          many glyphs it has, and it fully overwrites whatever text was previously drawn in the same place without
+ *          having to clear it first.
+ *
+ *          Fonts may be anti-aliased, with 2 or 4 bits per pixel of coverage, where each pixel of a glyph is blended
+ *          between the background color and the color of the ink with a 16 entries color ramp (see
+ *          @ref ILI9341_FONTS_RAMP_CACHE_SIZE ). The ramp is precomputed once per pair of colors, so that the blending
+ *          costs a single table lookup per pixel and the Frame Memory of the ILI9341 Device is never read back.
+ *
+ *          Fonts are generated with the "tools/ili9341_font_compiler.py" host tool, which can keep only the characters
+ *          that are actually used, compress the bitmaps of the glyphs and add kerning pairs.
+ *
+ * @note    Only single line strings are supported, where each of their characters is a byte (e.g., ASCII or
+ *          ISO-8859-1) whose value is looked up as is in the glyphs of the font.
+ */
+
+#ifndef ILI9341_FONTS_H_
+#define ILI9341_FONTS_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "ili9341_tft_lcd_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the ILI9341 Device.
+
+#ifndef ILI9341_FONTS_STRIP_PIXELS
+#define ILI9341_FONTS_STRIP_PIXELS  (2048)  /**< @brief Number of pixels of each of the two strip buffers into which the text boxes are rendered while the other one is being sent by DMA, which takes <tt>4·ILI9341_FONTS_STRIP_PIXELS</tt> bytes of RAM in total. @details A text box whose visible part fits in a single strip buffer is sent with a single DMA transfer, whereas larger ones are sent in strips of as many whole rows as fit in a strip buffer. @note A strip buffer holds @ref ILI9341_FONTS_STRIP_PIXELS pixels in 16 bits per pixel, but only two thirds of that in 18 bits per pixel. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_FONTS_STRIP_PIXELS=1024). @note This value must be within the range of 360 (i.e., a whole row of the screen in 18 bits per pixel) up to 65535. */
+#endif
+#if (ILI9341_FONTS_STRIP_PIXELS < 360) || (ILI9341_FONTS_STRIP_PIXELS > 65535)
+#error "ILI9341_FONTS_STRIP_PIXELS must be within the range of 360 (i.e., a whole row of the screen in 18 bits per pixel) up to 65535."
+#endif
+#ifndef ILI9341_FONTS_RAMP_CACHE_SIZE
+#define ILI9341_FONTS_RAMP_CACHE_SIZE   (4)     /**< @brief Number of color ramps, each of them for a pair of ink and background colors, that are kept cached by this module so that drawing text with a recently used pair of colors does not compute its ramp again, where each cached ramp takes 76 bytes of RAM. @details Once the cache is full, the ramp that was computed the longest time ago is replaced by the one of the new pair of colors. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_FONTS_RAMP_CACHE_SIZE=8). @note This value must be within the range of 1 up to 255. */
+#endif
+#if (ILI9341_FONTS_RAMP_CACHE_SIZE < 1) || (ILI9341_FONTS_RAMP_CACHE_SIZE > 255)
+#error "ILI9341_FONTS_RAMP_CACHE_SIZE must be within the range of 1 up to 255."
+#endif
+#define ILI9341_FONTS_RAMP_LENGTH       (16)    /**< @brief Number of colors of each color ramp, which goes from the background color (at 0) up to the color of the ink (at 15), so that the coverage of a pixel with @ref ILI9341_font_t::bpp bits indexes it after being scaled by <tt>15 / (2^bpp - 1)</tt> . */
+
+/**@brief	ILI9341 Glyph parameters structure.
+ *
+ * @details This contains the metrics of a glyph of an @ref ILI9341_font_t and the position of its bitmap, which only
+ *          covers the bounding box of the glyph's ink. The bitmap holds the coverage of each pixel with
+ *          @ref ILI9341_font_t::bpp bits (i.e., from 0 for the background up to all ones for the ink), taken row by row
+ *          from its top-left corner and packed from the Most Significant Bits of each byte, where the rows are not padded
+ *          to whole bytes.
+ *
+ *          If the font is Run-Length Encoded (see @ref ILI9341_font_t::is_rle ), that same sequence of coverages is
+ *          stored instead as a sequence of tokens, each of which is a byte \c t that stands for:
+ *          - <tt>(t & 0x7F) + 1</tt> pixels without coverage, if <tt>(t & 0x80) == 0x00</tt> .
+ *          - <tt>(t & 0x3F) + 1</tt> pixels with full coverage, if <tt>(t & 0xC0) == 0x80</tt> .
+ *          - <tt>(t & 0x3F) + 1</tt> pixels whose coverages follow, packed just like the ones of a plain bitmap from
+ *            the next byte up to the last byte that holds any of their bits, if <tt>(t & 0xC0) == 0xC0</tt> .
+ */
+typedef struct
+{
+    uint16_t bitmap_offset;     //!< Offset in bytes, from @ref ILI9341_font_t::p_bitmaps , of the bitmap of the glyph.
+    uint8_t width;              //!< Number of columns of the bitmap of the glyph.
+    uint8_t height;             //!< Number of rows of the bitmap of the glyph.
+    uint8_t x_advance;          //!< Number of columns by which the pen is moved after drawing the glyph.
+    int8_t x_offset;            //!< Column of the left side of the bitmap of the glyph, relative to the pen.
+    int8_t y_offset;            //!< Row of the top side of the bitmap of the glyph, relative to the baseline (i.e., negative for the rows above the baseline).
+} ILI9341_glyph_t;
+
+/**@brief	ILI9341 Kerning Pair parameters structure.
+ *
+ * @details This contains the adjustment of the space between the glyphs of two characters whenever they are drawn one
+ *          right after the other.
+ */
+typedef struct
+{
+    uint8_t left;           //!< Character of the glyph at the left.
+    uint8_t right;          //!< Character of the glyph at the right.
+    int8_t adjustment;      //!< Number of columns by which the pen is moved before drawing the glyph of @ref right (i.e., negative to bring both glyphs closer).
+} ILI9341_kerning_pair_t;
+
+/**@brief	ILI9341 Font parameters structure.
+ *
+ * @details This contains a bitmap font made of the glyphs of either all the characters from @ref first up to
+ *          @ref last , or only of the ones in @ref p_characters , where each line of text is
+ *          <tt>ascent + descent</tt> rows tall and has its baseline at @ref ascent rows from its top side.
+ */
+typedef struct
+{
+    const uint8_t *p_bitmaps;           //!< Pointer to the bitmaps of all the glyphs of the font.
+    const ILI9341_glyph_t *p_glyphs;    //!< Pointer to the glyphs of the characters from @ref first up to @ref last , or of the ones in @ref p_characters .
+    uint8_t first;                      //!< First character that has a glyph in the font.
+    uint8_t last;                       //!< Last character that has a glyph in the font.
+    uint8_t ascent;                     //!< Number of rows of a line of text that lie above its baseline.
+    uint8_t descent;                    //!< Number of rows of a line of text that lie at or below its baseline.
+    uint8_t bpp;                        //!< Number of bits per pixel of the bitmaps of the glyphs, which is either 1 (i.e., plain ink), 2 or 4 (i.e., anti-aliased ink).
+    uint8_t is_rle;                     //!< Whether the bitmaps of the glyphs are Run-Length Encoded (1) or plain (0).
+    const uint8_t *p_characters;        //!< Pointer to the characters that have a glyph in the font in ascending order, or NULL if all the characters from @ref first up to @ref last have one.
+    uint16_t glyph_count;               //!< Number of characters in @ref p_characters , which is only used if it is not NULL.
+    uint16_t kerning_pair_count;        //!< Number of kerning pairs in @ref p_kerning_pairs .
+    const ILI9341_kerning_pair_t *p_kerning_pairs;  //!< Pointer to the kerning pairs of the font sorted by @ref ILI9341_kerning_pair_t::left and then by @ref ILI9341_kerning_pair_t::right , or NULL if it has none.
+} ILI9341_font_t;
+
+/**@brief   Gets the width of a string, which is the sum of the advances of its glyphs plus the adjustments of its
+ *          kerning pairs.
+ *
+ * @param[in] p_font    Pointer to the font of the string.
+ * @param[in] p_string  Pointer to the null terminated string.
+ *
+ * @return  The number of columns of the text box of the string, where the characters that have no glyph in \p p_font
+ *          take no columns at all.
+ */
+uint16_t ili9341_get_string_width(const ILI9341_font_t *p_font, const char *p_string);
+
+/**@brief   Draws a single line string, as an opaque text box, on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The text box of the string spans @ref ili9341_get_string_width columns and
+ *          <tt>ascent + descent</tt> rows of \p p_font . Its visible part is sent through a single Address Window,
+ *          where each strip of its rows is first filled with \p background and then has the pixels of the glyphs that
+ *          reach it set to the color of the ramp from \p background to \p color that their coverage indexes, before
+ *          being sent by DMA. Thus, the CPU only waits for a strip buffer whenever it renders faster than the SPI sends
+ *          the previous one.
+ *
+ * @note    The text box is clipped to the Clip Rectangle (see @ref ili9341_set_clip_rect ), and the ink of the glyphs
+ *          that lies outside of the text box (e.g., the overhang of an italic glyph at the end of the string) is cut.
+ * @note    The strip buffers of this module are shared by all the ILI9341 Devices, so drawing a string waits for the
+ *          ones that a previous string (of any ILI9341 Device) may still be sending.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the top-left corner of the text box, which may lie outside of the screen.
+ * @param y             Row of the top-left corner of the text box, which may lie outside of the screen.
+ * @param[in] p_font    Pointer to the font with which the string is to be drawn.
+ * @param[in] p_string  Pointer to the null terminated string to be drawn, whose characters that have no glyph in
+ *                      \p p_font are skipped.
+ * @param color         Color of the ink of the glyphs, in the Bit Color Order of the Bits Per Pixel (BPP) type that
+ *                      the @ref ili9341 is currently using with the ILI9341 Device (see @ref ILI9341_COLOR ).
+ * @param background    Color of the rest of the text box, in the same Bit Color Order as \p color .
+ *
+ * @retval  ILI9341_EC_OK if drawing the string was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if the text box of the requested string is empty or lies outside of the Clip Rectangle.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p p_font or \p p_string is NULL, if @ref ILI9341_font_t::bpp of \p p_font is not 1, 2
+ *          or 4, or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_string(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const ILI9341_font_t *p_font, const char *p_string,
+                                   ILI9341_COLOR color, ILI9341_COLOR background);
+
+#endif /* ILI9341_FONTS_H_ */
+
+/** @} */
@@ -0,0 +1,350 @@
+/**@file
+ * @brief	ILI9341 Graphics Primitives Header file.
+ *
+ * @defgroup ili9341_graphics ILI9341 Graphics Primitives module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions and structures that together rasterize geometric shapes
+ *          (e.g., lines, polygons, circles and rounded rectangles) on the screen of an ILI9341 Device that has been
+ *          initialized with the @ref ili9341 .
+ *
+ * @details None of the functions of this module uses a framebuffer. Instead, each shape is decomposed into horizontal
+ *          or vertical runs of pixels of the same color, which are then drawn with @ref ili9341_fill_rect (i.e., with a
+ *          single Address Window setup and a single DMA stream per run), while only the runs made of a single pixel are
+ *          drawn with @ref ili9341_draw_pixel . Since all the runs of a shape share the same color, they are all queued
+ *          into the SPI Transfer Queue without waiting for each other to be sent.
+ *
+ * @note    As with the @ref ili9341 , the colors given to the functions of this module must be given in the Bit
+ *          Color Order of the Bits Per Pixel (BPP) type that the @ref ili9341 is currently using (see
+ *          @ref ILI9341_COLOR ), and none of them waits for its shape to be sent before returning.
+ */
+
+#ifndef ILI9341_GRAPHICS_H_
+#define ILI9341_GRAPHICS_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "ili9341_tft_lcd_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the ILI9341 Device.
+
+#ifndef ILI9341_GRAPHICS_MAX_POLYGON_VERTICES
+#define ILI9341_GRAPHICS_MAX_POLYGON_VERTICES   (32)    /**< @brief Maximum number of vertices of the polygons that can be filled with @ref ili9341_fill_polygon . @note The Edge Table of a polygon is held in the stack of @ref ili9341_fill_polygon , which takes about 24 bytes per vertex. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_GRAPHICS_MAX_POLYGON_VERTICES=64). @note This value must be within the range of 3 up to 255. */
+#endif
+#if (ILI9341_GRAPHICS_MAX_POLYGON_VERTICES < 3) || (ILI9341_GRAPHICS_MAX_POLYGON_VERTICES > 255)
+#error "ILI9341_GRAPHICS_MAX_POLYGON_VERTICES must be within the range of 3 up to 255."
+#endif
+#define ILI9341_GRAPHICS_MAX_RADIUS             (16383) /**< @brief Maximum radius, in pixels, of the circles, ellipses, arcs and rounded corners that can be drawn with this module, which keeps the integer arithmetic with which they are rasterized within 64 bits. */
+
+/**@brief	ILI9341 Graphics Polygon Fill Rule definitions.
+ *
+ * @details These definitions stand for the rule with which @ref ili9341_fill_polygon decides whether a pixel lies
+ *          inside of a polygon whose edges cross each other (e.g., a star drawn with a single stroke). For polygons
+ *          whose edges do not cross each other, both rules give the same result.
+ */
+typedef enum
+{
+    ILI9341_FILL_RULE_EVEN_ODD = 0,    //!< A pixel is inside of the polygon if a ray from it towards the right crosses an odd number of its edges.
+    ILI9341_FILL_RULE_NON_ZERO = 1     //!< A pixel is inside of the polygon if the edges that a ray from it towards the right crosses going down and going up do not cancel each other out.
+} ILI9341_FILL_RULE_t;
+
+/**@brief	ILI9341 Graphics Point parameters structure.
+ *
+ * @details This contains the coordinates of a single point of a shape, which may lie outside of the screen.
+ */
+typedef struct
+{
+    int16_t x;      //!< Column of the point.
+    int16_t y;      //!< Row of the point.
+} ILI9341_point_t;
+
+/**@brief   Draws a straight line between two points on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The line is rasterized with the Bresenham algorithm, but instead of drawing each of its pixels
+ *          separately, the consecutive pixels that share the same row (or the same column, for lines that are more
+ *          vertical than horizontal) are grouped into a single run that is drawn as a 1 pixel thick rectangle. For
+ *          example, a horizontal or vertical line costs a single Address Window setup, while a line with a slope of
+ *          1/10 costs one Address Window setup per 10 pixels instead of one per pixel. Only the diagonal stretches, in
+ *          which every run is made of a single pixel, fall back to @ref ili9341_draw_pixel .
+ *
+ * @note    The parts of the line that lie outside of the screen are clipped.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x0            Column of the first end of the line.
+ * @param y0            Row of the first end of the line.
+ * @param x1            Column of the second end of the line.
+ * @param y1            Row of the second end of the line.
+ * @param color         Color of the line.
+ *
+ * @retval  ILI9341_EC_OK if drawing the line was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested line lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_line(ILI9341_handle_t *p_handle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, ILI9341_COLOR color);
+
+/**@brief   Draws a sequence of connected straight lines on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details Each pair of consecutive points of \p p_points is joined as in @ref ili9341_draw_line , except that the
+ *          pixel that is shared by two consecutive lines is only sent once.
+ *
+ * @param[in] p_handle      Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param[in] p_points      Pointer to the points to be joined, in the order in which they are to be joined.
+ * @param point_count       Number of points contained in \p p_points , where a single point is drawn as a pixel.
+ * @param color             Color of the lines.
+ *
+ * @retval  ILI9341_EC_OK if drawing the lines was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested lines lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p p_points is NULL, if \p point_count is zero or if something else went wrong with the
+ *          SPI.
+ */
+ILI9341_Status ili9341_draw_polyline(ILI9341_handle_t *p_handle, const ILI9341_point_t *p_points, uint16_t point_count, ILI9341_COLOR color);
+
+/**@brief   Fills a convex or concave polygon on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The polygon is rasterized with a scanline algorithm: its non-horizontal edges are first sorted by their top
+ *          row into an Edge Table and then, for each row of the polygon, the edges that cross that row are kept in an
+ *          Active Edge Table sorted by the column at which they cross it. The pixels between each pair of those
+ *          crossings (as given by \p fill_rule ) are then drawn as a single horizontal run with
+ *          @ref ili9341_fill_rect , so that, for example, a 200x200 triangle costs about 200 Address Window setups
+ *          instead of 40'000 pixels drawn one by one.
+ *
+ * @note    A pixel is considered to be inside of the polygon whenever its center is, so that polygons sharing an edge
+ *          do not draw the pixels of that edge twice.
+ * @note    The last point of \p p_points is implicitly joined with the first one.
+ * @note    The parts of the polygon that lie outside of the screen are clipped.
+ *
+ * @param[in] p_handle      Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param[in] p_points      Pointer to the vertices of the polygon, in the order in which they are to be joined.
+ * @param point_count       Number of vertices contained in \p p_points , which must be within the range of 3 up to
+ *                          @ref ILI9341_GRAPHICS_MAX_POLYGON_VERTICES .
+ * @param fill_rule         Rule with which the inside of the polygon is to be decided.
+ * @param color             Color with which the polygon is to be filled.
+ *
+ * @retval  ILI9341_EC_OK if filling the polygon was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested polygon lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p p_points is NULL, if \p point_count or \p fill_rule are not valid or if something
+ *          else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_fill_polygon(ILI9341_handle_t *p_handle, const ILI9341_point_t *p_points, uint8_t point_count, ILI9341_FILL_RULE_t fill_rule,
+                                    ILI9341_COLOR color);
+
+/**@brief   Fills a triangle on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details This is a shortcut for filling a polygon of 3 vertices with @ref ili9341_fill_polygon .
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x0            Column of the first vertex of the triangle.
+ * @param y0            Row of the first vertex of the triangle.
+ * @param x1            Column of the second vertex of the triangle.
+ * @param y1            Row of the second vertex of the triangle.
+ * @param x2            Column of the third vertex of the triangle.
+ * @param y2            Row of the third vertex of the triangle.
+ * @param color         Color with which the triangle is to be filled.
+ *
+ * @retval  ILI9341_EC_OK if filling the triangle was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested triangle lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_fill_triangle(ILI9341_handle_t *p_handle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                     ILI9341_COLOR color);
+
+/**@brief   Draws the outline of a circle on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The circle is rasterized with the midpoint criterion (i.e., a pixel lies inside of a circle of radius r
+ *          whenever its center lies within a distance of r + 1/2 from the center of the circle), evaluated
+ *          incrementally one row at a time for a single quadrant and then mirrored into the other three. Instead of
+ *          drawing each pixel of the outline separately, the pixels of each row of the flat octants of the circle are
+ *          drawn as a single horizontal run (merged with its mirror whenever they touch), while the pixels of the
+ *          steep octants are drawn as vertical runs, so that the number of Address Window setups grows with the
+ *          perimeter of the circle and only the pixels around its diagonals fall back to @ref ili9341_draw_pixel .
+ *
+ * @note    The outline drawn by this function is made of the very pixels of the border of the circle filled by
+ *          @ref ili9341_fill_circle with the same parameters.
+ * @note    The parts of the circle that lie outside of the screen are clipped.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param xc            Column of the center of the circle.
+ * @param yc            Row of the center of the circle.
+ * @param radius        Radius of the circle in pixels, which must not be greater than
+ *                      @ref ILI9341_GRAPHICS_MAX_RADIUS , where a radius of zero draws a single pixel.
+ * @param color         Color of the circle.
+ *
+ * @retval  ILI9341_EC_OK if drawing the circle was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested circle lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p radius is not valid or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_circle(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius, ILI9341_COLOR color);
+
+/**@brief   Fills a circle on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The circle is rasterized as in @ref ili9341_draw_circle , except that each row of the circle is drawn as a
+ *          single horizontal run and that the consecutive rows that have the same width (i.e., the ones around the
+ *          middle row of the circle) are merged into a single rectangle, so that a circle costs less Address Window
+ *          setups than it has rows.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param xc            Column of the center of the circle.
+ * @param yc            Row of the center of the circle.
+ * @param radius        Radius of the circle in pixels, which must not be greater than
+ *                      @ref ILI9341_GRAPHICS_MAX_RADIUS .
+ * @param color         Color with which the circle is to be filled.
+ *
+ * @retval  ILI9341_EC_OK if filling the circle was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested circle lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p radius is not valid or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_fill_circle(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius, ILI9341_COLOR color);
+
+/**@brief   Draws the outline of an axis-aligned ellipse on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The ellipse is rasterized as in @ref ili9341_draw_circle (i.e., a pixel lies inside of the ellipse
+ *          whenever its center lies inside of the ellipse whose radii are half a pixel longer than the requested
+ *          ones), except that only its 4-way symmetry can be exploited.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param xc            Column of the center of the ellipse.
+ * @param yc            Row of the center of the ellipse.
+ * @param radius_x      Horizontal radius of the ellipse in pixels, which must not be greater than
+ *                      @ref ILI9341_GRAPHICS_MAX_RADIUS .
+ * @param radius_y      Vertical radius of the ellipse in pixels, which must not be greater than
+ *                      @ref ILI9341_GRAPHICS_MAX_RADIUS .
+ * @param color         Color of the ellipse.
+ *
+ * @retval  ILI9341_EC_OK if drawing the ellipse was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested ellipse lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p radius_x or \p radius_y are not valid or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_ellipse(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius_x, uint16_t radius_y, ILI9341_COLOR color);
+
+/**@brief   Fills an axis-aligned ellipse on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The ellipse is rasterized as in @ref ili9341_draw_ellipse and filled as in @ref ili9341_fill_circle .
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param xc            Column of the center of the ellipse.
+ * @param yc            Row of the center of the ellipse.
+ * @param radius_x      Horizontal radius of the ellipse in pixels, which must not be greater than
+ *                      @ref ILI9341_GRAPHICS_MAX_RADIUS .
+ * @param radius_y      Vertical radius of the ellipse in pixels, which must not be greater than
+ *                      @ref ILI9341_GRAPHICS_MAX_RADIUS .
+ * @param color         Color with which the ellipse is to be filled.
+ *
+ * @retval  ILI9341_EC_OK if filling the ellipse was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested ellipse lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p radius_x or \p radius_y are not valid or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_fill_ellipse(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius_x, uint16_t radius_y, ILI9341_COLOR color);
+
+/**@brief   Draws an arc of the outline of a circle on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The arc is made of the pixels of the outline drawn by @ref ili9341_draw_circle whose centers lie within the
+ *          angles that go from \p start_angle up to \p end_angle , where the angles are given in degrees, start at the
+ *          right of the center of the circle (i.e., at 3 o'clock) and grow clockwise. The runs of the outline are
+ *          split wherever they leave those angles, so the arc costs no more Address Window setups than the whole
+ *          circle.
+ *
+ * @note    Since the angles grow clockwise, a gauge that sweeps 270 degrees from its bottom-left to its bottom-right
+ *          goes from 135 up to 405 degrees.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param xc            Column of the center of the circle of the arc.
+ * @param yc            Row of the center of the circle of the arc.
+ * @param radius        Radius of the circle of the arc in pixels, which must not be greater than
+ *                      @ref ILI9341_GRAPHICS_MAX_RADIUS .
+ * @param start_angle   Angle, in degrees, at which the arc starts.
+ * @param end_angle     Angle, in degrees, at which the arc ends, where the whole circle is drawn if it is 360 degrees
+ *                      or more after \p start_angle .
+ * @param color         Color of the arc.
+ *
+ * @retval  ILI9341_EC_OK if drawing the arc was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if \p end_angle is not greater than \p start_angle or if no pixel of the requested arc lies
+ *          within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p radius is not valid or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_arc(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius, int16_t start_angle, int16_t end_angle,
+                                ILI9341_COLOR color);
+
+/**@brief   Fills a sector of a ring (e.g., the needle track of a gauge) on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The sector is made of the pixels of the circle filled by @ref ili9341_fill_circle with \p outer_radius that
+ *          neither lie inside of the circle filled with \p inner_radius nor outside of the angles that go from
+ *          \p start_angle up to \p end_angle (see @ref ili9341_draw_arc ). Each row of the sector is drawn as, at
+ *          most, one horizontal run on each side of its center.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param xc            Column of the center of the ring.
+ * @param yc            Row of the center of the ring.
+ * @param inner_radius  Radius of the hole of the ring in pixels, where zero fills a pie slice instead.
+ * @param outer_radius  Outer radius of the ring in pixels, which must be greater than \p inner_radius and must not be
+ *                      greater than @ref ILI9341_GRAPHICS_MAX_RADIUS .
+ * @param start_angle   Angle, in degrees, at which the sector starts.
+ * @param end_angle     Angle, in degrees, at which the sector ends, where the whole ring is filled if it is 360
+ *                      degrees or more after \p start_angle .
+ * @param color         Color with which the sector is to be filled.
+ *
+ * @retval  ILI9341_EC_OK if filling the sector was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if \p end_angle is not greater than \p start_angle or if no pixel of the requested sector
+ *          lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p inner_radius or \p outer_radius are not valid or if something else went wrong with the
+ *          SPI.
+ */
+ILI9341_Status ili9341_fill_arc(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t inner_radius, uint16_t outer_radius, int16_t start_angle,
+                                int16_t end_angle, ILI9341_COLOR color);
+
+/**@brief   Draws the outline of a rectangle with rounded corners on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details Each corner is a quadrant of the circle drawn by @ref ili9341_draw_circle with \p radius , while the top and
+ *          bottom sides are merged with the top-most runs of their corners and the left and right sides with the
+ *          vertical runs of theirs, so that, for example, a button with small corners costs about as many Address
+ *          Window setups as its corners have pixels around their diagonals.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the left side of the rectangle.
+ * @param y             Row of the top side of the rectangle.
+ * @param width         Width of the rectangle in pixels.
+ * @param height        Height of the rectangle in pixels.
+ * @param radius        Radius of the corners in pixels, which is reduced to fit whenever it is greater than half of
+ *                      \p width or of \p height , and where zero draws a plain rectangle.
+ * @param color         Color of the rectangle.
+ *
+ * @retval  ILI9341_EC_OK if drawing the rectangle was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if \p width or \p height are zero or if no pixel of the requested rectangle lies within the
+ *          screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_round_rect(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t radius,
+                                       ILI9341_COLOR color);
+
+/**@brief   Fills a rectangle with rounded corners on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The rows between the corners are filled as a single rectangle, while the rows of the corners are filled as
+ *          in @ref ili9341_fill_circle .
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the left side of the rectangle.
+ * @param y             Row of the top side of the rectangle.
+ * @param width         Width of the rectangle in pixels.
+ * @param height        Height of the rectangle in pixels.
+ * @param radius        Radius of the corners in pixels (see @ref ili9341_draw_round_rect ).
+ * @param color         Color with which the rectangle is to be filled.
+ *
+ * @retval  ILI9341_EC_OK if filling the rectangle was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if \p width or \p height are zero or if no pixel of the requested rectangle lies within the
+ *          screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_fill_round_rect(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t radius,
+                                       ILI9341_COLOR color);
+
+#endif /* ILI9341_GRAPHICS_H_ */
+
+/** @} */
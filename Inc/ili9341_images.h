@@ -0,0 +1,190 @@
+/**@file
+ * @brief	ILI9341 Images Header file.
+ *
+ * @defgroup ili9341_images ILI9341 Images module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions and structures that together draw images, which are stored
+ *          in flash memory in the formats produced by the "tools/ili9341_image_encoder.py" host tool, on the screen of
+ *          an ILI9341 Device that has been initialized with the @ref ili9341 .
+ *
+ * @details None of the functions of this module uses a framebuffer or reads back the Frame Memory of the ILI9341
+ *          Device. Instead, each image is sent as it is drawn through the SPI Transfer Queue of the @ref ili9341 ,
+ *          either straight from flash memory or through a small buffer.
+ *
+ * @note    Sprites and Run-Length Encoded images hold 16 bits per pixel pixels, so they can only be drawn while the
+ *          @ref ili9341 is using the 16 bits per pixel Bits Per Pixel (BPP) type. QOI images, instead, are converted
+ *          while being decoded into whichever Bits Per Pixel (BPP) type the @ref ili9341 is using.
+ */
+
+#ifndef ILI9341_IMAGES_H_
+#define ILI9341_IMAGES_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <string.h> // This library contains the function: memcpy.
+#include "ili9341_tft_lcd_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the ILI9341 Device.
+
+#ifndef ILI9341_IMAGES_LINE_BUFFER_PIXELS
+#define ILI9341_IMAGES_LINE_BUFFER_PIXELS   (ILI9341_SCREEN_WIDTH)  /**< @brief Number of pixels of each of the two line buffers into which the compressed images are decoded while the other one is being sent by DMA, which takes <tt>4·ILI9341_IMAGES_LINE_BUFFER_PIXELS</tt> bytes of RAM in total. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_IMAGES_LINE_BUFFER_PIXELS=480). @note This value must be within the range of 2 up to 65535. */
+#endif
+#if (ILI9341_IMAGES_LINE_BUFFER_PIXELS < 2) || (ILI9341_IMAGES_LINE_BUFFER_PIXELS > 65535)
+#error "ILI9341_IMAGES_LINE_BUFFER_PIXELS must be within the range of 2 up to 65535."
+#endif
+
+/**@brief	ILI9341 Sprite Run parameters structure.
+ *
+ * @details This contains the position and size of a rectangle of opaque pixels of a sprite, which is a run of opaque
+ *          pixels of one of its rows that may be repeated over the consecutive rows that have an opaque run at the very
+ *          same columns.
+ */
+typedef struct
+{
+    uint16_t x;         //!< Column of the left-most pixel of the run, relative to the left side of the sprite.
+    uint16_t y;         //!< Row of the first row of the run, relative to the top side of the sprite.
+    uint16_t width;     //!< Number of opaque pixels of the run.
+    uint16_t height;    //!< Number of consecutive rows over which the run is repeated.
+} ILI9341_sprite_run_t;
+
+/**@brief	ILI9341 Sprite parameters structure.
+ *
+ * @details This contains a color-keyed or alpha-masked image whose transparent pixels have been removed offline (see
+ *          "tools/ili9341_image_encoder.py"), so that only its opaque pixels are stored and sent.
+ */
+typedef struct
+{
+    uint16_t width;                         //!< Number of columns of the sprite.
+    uint16_t height;                        //!< Number of rows of the sprite.
+    uint16_t run_count;                     //!< Number of runs in @ref p_runs .
+    const ILI9341_sprite_run_t *p_runs;     //!< Pointer to the runs of opaque pixels of the sprite, sorted by their first row.
+    const uint16_t *p_pixels;               //!< Pointer to the opaque pixels of the sprite in the 16 bits per pixel Bit Color Order (see @ref ILI9341_COLOR::bpp_16 ), where the pixels of each run are stored row by row right after the ones of the previous run.
+} ILI9341_sprite_t;
+
+/**@brief   Draws a sprite, with its transparent pixels left untouched, on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details Each run of the sprite is drawn with @ref ili9341_blit , so that it costs a single Address Window setup
+ *          and its pixels are sent by DMA straight from \p p_sprite without being copied nor checked one by one.
+ *          Transparent pixels are simply never sent, so whatever was drawn behind them stays as is.
+ *
+ * @note    The runs of the sprite are clipped to the Clip Rectangle (see @ref ili9341_set_clip_rect ).
+ * @note    Since the pixels of the sprite are read by the DMA in the background, a sprite held in RAM must remain
+ *          valid and unmodified until @ref ili9341_wait_until_idle returns.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the top-left corner of the sprite, which may lie outside of the screen.
+ * @param y             Row of the top-left corner of the sprite, which may lie outside of the screen.
+ * @param[in] p_sprite  Pointer to the sprite to be drawn.
+ *
+ * @retval  ILI9341_EC_OK if drawing the sprite was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no opaque pixel of the requested sprite lies within the Clip Rectangle or if the
+ *          @ref ili9341 is not currently using the 16 bits per pixel Bits Per Pixel (BPP) type with the ILI9341 Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p p_sprite is NULL or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_sprite(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const ILI9341_sprite_t *p_sprite);
+
+/**@brief	ILI9341 Run-Length Encoded Image parameters structure.
+ *
+ * @details This contains an opaque image whose pixels, taken row by row from its top-left corner as a single stream
+ *          that wraps from the end of each row into the start of the next one, have been compressed offline (see
+ *          "tools/ili9341_image_encoder.py") into a sequence of tokens. Each token starts with a header word \c w ,
+ *          which is followed by either:
+ *          - A single pixel that is repeated <tt>(w & 0x7FFF) + 1</tt> times, if the bit 15 of \c w is set.
+ *          - <tt>w + 1</tt> literal pixels, otherwise.
+ */
+typedef struct
+{
+    uint16_t width;             //!< Number of columns of the image.
+    uint16_t height;            //!< Number of rows of the image.
+    uint32_t size;              //!< Number of \c uint16_t words in @ref p_data .
+    const uint16_t *p_data;     //!< Pointer to the tokens of the image, whose pixels are in the 16 bits per pixel Bit Color Order (see @ref ILI9341_COLOR::bpp_16 ).
+} ILI9341_rle_image_t;
+
+/**@brief   Draws a Run-Length Encoded image on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The whole visible part of the image is written with a single Address Window, while its tokens are decoded
+ *          into one of the two line buffers of this module (see @ref ILI9341_IMAGES_LINE_BUFFER_PIXELS ) as the other
+ *          one is being sent by DMA. Thus, the decoding of each line buffer overlaps with the SPI transfer of the
+ *          previous one and the CPU only waits for a line buffer whenever it decodes faster than the SPI sends it.
+ *          Runs are expanded with a plain fill loop and literal pixels are copied straight from \p p_image , so that
+ *          decoding takes a fraction of the time that the SPI takes to send the decoded pixels.
+ *
+ * @note    The image is clipped to the Clip Rectangle (see @ref ili9341_set_clip_rect ), where the pixels of the rows
+ *          above the Clip Rectangle and of the columns beside it are decoded but never sent, and the rows below it are
+ *          not decoded at all.
+ * @note    The line buffers of this module are shared by all the ILI9341 Devices, so drawing a compressed image waits
+ *          for the ones that a previous compressed image (of any ILI9341 Device) may still be sending.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the top-left corner of the image, which may lie outside of the screen.
+ * @param y             Row of the top-left corner of the image, which may lie outside of the screen.
+ * @param[in] p_image   Pointer to the image to be drawn.
+ *
+ * @retval  ILI9341_EC_OK if drawing the image was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested image lies within the Clip Rectangle or if the @ref ili9341 is
+ *          not currently using the 16 bits per pixel Bits Per Pixel (BPP) type with the ILI9341 Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p p_image is NULL, if its tokens end before all of its pixels have been decoded (in which
+ *          case the rest of its Address Window is filled with black) or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_rle_image(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const ILI9341_rle_image_t *p_image);
+
+/**@brief	ILI9341 QOI Image parameters structure.
+ *
+ * @details This contains an opaque image that has been compressed offline (see "tools/ili9341_image_encoder.py") with
+ *          a lossless codec based on the "Quite OK Image" format, adapted to the 5, 6 and 5 bits channels of 16 bits
+ *          per pixel pixels or to the 6 bits channels of 18 bits per pixel ones. Its pixels, taken row by row from its
+ *          top-left corner, are encoded as a sequence of operations relative to the previous pixel and to a hash table
+ *          of the 64 recently seen pixels at <tt>(3·red + 5·green + 7·blue) % 64</tt> , where:
+ *          - <tt>00iiiiii</tt> repeats the pixel at the position \c i of the hash table.
+ *          - <tt>01rrggbb</tt> adds a difference from -2 up to 1 (biased by 2) to each channel of the previous pixel.
+ *          - <tt>10gggggg rrrrbbbb</tt> adds a green difference from -32 up to 31 (biased by 32) to the previous pixel,
+ *            together with a red and a blue difference from -8 up to 7 (biased by 8) relative to the green one.
+ *          - <tt>11nnnnnn</tt> , for \c n from 0 up to 61, repeats the previous pixel <tt>n + 1</tt> times.
+ *          - <tt>11111110</tt> is followed by a whole pixel, which is either a big-endian 16 bits per pixel pixel or
+ *            the 3 bytes (i.e., Red, Green and Blue, each with its 6 bits at bits 2 up to 7) of an 18 bits per pixel
+ *            pixel.
+ *
+ *          All the differences wrap around the number of bits of their channel, and the previous pixel starts as black
+ *          with all the positions of the hash table set to black.
+ */
+typedef struct
+{
+    uint16_t width;             //!< Number of columns of the image.
+    uint16_t height;            //!< Number of rows of the image.
+    ILI9341_BPP_t bpp_type;     //!< Bits Per Pixel (BPP) type of the pixels of the image.
+    uint32_t size;              //!< Number of bytes in @ref p_data .
+    const uint8_t *p_data;      //!< Pointer to the operations of the image.
+} ILI9341_qoi_image_t;
+
+/**@brief   Draws a QOI image on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details This works just like @ref ili9341_draw_rle_image , but with the operations of an @ref ILI9341_qoi_image_t ,
+ *          which compress photographs and gradients far better than runs of equal pixels do. The decoder only holds
+ *          the previous pixel and its hash table of 64 pixels, so it takes about 280 bytes of stack, and it converts
+ *          each pixel into the Bits Per Pixel (BPP) type that the @ref ili9341 is currently using with the ILI9341
+ *          Device only whenever the pixel changes. Therefore, 18 bits per pixel images are drawn with their full color
+ *          depth whenever the ILI9341 Device is in 18 bits per pixel (see @ref set_ili9341_bpp_type ), and are
+ *          truncated into 16 bits per pixel otherwise.
+ *
+ * @note    The image is clipped to the Clip Rectangle (see @ref ili9341_set_clip_rect ), just like with
+ *          @ref ili9341_draw_rle_image .
+ * @note    In 18 bits per pixel, each line buffer of this module holds two thirds of
+ *          @ref ILI9341_IMAGES_LINE_BUFFER_PIXELS pixels.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the top-left corner of the image, which may lie outside of the screen.
+ * @param y             Row of the top-left corner of the image, which may lie outside of the screen.
+ * @param[in] p_image   Pointer to the image to be drawn.
+ *
+ * @retval  ILI9341_EC_OK if drawing the image was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested image lies within the Clip Rectangle.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p p_image is NULL, if its Bits Per Pixel (BPP) type is not valid, if its operations end
+ *          before all of its pixels have been decoded (in which case the rest of its Address Window is filled with
+ *          black) or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_qoi_image(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const ILI9341_qoi_image_t *p_image);
+
+#endif /* ILI9341_IMAGES_H_ */
+
+/** @} */
@@ -0,0 +1,101 @@
+/**@file
+ * @brief	ILI9341 JPEG Header file.
+ *
+ * @defgroup ili9341_jpeg ILI9341 JPEG module
+ * @{
+ *
+ * @brief   This module provides the functions and definitions that together decode baseline JPEG images (e.g., camera
+ *          snapshots or photos read from storage) straight onto the screen of an ILI9341 Device that has been
+ *          initialized with the @ref ili9341 .
+ *
+ * @details The image is decoded one MCU row at a time, where each MCU row is split into tiles of as many consecutive
+ *          MCUs as fit in one of the two tile buffers of this module (see @ref ILI9341_JPEG_TILE_PIXELS ). Each tile
+ *          is converted from YCbCr into 16 bits per pixel pixels with fixed point arithmetic and sent through its own
+ *          Address Window while the next tile is being decoded into the other tile buffer. Therefore, no framebuffer
+ *          is used and the whole decoder, including its tile buffers, takes about
+ *          <tt>5 KB + 4·ILI9341_JPEG_TILE_PIXELS</tt> bytes of static RAM.
+ *
+ * @note    Only baseline (and extended sequential 8 bit) JPEG images with Huffman coding, a single interleaved scan and
+ *          either 1 (grayscale) or 3 (YCbCr) components are supported, where the luma may be subsampled by 1 or 2 in
+ *          each direction (e.g., 4:4:4, 4:2:2 and 4:2:0) and the chroma is upsampled by replication. Progressive and
+ *          arithmetic coded JPEG images are rejected.
+ * @note    The JPEG images are drawn in 16 bits per pixel, so they can only be drawn while the @ref ili9341 is using
+ *          the 16 bits per pixel Bits Per Pixel (BPP) type.
+ * @note    The decoder and its buffers are shared by all the ILI9341 Devices, so the functions of this module must not
+ *          be called again (e.g., from an interrupt) until the previous call has returned.
+ */
+
+#ifndef ILI9341_JPEG_H_
+#define ILI9341_JPEG_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <string.h> // This library contains the functions: memcpy and memset.
+#include "ili9341_tft_lcd_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the ILI9341 Device.
+
+#ifndef ILI9341_JPEG_TILE_PIXELS
+#define ILI9341_JPEG_TILE_PIXELS            (512)   /**< @brief Number of pixels of each of the two tile buffers into which the JPEG images are decoded while the other one is being sent by DMA, which takes <tt>4·ILI9341_JPEG_TILE_PIXELS</tt> bytes of RAM in total. @details Larger tile buffers cover more MCUs with a single Address Window, which saves its 11 bytes of ILI9341 Commands per tile. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_JPEG_TILE_PIXELS=1024). @note This value must be within the range of 256 (i.e., a single MCU of 16x16 pixels) up to 65535. */
+#endif
+#if (ILI9341_JPEG_TILE_PIXELS < 256) || (ILI9341_JPEG_TILE_PIXELS > 65535)
+#error "ILI9341_JPEG_TILE_PIXELS must be within the range of 256 (i.e., a single MCU of 16x16 pixels) up to 65535."
+#endif
+#ifndef ILI9341_JPEG_INPUT_BUFFER_SIZE
+#define ILI9341_JPEG_INPUT_BUFFER_SIZE      (512)   /**< @brief Size in bytes of the buffer into which @ref ili9341_draw_jpeg_stream reads the JPEG image in chunks. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_JPEG_INPUT_BUFFER_SIZE=4096). */
+#endif
+
+/**@brief   Reads the next chunk of a JPEG image (e.g., from a file in an SD card) for @ref ili9341_draw_jpeg_stream .
+ *
+ * @param[in] p_context Pointer to the context that was given to @ref ili9341_draw_jpeg_stream .
+ * @param[out] p_buffer Pointer to the memory into which the next bytes of the JPEG image are to be read.
+ * @param size          Maximum number of bytes to be read into \p p_buffer .
+ *
+ * @return  The number of bytes that were read into \p p_buffer , where 0 stands for the end of the JPEG image.
+ */
+typedef uint32_t (*ILI9341_jpeg_read_t)(void *p_context, uint8_t *p_buffer, uint32_t size);
+
+/**@brief   Decodes a baseline JPEG image, held in memory, onto the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The MCUs whose pixels all lie outside of the Clip Rectangle (see @ref ili9341_set_clip_rect ) are only
+ *          entropy decoded, which is required to reach the next ones, while their inverse DCT and color conversion are
+ *          skipped. The decoding stops right after the last MCU row that reaches the Clip Rectangle.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the top-left corner of the image, which may lie outside of the screen.
+ * @param y             Row of the top-left corner of the image, which may lie outside of the screen.
+ * @param[in] p_data    Pointer to the JPEG image (i.e., the whole JPEG file).
+ * @param size          Size in bytes of \p p_data .
+ *
+ * @retval  ILI9341_EC_OK if drawing the image was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested image lies within the Clip Rectangle or if the @ref ili9341 is
+ *          not currently using the 16 bits per pixel Bits Per Pixel (BPP) type with the ILI9341 Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p p_data is NULL, if the image is not a supported JPEG image (see @ref ili9341_jpeg ),
+ *          if its entropy coded data is corrupt or ends too soon (in which case whatever could not be decoded is
+ *          drawn as if all its coefficients were zero) or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_jpeg(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const uint8_t *p_data, uint32_t size);
+
+/**@brief   Decodes a baseline JPEG image, read in chunks through the given function, onto the ILI9341 3.2" TFT LCD
+ *          Display.
+ *
+ * @details This works just like @ref ili9341_draw_jpeg , but the JPEG image is read into a buffer of
+ *          @ref ILI9341_JPEG_INPUT_BUFFER_SIZE bytes as it is being decoded, so that it never has to be held whole in
+ *          memory.
+ *
+ * @param[in] p_handle      Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x                 Column of the top-left corner of the image, which may lie outside of the screen.
+ * @param y                 Row of the top-left corner of the image, which may lie outside of the screen.
+ * @param read              Function with which the next chunk of the JPEG image is read.
+ * @param[in] p_context     Pointer that is given as is to \p read (e.g., the file to be read).
+ *
+ * @retval  ILI9341_EC_OK if drawing the image was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested image lies within the Clip Rectangle or if the @ref ili9341 is
+ *          not currently using the 16 bits per pixel Bits Per Pixel (BPP) type with the ILI9341 Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p read is NULL, if the image is not a supported JPEG image (see @ref ili9341_jpeg ),
+ *          if its entropy coded data is corrupt or ends too soon or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_jpeg_stream(ILI9341_handle_t *p_handle, int16_t x, int16_t y, ILI9341_jpeg_read_t read, void *p_context);
+
+#endif /* ILI9341_JPEG_H_ */
+
+/** @} */
@@ -13,6 +13,14 @@
  *          series devices. If yours is from a different type, then you will have to substitute the right one here for
  *          your particular STMicroelectronics device. However, if you cant figure out what the name of that header file
  *          is, then simply substitute that line of code from this @ref ili9341 by: #include "main.h"
+ *          Alternatively, the included header file can be chosen without editing this @ref ili9341 by defining
+ *          @ref ILI9341_HAL_HEADER from the compiler flags of your project.
+ * @note    The @ref ili9341 only requires the following from that header file: the \c GPIO_TypeDef ,
+ *          \c SPI_HandleTypeDef and \c HAL_StatusTypeDef types, the \c HAL_GPIO_WritePin , \c HAL_Delay and
+ *          \c HAL_SPI_Transmit_DMA functions and the \c __get_PRIMASK , \c __disable_irq and \c __set_PRIMASK
+ *          intrinsics. Therefore, providing just those in a header file of your own is enough to build and exercise
+ *          the @ref ili9341 on a host computer (e.g., by decoding the Commands and Data given to
+ *          \c HAL_SPI_Transmit_DMA into a virtual Frame Memory).
  *
  * @details <b><u>Code Example for using the @ref ili9341:</u></b>
  *
@@ -21,12 +29,56 @@
   #include <stdint.h>   // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
   #include "ili9341_tft_lcd_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the ILI9341 Device.
 
+  extern SPI_HandleTypeDef hspi1; // SPI peripheral, with its TX DMA channel, that was configured by the application (e.g., with STM32CubeMX).
+  static ILI9341_handle_t lcd;      // ILI9341 Device Handle, which must outlive all the transfers queued with it.
+
+  // The DMA transfers of the ILI9341 module are chained from the SPI interrupts of the application.
+  void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+  {
+      ili9341_spi_tx_cplt_callback(hspi);
+  }
+  void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+  {
+      ili9341_spi_error_callback(hspi);
+  }
+
   // ################################################ //
   // ##### INITIALIZATION OF THE ILI9341 MODULE ##### //
   // ################################################ //
-  
-  printf("The ILI9341 Driver Library validation test has successfully concluded!\r\n");
+  ILI9341_peripherals_def_t peripherals;
+  peripherals.CS.GPIO_Port = GPIOA;
+  peripherals.CS.GPIO_Pin = GPIO_PIN_4;
+  peripherals.RESET.GPIO_Port = GPIOB;
+  peripherals.RESET.GPIO_Pin = GPIO_PIN_0;
+  peripherals.DC.GPIO_Port = GPIOB;
+  peripherals.DC.GPIO_Pin = GPIO_PIN_1;
+  ILI9341_Status ret = init_ili9341_module(&lcd, &hspi1, &peripherals);
+  if (ret != ILI9341_EC_OK)
+  {
+      printf("ERROR: The ILI9341 Device could not be initialized (Exception Code = %d).\r\n", ret);
+      while(1); // Stop the program here.
+  }
 
+  // ######################################## //
+  // ##### DRAWING ON THE ILI9341 DEVICE ##### //
+  // ######################################## //
+  // The drawing functions only queue their transfers, so the CPU is free again as soon as each of them returns.
+  ILI9341_COLOR black = {.bpp_16 = 0x0000};
+  ILI9341_COLOR red = {.bpp_16 = 0xF800};
+  ili9341_fill_screen(&lcd, black);
+  ili9341_fill_rect(&lcd, 20, 40, 200, 100, red);
+  ili9341_set_clip_rect(&lcd, 0, 0, 120, 320); // Only the left half of the screen is drawn from here on.
+  ili9341_draw_hline(&lcd, 0, 160, 240, red);
+  ili9341_reset_clip_rect(&lcd);
+
+  // Errors of the queued transfers are latched and reported once they have all been sent.
+  ret = ili9341_wait_until_idle(&lcd);
+  if (ret != ILI9341_EC_OK)
+  {
+      printf("ERROR: Something went wrong while drawing on the ILI9341 Device (Exception Code = %d).\r\n", ret);
+      while(1); // Stop the program here.
+  }
+  printf("The ILI9341 Driver Library validation test has successfully concluded!\r\n");
 
   while(1); // Stop the program here.
  * @endcode
@@ -38,9 +90,49 @@
 #ifndef ILI9341_TFT_LCD_DRIVER_H_
 #define ILI9341_TFT_LCD_DRIVER_H_
 
-#include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices. If yours is from a different type, then you will have to substitute the right one here for your particular STMicroelectronics device. However, if you cant figure out what the name of that header file is, then simply substitute this line of code by: #include "main.h"
+#ifndef ILI9341_HAL_HEADER
+#define ILI9341_HAL_HEADER "stm32f1xx_hal.h"    /**< @brief HAL Driver Library header file that the @ref ili9341 will include. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_HAL_HEADER=\"main.h\"), which also allows building the @ref ili9341 against a host-side stand-in of the HAL. */
+#endif
+#include ILI9341_HAL_HEADER // This is the HAL Driver Library for the STM32F1 series devices by default. If yours is from a different type, then you will have to substitute the right one in @ref ILI9341_HAL_HEADER for your particular STMicroelectronics device. However, if you cant figure out what the name of that header file is, then simply define it as: "main.h"
 #include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
 
+#define ILI9341_SCREEN_WIDTH        (240)   /**< @brief Number of columns (i.e., pixels per row) of the ILI9341 3.2" TFT LCD Display. */
+#define ILI9341_SCREEN_HEIGHT       (320)   /**< @brief Number of rows (i.e., pixels per column) of the ILI9341 3.2" TFT LCD Display. */
+
+
+#ifndef ILI9341_TX_QUEUE_LENGTH
+#define ILI9341_TX_QUEUE_LENGTH     (16)    /**< @brief Maximum number of SPI transfer segments that the @ref ili9341 can hold queued at the same time, per SPI bus, while waiting for them to be sent to the ILI9341 Devices via DMA. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_TX_QUEUE_LENGTH=32). @note This value must be within the range of 2 up to 255. */
+#endif
+#if (ILI9341_TX_QUEUE_LENGTH < 2) || (ILI9341_TX_QUEUE_LENGTH > 255)
+#error "ILI9341_TX_QUEUE_LENGTH must be within the range of 2 up to 255."
+#endif
+
+#ifndef ILI9341_GPIO_FAST_PATH
+#define ILI9341_GPIO_FAST_PATH      (1)     /**< @brief Whether the @ref ili9341 will toggle the CS and D/C pins by writing directly into the BSRR register of their GPIO ports with bit masks that are precomputed by @ref init_ili9341_module (1), or via the \c HAL_GPIO_WritePin function (0). @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_GPIO_FAST_PATH=0). */
+#endif
+
+#ifndef ILI9341_INTERFACE_ENDIAN
+#define ILI9341_INTERFACE_ENDIAN    (0)     /**< @brief @ref ILI9341_ENDIAN_t value with which @ref init_ili9341_module configures the Interface Control of the ILI9341 Devices. @note This value can be overridden by defining it from the compiler flags of your project, but it must be 0 (i.e., @ref ILI9341_ENDIAN_BIG ) since the ILI9341 Device does not honour @ref ILI9341_ENDIAN_LITTLE through its serial interface. */
+#endif
+#if ILI9341_INTERFACE_ENDIAN != 0
+#error "ILI9341_INTERFACE_ENDIAN must be 0, since the ILI9341 Device does not honour ILI9341_ENDIAN_LITTLE through its serial interface."
+#endif
+
+#ifndef ILI9341_INTERFACE_EPF
+#define ILI9341_INTERFACE_EPF       (0)     /**< @brief @ref ILI9341_EPF_t value with which @ref init_ili9341_module configures the Interface Control of the ILI9341 Devices. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_INTERFACE_EPF=1). */
+#endif
+
+#ifndef ILI9341_FIXED_BPP
+#define ILI9341_FIXED_BPP           (0)     /**< @brief Bits Per Pixel (i.e., 16 or 18) with which the @ref ili9341 drives all the ILI9341 Devices for good, so that it calls the functions of that Bits Per Pixel (BPP) type directly and leaves the ones of the other type out of the build, or 0 to be able to change it at runtime via @ref set_ili9341_bpp_type . @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_FIXED_BPP=16). */
+#endif
+#if (ILI9341_FIXED_BPP != 0) && (ILI9341_FIXED_BPP != 16) && (ILI9341_FIXED_BPP != 18)
+#error "ILI9341_FIXED_BPP must be either 0, 16 or 18."
+#endif
+
+#ifndef ILI9341_MAX_SPI_BUSES
+#define ILI9341_MAX_SPI_BUSES       (1)     /**< @brief Maximum number of different SPI peripherals that the @ref ili9341 can use at the same time to communicate with ILI9341 Devices, regardless of how many ILI9341 Devices are connected to each of them. @note This value can be overridden by defining it from the compiler flags of your project (e.g., -DILI9341_MAX_SPI_BUSES=2). */
+#endif
+
 /**@brief	ILI9341 TFT LCD driver Exception Codes.
  *
  * @details	These Exception Codes are returned by the functions of the @ref ili9341 to indicate the resulting
@@ -67,24 +159,54 @@ typedef enum
     ILI9341_BPP_18 = 1     //!< ILI9341 18 Bits Per Pixel.
 } ILI9341_BPP_t;
 
+/**@brief	ILI9341 Interface Control Endian types definitions.
+ *
+ * @details These definitions stand for the byte order in which the ILI9341 Device expects to receive each 16 bits per
+ *          pixel pixel (i.e., the ENDIAN bit of its Interface Control).
+ *
+ * @note    According to the ILI9341 datasheet, @ref ILI9341_ENDIAN_LITTLE is only valid with the 65k color 8 bit and
+ *          9 bit MCU interfaces, so the ILI9341 Device does not honour it through the serial interface that the
+ *          @ref ili9341 uses and @ref ili9341_set_interface_control rejects it. Native RGB565 buffers are instead sent
+ *          without byte-swapping them by @ref ili9341_write_pixels_16bpp , which uses 16 bit SPI data frames.
+ */
+typedef enum
+{
+    ILI9341_ENDIAN_BIG    = 0,    //!< The Most Significant Byte of each pixel is received first (ILI9341 default).
+    ILI9341_ENDIAN_LITTLE = 1     //!< The Least Significant Byte of each pixel is received first, just as RGB565 pixels are laid out in the memory of little-endian MCUs/MPUs (not honoured through the serial interface).
+} ILI9341_ENDIAN_t;
+
+/**@brief	ILI9341 Interface Control 65k to 262k Color Expansion types definitions.
+ *
+ * @details These definitions stand for how the ILI9341 Device fills the Least Significant Bit of the 6 bit Red and Blue
+ *          components whenever it stores a 16 bits per pixel pixel into its 18 bits per pixel Frame Memory (i.e., the
+ *          EPF field of its Interface Control).
+ */
+typedef enum
+{
+    ILI9341_EPF_MSB_COPY  = 0,    //!< The Least Significant Bit of Red and Blue is a copy of their Most Significant Bit (ILI9341 default).
+    ILI9341_EPF_ZERO      = 1,    //!< The Least Significant Bit of Red and Blue is set to 0.
+    ILI9341_EPF_ONE       = 2,    //!< The Least Significant Bit of Red and Blue is set to 1.
+    ILI9341_EPF_GREEN_LSB = 3     //!< The Least Significant Bit of Red and Blue is a copy of the Least Significant Bit of Green.
+} ILI9341_EPF_t;
+
 /**@brief	ILI9341 TFT LCD driver Bit Color Order.
  *
  * @details	These Bit Color Orders are used in some functions of the @ref ili9341 to hold the corresponding RGB colors
  *          for both the 16 bit and 18 bit per pixel color order as managed in the ILI9341 TFT LCD Device according to
  *          its datasheet.
  */
-union ILI9341_COLOR
+typedef union
 {
-    uint32_t 18_bpp;    //!< ILI9341 18 bit per pixel color order (i.e., Red = 6 bit, Green = 6 bit and Blue = 6 bit; or 262'144 colors), where the bits for each color should be arranged in the following manner:<br>- Bits 0 and 1 = Don't care.<br>- Bits 2 up to 7 = Color Blue.<br>- Bits 8 and 9 = Don't care.<br>- Bits 10 up to 15 = Color Green.<br>- Bits 16 and 17 = Don't care.<br>- Bits 18 up to 23 = Color Red.
-    uint16_t 16_bpp;    //!< ILI9341 16 bit per pixel color order (i.e., Red = 5 bit, Green = 6 bit and Blue = 5 bit; or 65'536 colors), where the bits for each color should be arranged in the following manner:<br>- Bits 0 up to 4 = Color Blue.<br>- Bits 5 up to 10 = Color Green.<br>- Bits 11 up to 15 = Color Red.
-};
+    uint32_t bpp_18;    //!< ILI9341 18 bit per pixel color order (i.e., Red = 6 bit, Green = 6 bit and Blue = 6 bit; or 262'144 colors), where the bits for each color should be arranged in the following manner:<br>- Bits 0 and 1 = Don't care.<br>- Bits 2 up to 7 = Color Blue.<br>- Bits 8 and 9 = Don't care.<br>- Bits 10 up to 15 = Color Green.<br>- Bits 16 and 17 = Don't care.<br>- Bits 18 up to 23 = Color Red.
+    uint16_t bpp_16;    //!< ILI9341 16 bit per pixel color order (i.e., Red = 5 bit, Green = 6 bit and Blue = 5 bit; or 65'536 colors), where the bits for each color should be arranged in the following manner:<br>- Bits 0 up to 4 = Color Blue.<br>- Bits 5 up to 10 = Color Green.<br>- Bits 11 up to 15 = Color Red.
+} ILI9341_COLOR;
 
 /**@brief	ILI9341 3.2" TFT LCD Driver GPIO Definition parameters structure.
  *
  * @details This contains all the fields required to associate a certain GPIO pin to the Chip Select pin (i.e., The CS
  *          pin) of the ILI9341 Device Hardware.
  */
-typedef struct __attribute__ ((__packed__))
+typedef struct
 {
     GPIO_TypeDef *GPIO_Port;	//!< Type Definition of the GPIO peripheral port to which this @ref ILI9341_GPIO_def_t structure will be associated with.
     uint16_t GPIO_Pin;			//!< Pin number of the GPIO peripheral from to this @ref ILI9341_GPIO_def_t structure will be associated with.
@@ -95,57 +217,546 @@ typedef struct __attribute__ ((__packed__))
  * @details This contains all the fields required to associate the corresponding peripheral pins of our MCU towards
  *          which the terminals of the ILI9341 Device are connected to.
  */
-typedef struct __attribute__ ((__packed__))
+typedef struct
 {
     ILI9341_GPIO_def_t CS;	     //!< Type Definition of the GPIO peripheral port to which the CS terminal of the ILI9341 device is connected to.
     ILI9341_GPIO_def_t RESET;    //!< Type Definition of the GPIO peripheral port to which the RESET terminal of the ILI9341 device is connected to.
     ILI9341_GPIO_def_t DC;       //!< Type Definition of the GPIO peripheral port to which the D/C terminal of the ILI9341 device is connected to.
 } ILI9341_peripherals_def_t;
 
-/**@brief   Initializes the @ref ili9341 and its designated ILI9341 3.2" TFT LCD Device.
+/**@brief	ILI9341 Address Window Shadow Registers parameters structure.
  *
- * @details This function will first update several of its Global Static Pointers and Variables that are used in the
- *          @ref ili9341 .
+ * @details This contains all the fields required to hold a copy of the Column Address Set and Page Address Set values
+ *          that were last sent to an ILI9341 Device, so that they are only sent again whenever they change.
+ */
+typedef struct
+{
+    uint16_t x0;                    //!< Start column of the last Column Address Set sent to the ILI9341 Device.
+    uint16_t x1;                    //!< End column of the last Column Address Set sent to the ILI9341 Device.
+    uint16_t y0;                    //!< Start row of the last Page Address Set sent to the ILI9341 Device.
+    uint16_t y1;                    //!< End row of the last Page Address Set sent to the ILI9341 Device.
+    uint8_t is_column_valid;        //!< Whether the @ref x0 and @ref x1 fields hold the actual Column Address Set values of the ILI9341 Device (1) or not (0).
+    uint8_t is_page_valid;          //!< Whether the @ref y0 and @ref y1 fields hold the actual Page Address Set values of the ILI9341 Device (1) or not (0).
+} ILI9341_window_shadow_def_t;
+
+/**@brief	ILI9341 Clip Rectangle parameters structure.
+ *
+ * @details This contains the bounds, which always lie within the screen, of the rectangle to which the drawing
+ *          functions of the @ref ili9341 are restricted (see @ref ili9341_set_clip_rect ).
+ */
+typedef struct
+{
+    uint16_t x0;                    //!< Left-most column of the Clip Rectangle.
+    uint16_t y0;                    //!< Top-most row of the Clip Rectangle.
+    uint16_t x1;                    //!< Right-most column of the Clip Rectangle.
+    uint16_t y1;                    //!< Bottom-most row of the Clip Rectangle.
+} ILI9341_clip_rect_def_t;
+
+/**@brief	ILI9341 SPI Bus Definition structure.
+ *
+ * @details This holds the SPI Transfer Queue that is shared by all the ILI9341 Devices connected to the same SPI
+ *          peripheral. Its fields are private to the @ref ili9341 .
+ */
+typedef struct ILI9341_bus_def ILI9341_bus_def_t;
+
+/**@brief	ILI9341 Device Handle structure.
  *
- * @note    This Global Static Pointers and variables that will be updated, initialized and/or persisted in the
- *          @ref ili9341 by this function are the following:<br>
- *          - The @ref p_hspi Global Static Pointer to point to the address towards which the \p hspi param points to.
- *          - The @ref p_ili9341_peripherals Pointer to point to the address, which should contain the required data of the GPIO peripherals towards which the 3.2" TFT LCD Device is connected to with respect to our MCU/MPU.
- * @note    <b>This function must be called only once</b> before calling any other function of the @ref ili9341 .
+ * @details This contains all the fields that the @ref ili9341 requires to drive a single ILI9341 Device, so that
+ *          several of them can be driven at the same time, even if they share the same SPI bus, by giving a different
+ *          ILI9341 Device Handle to each of them.
+ *
+ * @note    The application only has to allocate one of these structures per ILI9341 Device (e.g., as a global
+ *          variable) and give it to @ref init_ili9341_module . All its fields are then managed by the @ref ili9341 and
+ *          must not be modified by the application.
+ */
+typedef struct ILI9341_handle ILI9341_handle_t;
+struct ILI9341_handle
+{
+    ILI9341_bus_def_t *p_bus;                                                       //!< Pointer to the SPI Bus to which the ILI9341 Device is connected.
+    ILI9341_peripherals_def_t *p_peripherals;                                       //!< Pointer to the ILI9341 3.2" TFT LCD Device's Peripherals Definition Structure of the ILI9341 Device.
+#if ILI9341_GPIO_FAST_PATH
+    volatile uint32_t *p_cs_bsrr;                                                   //!< Pointer to the BSRR register of the GPIO port of the CS pin of the ILI9341 Device.
+    volatile uint32_t *p_dc_bsrr;                                                   //!< Pointer to the BSRR register of the GPIO port of the D/C pin of the ILI9341 Device.
+    uint32_t cs_enable_mask;                                                        //!< Value to be written into @ref p_cs_bsrr to set the CS pin to Low State.
+    uint32_t cs_disable_mask;                                                       //!< Value to be written into @ref p_cs_bsrr to set the CS pin to High State.
+    uint32_t dc_data_mask;                                                          //!< Value to be written into @ref p_dc_bsrr to set the D/C pin to High State (i.e., Data mode).
+    uint32_t dc_command_mask;                                                       //!< Value to be written into @ref p_dc_bsrr to set the D/C pin to Low State (i.e., Command mode).
+#endif
+#if ILI9341_FIXED_BPP == 0
+    ILI9341_BPP_t bpp_type;                                                         //!< ILI9341 Bits Per Pixel (BPP) Type with which the @ref ili9341 will be currently responding whenever processing the RGB pixel colors of the ILI9341 Device, which is also the shadow copy of its Pixel Format.
+    ILI9341_Status (*p_fill_area)(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ILI9341_COLOR color);  //!< Pointer to the function that fills an area of the screen with a single/plain color with the right Bits Per Pixel (BPP) Color Order.
+#endif
+    ILI9341_window_shadow_def_t window_shadow;                                      //!< Shadow copy of the Address Window of the ILI9341 Device.
+    ILI9341_clip_rect_def_t clip_rect;                                              //!< Rectangle of the screen outside of which the drawing functions of the @ref ili9341 do not draw anything.
+    uint8_t endian;                                                                 //!< Shadow copy of the @ref ILI9341_ENDIAN_t value of the Interface Control of the ILI9341 Device.
+    uint8_t epf;                                                                    //!< Shadow copy of the @ref ILI9341_EPF_t value of the Interface Control of the ILI9341 Device.
+    uint8_t is_memory_write_open;                                                   //!< Flag that tells whether the last command queued towards the ILI9341 Device was a Memory Write or a Memory Write Continue (1), so that further pixels can be queued right away, or not (0).
+    volatile uint8_t pending_tx_segments;                                           //!< Number of segments of the ILI9341 Device that are in the SPI Transfer Queue of its SPI Bus and that have not been completely sent yet.
+    volatile ILI9341_Status tx_status;                                              //!< First error detected while sending the segments of the ILI9341 Device, which is reported and then cleared by @ref ili9341_wait_until_idle .
+    volatile uint8_t line_buffer_users;                                             //!< Number of segments of the SPI Transfer Queue that are still sending the @ref line_buffer .
+    uint8_t is_line_buffer_valid;                                                   //!< Flag that tells whether the @ref line_buffer is completely filled with the @ref line_buffer_color (1) or not (0).
+    uint32_t line_buffer_color;                                                     //!< Color, in the Bit Color Order of the current Bits Per Pixel (BPP) type, with which the @ref line_buffer is filled.
+    union
+    {
+#if ILI9341_FIXED_BPP != 18
+        uint16_t bpp_16[ILI9341_SCREEN_WIDTH];                                      //!< Row of 16 bits per pixel pixels in the native byte order of the MCU/MPU.
+#endif
+#if ILI9341_FIXED_BPP != 16
+        uint8_t bpp_18[ILI9341_SCREEN_WIDTH * 3];                                   //!< Row of 18 bits per pixel pixels, already expanded into the 3 bytes (i.e., Red, Green and Blue) with which each of them is sent to the ILI9341 Device.
+#endif
+    } line_buffer;                                                                  //!< Buffer holding a whole row of pixels of a single/plain color, which is sent repeatedly to the ILI9341 Device whenever filling an area of its screen.
+};
+
+/**@brief   Initializes an ILI9341 Device Handle of the @ref ili9341 and its designated ILI9341 3.2" TFT LCD Device.
+ *
+ * @details This function will first initialize all the fields of the ILI9341 Device Handle given in the \p p_handle
+ *          param and will attach it to the SPI Bus of the \p hspi param, which is shared with any other ILI9341 Device
+ *          Handle that was previously initialized with that same SPI peripheral. The segments of all the ILI9341
+ *          Devices of a same SPI Bus are then sent through a single SPI Transfer Queue, where the CS pin of each of
+ *          those devices is only enabled while its own segments are being sent. This way, the DMA transfer towards one
+ *          ILI9341 Device can overlap with the CPU preparing the data of another one.
+ *
+ * @note    <b>This function must be called only once per ILI9341 Device</b> before calling any other function of the
+ *          @ref ili9341 with its ILI9341 Device Handle.
+ * @note    Up to @ref ILI9341_MAX_SPI_BUSES different SPI peripherals can be used at the same time.
  *
  * @details Subsequently, this function will configure the ILI3.2" TFT LCD Device by following the next steps in that
  *          orderly fashion:
  *          1. Apply an ILI9341 Hardware Reset.
  *          2. Apply an ILI9341 Software Reset.
  *          3. Set the ILI9341 Power Control 1 to have its GVDD Level to 4.6V.
- *          4. Set the ILI9341 VCOM Control 1 to have its VCOMH and VCOML voltages set to 4.25V and -1.5V respectively.
- *          5. Set the ILI9341 VCOM Control 2 so t hat the VMH and VML have an offset of -58 and -58 respectively.
- *          6. Configure the Memory Access Control.
- *          7. Configure the Pixel Format to 16 bit per pixel (i.e., 65k color mode).
- *          8. Configure the ILI9341 Display Function Control with all its default values and changing only the source/ VCOM's "Source output on non-display area" from AGND and AGND to V63 and V0 respectively and its "VCOM output on non-display area" from AGND and AGND to VCOML and VCOMH respectively.
- *          9. Exit ILI9341 from Sleep Mode.
- *          10. Turn On the ILI9341 Display.
+ *          4. Set the ILI9341 Power Control 2.
+ *          5. Set the ILI9341 VCOM Control 1 to have its VCOMH and VCOML voltages set to 4.25V and -1.5V respectively.
+ *          6. Set the ILI9341 VCOM Control 2 so t hat the VMH and VML have an offset of -58 and -58 respectively.
+ *          7. Configure the Memory Access Control.
+ *          8. Configure the Pixel Format to 16 bit per pixel (i.e., 65k color mode), or to 18 bit per pixel if
+ *             @ref ILI9341_FIXED_BPP is 18.
+ *          9. Configure the Interface Control with the @ref ILI9341_INTERFACE_ENDIAN and @ref ILI9341_INTERFACE_EPF values.
+ *          10. Configure the Frame Rate Control to 79Hz.
+ *          11. Configure the ILI9341 Display Function Control with all its default values and changing only the source/ VCOM's "Source output on non-display area" from AGND and AGND to V63 and V0 respectively and its "VCOM output on non-display area" from AGND and AGND to VCOML and VCOMH respectively.
+ *          12. Configure the Gamma Curve and its Positive and Negative Gamma Corrections.
+ *          13. Exit ILI9341 from Sleep Mode.
+ *          14. Turn On the ILI9341 Display.
  *
+ * @note    Steps 2 up to 14 are sent as a single Flash-resident ILI9341 Command Sequence, with a single CS assertion
+ *          and with all their Commands and Data being sent by DMA directly from Flash Memory.
+ * @note    This function will halt until the whole initialization process has concluded.
+ *
+ * @param[out] p_handle     Pointer to the ILI9341 Device Handle to be initialized.
  * @param[in] hspi          Pointer to the SPI is desired for the @ref ili9341 to use for exchanging information with
  *                          the ILI9341 3.2" TFT LCD via the SPI Communication Protocol.
  * @param[in] peripherals   Pointer to the ILI9341 3.2" TFT LCD Device's Peripherals Definition parameters structure
  *                          that should contain the required data of the Pin Peripherals at which the ILI9341 TFT LCD
  *                          Device is expected to be connected at with respect to our MCU/MPU.
  *
- * @retval  MLX90614_EC_OK  If the @ref ili9341 has been successfully initialized.
- * @retval  MLX90614_EC_NR  If either the ILI9341 3.2" TFT LCD Device wired to our MPU/MCU is not ready for SPI
+ * @retval  ILI9341_EC_OK  If the @ref ili9341 has been successfully initialized.
+ * @retval  ILI9341_EC_NR  If either the ILI9341 3.2" TFT LCD Device wired to our MPU/MCU is not ready for SPI
  *                          Communication (if this happens check that the wiring is correct, that your ILI9341 Device is
  *                          functioning correctly and that your MCU/MPU SPI peripheral has been correctly configured),
  *                          or it the ILI9341 Device stops responding via the SPI Protocol during the initialization
  *                          process of this function.
- * @retval  MLX90614_EC_ERR The @ref ili9341 was not initialized due to that something went wrong either with the
+ * @retval  ILI9341_EC_ERR The @ref ili9341 was not initialized due to that something went wrong either with the
  *                          ILI9341 Device or with the SPI Communication established between that device and our
- *                          MCU/MPU.
+ *                          MCU/MPU, or if \p hspi is a different SPI peripheral than the ones already in use and
+ *                          there are already @ref ILI9341_MAX_SPI_BUSES of them.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    November 12, 2024.
  */
-ILI9341_Status init_ili9341_module(SPI_HandleTypeDef *hspi, ILI9341_peripherals_def_t *peripherals);
+ILI9341_Status init_ili9341_module(ILI9341_handle_t *p_handle, SPI_HandleTypeDef *hspi, ILI9341_peripherals_def_t *peripherals);
+
+/**@brief   Sets the Address Window of the ILI9341 Device (i.e., the rectangular area of its Frame Memory into which
+ *          the subsequent pixels sent with @ref ili9341_write_pixels will be written) and starts a Memory Write into it.
+ *
+ * @details The @ref ili9341 keeps a shadow copy of the last Column Address Set and Page Address Set values that were
+ *          sent to the ILI9341 Device. Therefore, this function will only send those commands whenever the columns
+ *          and/or the rows of the requested Address Window differ from the ones of the current Address Window, which is
+ *          what mostly dominates the cost of updating small areas of the screen. Only the Memory Write command is
+ *          always sent so that the pixels are written from the top-left corner of the Address Window.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x0            Column of the left edge of the Address Window.
+ * @param y0            Row of the top edge of the Address Window.
+ * @param x1            Column of the right edge of the Address Window (inclusive).
+ * @param y1            Row of the bottom edge of the Address Window (inclusive).
+ *
+ * @retval  ILI9341_EC_OK if setting the Address Window was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if \p x0 is greater than \p x1 , if \p y0 is greater than \p y1 or if the requested
+ *          Address Window does not fit inside the screen of the ILI9341 Display.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_set_window(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**@brief   Writes the given pixels into the current Address Window of the ILI9341 Device, continuing from where the last
+ *          written pixel was left.
+ *
+ * @details The pixels are written row by row, from the top-left to the bottom-right corner of the Address Window set
+ *          with @ref ili9341_set_window . In case that some other command was sent to the ILI9341 Device after the
+ *          last written pixel, then this function will first send a Memory Write Continue command so that the pixels
+ *          are written right after that last pixel instead of having to reopen the Address Window.
+ *
+ * @note    The pixels are sent by DMA directly from \p pixels , so it must remain valid and unmodified until they
+ *          have been sent (see \p p_is_buffer_in_use param).
+ *
+ * @param[in] p_handle              Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param[in] pixels                Pointer to the pixels to be written, which must be given in the byte order expected
+ *                                  by the ILI9341 Device (i.e., with the Most Significant Byte of each pixel first) and
+ *                                  with the Bits Per Pixel (BPP) type that the @ref ili9341 is currently using. In 18
+ *                                  bits per pixel, each pixel is made of 3 bytes (i.e., Red, Green and Blue, in that
+ *                                  order), where the 6 bits of each color are held in the 6 Most Significant Bits of its
+ *                                  byte.
+ * @param size                      Size in bytes of \p pixels , which may be as large as a whole frame (e.g., 153'600
+ *                                  bytes in 16 bits per pixel), since it is sent in as many consecutive DMA transfers as
+ *                                  required without releasing the CS pin in between.
+ * @param[out] p_is_buffer_in_use   Pointer to a flag that this function will set and that will be cleared once
+ *                                  \p pixels is no longer in use by the DMA, or NULL if the caller will instead keep
+ *                                  \p pixels valid until @ref ili9341_wait_until_idle returns.
+ *
+ * @retval  ILI9341_EC_OK if writing the pixels was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p size is zero or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_write_pixels(ILI9341_handle_t *p_handle, const uint8_t *pixels, uint32_t size, volatile uint8_t *p_is_buffer_in_use);
+
+/**@brief   Writes the given 16 bits per pixel pixels, held in the native byte order of the MCU/MPU, into the current
+ *          Address Window of the ILI9341 Device, continuing from where the last written pixel was left.
+ *
+ * @details This function works just like @ref ili9341_write_pixels , but the SPI peripheral is switched into 16 bit
+ *          data frames while sending \p pixels , which makes it shift out the Most Significant Byte of each
+ *          \c uint16_t first regardless of how it is stored in memory. Therefore, RGB565 arrays can be sent directly
+ *          without having to byte-swap them first and the DMA only has to move one half-word per pixel instead of
+ *          two bytes. The SPI peripheral is switched back into 8 bit data frames for the next ILI9341 Command.
+ *
+ * @note    The pixels are sent by DMA directly from \p pixels , so it must remain valid and unmodified until they
+ *          have been sent (see \p p_is_buffer_in_use param).
+ *
+ * @param[in] p_handle              Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param[in] pixels                Pointer to the pixels to be written in the 16 bits per pixel Bit Color Order (see
+ *                                  @ref ILI9341_COLOR::bpp_16 ).
+ * @param count                     Number of pixels in \p pixels .
+ * @param[out] p_is_buffer_in_use   Pointer to a flag that this function will set and that will be cleared once
+ *                                  \p pixels is no longer in use by the DMA, or NULL if the caller will instead keep
+ *                                  \p pixels valid until @ref ili9341_wait_until_idle returns.
+ *
+ * @retval  ILI9341_EC_OK if writing the pixels was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if the @ref ili9341 is not currently using the 16 bits per pixel Bits Per Pixel (BPP) type
+ *          with the ILI9341 Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p count is zero or if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_write_pixels_16bpp(ILI9341_handle_t *p_handle, const uint16_t *pixels, uint32_t count, volatile uint8_t *p_is_buffer_in_use);
+
+/**@brief   Sets the byte order of the 16 bits per pixel pixels and the 65k to 262k color expansion of the Interface
+ *          Control of the ILI9341 Device.
+ *
+ * @details The @ref ili9341 keeps a shadow copy of the Interface Control of each ILI9341 Device, so that this function
+ *          only sends it whenever the requested values differ from the current ones.
+ *
+ * @note    The initial values of the Interface Control are given by @ref ILI9341_INTERFACE_ENDIAN and
+ *          @ref ILI9341_INTERFACE_EPF .
+ * @note    Only @ref ILI9341_ENDIAN_BIG is accepted, since the ILI9341 Device does not honour
+ *          @ref ILI9341_ENDIAN_LITTLE through its serial interface (see @ref ILI9341_ENDIAN_t ).
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param endian        Byte order in which the ILI9341 Device is to receive each 16 bits per pixel pixel, which must
+ *                      be @ref ILI9341_ENDIAN_BIG .
+ * @param epf           Way in which the ILI9341 Device is to expand 16 bits per pixel pixels into its Frame Memory.
+ *
+ * @retval  ILI9341_EC_OK if the Interface Control was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p endian is not @ref ILI9341_ENDIAN_BIG , if \p epf is not valid or if something else
+ *          went wrong with the SPI.
+ */
+ILI9341_Status ili9341_set_interface_control(ILI9341_handle_t *p_handle, ILI9341_ENDIAN_t endian, ILI9341_EPF_t epf);
+
+/**@brief   Sets the Bits Per Pixel (BPP) type with which the ILI9341 Device is to receive the subsequent pixels.
+ *
+ * @details The @ref ili9341 keeps a shadow copy of the Pixel Format of each ILI9341 Device, so that this function only
+ *          sends the Pixel Format Set command whenever the requested Bits Per Pixel (BPP) type differs from the current
+ *          one. Therefore, switching between 16 and 18 bits per pixel within a single frame (e.g., to draw photos in 18
+ *          bits per pixel and the rest of the user interface in the cheaper 16 bits per pixel) only costs a 2 bytes
+ *          command per switch.
+ *
+ * @note    The ILI9341 Device is set to @ref ILI9341_BPP_16 by @ref init_ili9341_module .
+ * @note    If @ref ILI9341_FIXED_BPP is not 0, then the Bits Per Pixel (BPP) type cannot be changed and this function
+ *          only succeeds if \p bpp matches it.
+ * @note    Changing the Bits Per Pixel (BPP) type does not modify the pixels that are already in the Frame Memory of
+ *          the ILI9341 Device, and the subsequent pixels given to @ref ili9341_write_pixels are written right after
+ *          the last written one.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param bpp           Bits Per Pixel (BPP) type that is desired for the ILI9341 Device.
+ *
+ * @retval  ILI9341_EC_OK if the Bits Per Pixel (BPP) type was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_NA if @ref ILI9341_FIXED_BPP is not 0 and \p bpp does not match it.
+ * @retval  ILI9341_EC_ERR if \p bpp is not valid or if something else went wrong with the SPI.
+ */
+ILI9341_Status set_ili9341_bpp_type(ILI9341_handle_t *p_handle, ILI9341_BPP_t bpp);
+
+/**@brief   Gets the Bits Per Pixel (BPP) type with which the ILI9341 Device is currently receiving pixels.
+ *
+ * @details This allows the modules built on top of the @ref ili9341 to send their pixels, through
+ *          @ref ili9341_write_pixels or @ref ili9341_write_pixels_16bpp , in the Bits Per Pixel (BPP) type that the
+ *          ILI9341 Device expects.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ *
+ * @return  The Bits Per Pixel (BPP) type of the ILI9341 Device (see @ref set_ili9341_bpp_type ).
+ */
+ILI9341_BPP_t get_ili9341_bpp_type(ILI9341_handle_t *p_handle);
+
+/**@brief   Fills the whole screen of the ILI9341 3.2" TFT LCD Display with a single/plain color.
+ *
+ * @details This function sets the Address Window of the ILI9341 Device to the whole screen and then streams the
+ *          requested color towards it from a small line buffer that holds a single row of pixels of that color. That
+ *          line buffer is sent once per row by re-starting its DMA transfer from @ref ili9341_spi_tx_cplt_callback ,
+ *          so that the 153'600 bytes (in 16 bits per pixel) of a whole screen can be sent without the CPU having to
+ *          intervene and without being limited by the maximum size of a single DMA transfer. In 16 bits per pixel,
+ *          that line buffer is sent in 16 bit SPI frames (see @ref ili9341_write_pixels_16bpp ). In 18 bits per
+ *          pixel, that line buffer is expanded only once into the 3 bytes per pixel that the ILI9341 Device expects,
+ *          so that filling the screen only costs the 50% additional bytes sent through the SPI and no additional work
+ *          per pixel from the CPU.
+ *
+ * @note    This function does not wait for the screen to be filled before returning. However, if a previous call to
+ *          this function is still streaming a different color, then this function will first halt until that line
+ *          buffer is available again. Each ILI9341 Device Handle has its own line buffer.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param color         Color with which the screen is to be filled, which must be given in the Bit Color Order of
+ *                      the Bits Per Pixel (BPP) type that the @ref ili9341 is currently using (see
+ *                      @ref ILI9341_COLOR ).
+ *
+ * @retval  ILI9341_EC_OK if filling the screen was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_fill_screen(ILI9341_handle_t *p_handle, ILI9341_COLOR color);
+
+/**@brief   Fills a rectangle of the screen of the ILI9341 3.2" TFT LCD Display with a single/plain color.
+ *
+ * @details This function clips the requested rectangle to the Clip Rectangle (see @ref ili9341_set_clip_rect ), which
+ *          is the whole screen by default, sets the Address Window of the ILI9341 Device
+ *          to it and then streams the requested color into it from the same line buffer used by
+ *          @ref ili9341_fill_screen . Since the ILI9341 Device moves to the next row of the Address Window by itself,
+ *          that line buffer is sent whole as many times as it fits into the pixels of the rectangle plus, if needed,
+ *          once more with only the remaining pixels. Therefore, any rectangle costs a single Address Window setup and
+ *          at most 2 queued segments, without requiring a framebuffer or any work per pixel from the CPU.
+ *
+ * @note    Rectangles with a zero width or height, or that lie completely outside of the Clip Rectangle, are rejected
+ *          before anything is sent to the ILI9341 Device.
+ * @note    This function does not wait for the rectangle to be filled before returning, and it shares the line buffer
+ *          with @ref ili9341_fill_screen , @ref ili9341_draw_hline and @ref ili9341_draw_vline (i.e., it first halts
+ *          until that line buffer is available again if a previous fill is still streaming a different color, while
+ *          consecutive fills with the same color are queued right away).
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the top-left corner of the rectangle, which may lie outside of the screen.
+ * @param y             Row of the top-left corner of the rectangle, which may lie outside of the screen.
+ * @param width         Number of columns of the rectangle.
+ * @param height        Number of rows of the rectangle.
+ * @param color         Color with which the rectangle is to be filled, which must be given in the Bit Color Order of
+ *                      the Bits Per Pixel (BPP) type that the @ref ili9341 is currently using (see
+ *                      @ref ILI9341_COLOR ).
+ *
+ * @retval  ILI9341_EC_OK if filling the rectangle was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested rectangle lies within the Clip Rectangle.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_fill_rect(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height, ILI9341_COLOR color);
+
+/**@brief   Draws a horizontal line on the ILI9341 3.2" TFT LCD Display, which is filled as a 1 pixel tall rectangle
+ *          via @ref ili9341_fill_rect .
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the left-most pixel of the line, which may lie outside of the screen.
+ * @param y             Row of the line, which may lie outside of the screen.
+ * @param width         Number of pixels of the line.
+ * @param color         Color of the line (see @ref ili9341_fill_rect ).
+ *
+ * @retval  ILI9341_EC_OK if drawing the line was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested line lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_hline(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, ILI9341_COLOR color);
+
+/**@brief   Draws a vertical line on the ILI9341 3.2" TFT LCD Display, which is filled as a 1 pixel wide rectangle
+ *          via @ref ili9341_fill_rect .
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the line, which may lie outside of the screen.
+ * @param y             Row of the top-most pixel of the line, which may lie outside of the screen.
+ * @param height        Number of pixels of the line.
+ * @param color         Color of the line (see @ref ili9341_fill_rect ).
+ *
+ * @retval  ILI9341_EC_OK if drawing the line was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested line lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_vline(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t height, ILI9341_COLOR color);
+
+/**@brief   Draws a single pixel on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The color of the pixel is copied inside the SPI Transfer Queue itself instead of using the line buffer of
+ *          @ref ili9341_fill_rect , and the Column Address Set and Page Address Set are only sent whenever they differ
+ *          from the ones of the Address Window currently set in the ILI9341 Device. Therefore, a pixel costs at most
+ *          the 11 bytes of a whole Address Window setup plus its own 2 or 3 bytes, and just 8 or 9 bytes whenever it
+ *          shares its column or its row with the previous Address Window.
+ *
+ * @note    This is meant for isolated pixels. Whenever several pixels in a row or a column have the same color,
+ *          drawing them with @ref ili9341_draw_hline or @ref ili9341_draw_vline is much cheaper.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the pixel, which may lie outside of the screen.
+ * @param y             Row of the pixel, which may lie outside of the screen.
+ * @param color         Color of the pixel (see @ref ili9341_fill_rect ).
+ *
+ * @retval  ILI9341_EC_OK if drawing the pixel was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if the requested pixel lies outside of the Clip Rectangle (see @ref ili9341_set_clip_rect ).
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_draw_pixel(ILI9341_handle_t *p_handle, int16_t x, int16_t y, ILI9341_COLOR color);
+
+/**@brief   Restricts the drawing functions of the @ref ili9341 to a rectangle of the screen of the ILI9341 3.2" TFT
+ *          LCD Display.
+ *
+ * @details Once set, the Clip Rectangle is applied by @ref ili9341_fill_rect , @ref ili9341_draw_pixel and
+ *          @ref ili9341_blit (and therefore by every function built on top of them, such as @ref ili9341_fill_screen
+ *          or the ones of other modules that draw through them), so that, for example, a widget can be redrawn
+ *          without touching its neighbours. Since clipping only changes the Address Window of what is drawn, it costs
+ *          nothing over the SPI. However, @ref ili9341_set_window and the functions that write pixels into it are not
+ *          affected.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the top-left corner of the Clip Rectangle, which may lie outside of the screen.
+ * @param y             Row of the top-left corner of the Clip Rectangle, which may lie outside of the screen.
+ * @param width         Number of columns of the Clip Rectangle.
+ * @param height        Number of rows of the Clip Rectangle.
+ *
+ * @retval  ILI9341_EC_OK if the Clip Rectangle was set to the part of the requested rectangle that lies within the
+ *          screen.
+ * @retval  ILI9341_EC_NA if no pixel of the requested rectangle lies within the screen, in which case the Clip
+ *          Rectangle is left unchanged.
+ */
+ILI9341_Status ili9341_set_clip_rect(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height);
+
+/**@brief   Sets the Clip Rectangle of the ILI9341 Device back to the whole screen (see @ref ili9341_set_clip_rect ),
+ *          which is also its value after @ref init_ili9341_module .
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ */
+void ili9341_reset_clip_rect(ILI9341_handle_t *p_handle);
+
+/**@brief   Draws a rectangular bitmap of 16 bits per pixel pixels on the ILI9341 3.2" TFT LCD Display.
+ *
+ * @details The bitmap is clipped to the Clip Rectangle (see @ref ili9341_set_clip_rect ) and the Address Window of the
+ *          ILI9341 Device is set to what is left of it. Its pixels are then sent by DMA directly from \p pixels ,
+ *          without being copied anywhere, and with the SPI data frames that suit the byte order of the Interface
+ *          Control (see @ref ili9341_write_pixels_16bpp ). Whenever the visible rows of the bitmap lie back to back in
+ *          memory (i.e., whenever no column of it is clipped and \p stride equals \p width ), all of them are sent as
+ *          a single segment of the SPI Transfer Queue. Otherwise, each visible row is sent as a segment of its own
+ *          that starts at its first visible pixel.
+ *
+ * @note    Since \p pixels is read by the DMA in the background, it can be placed in flash memory (e.g., a
+ *          \c const array), while a bitmap held in RAM must remain valid and unmodified until
+ *          @ref ili9341_wait_until_idle returns.
+ * @note    Bitmaps whose visible part has many rows but few columns are best placed with \p stride equal to
+ *          \p width , so that they are sent as a single segment whenever they are not clipped horizontally.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the top-left corner of the bitmap, which may lie outside of the screen.
+ * @param y             Row of the top-left corner of the bitmap, which may lie outside of the screen.
+ * @param width         Number of columns of the bitmap.
+ * @param height        Number of rows of the bitmap.
+ * @param[in] pixels    Pointer to the top-left pixel of the bitmap, whose pixels are given row by row in the 16 bits per
+ *                      pixel Bit Color Order (see @ref ILI9341_COLOR::bpp_16 ) and in the native byte order of the
+ *                      MCU/MPU.
+ * @param stride        Number of pixels between the start of a row of \p pixels and the start of the next one, which
+ *                      allows drawing a part of a larger bitmap (e.g., one icon of a sheet of icons).
+ *
+ * @retval  ILI9341_EC_OK if drawing the bitmap was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested bitmap lies within the Clip Rectangle or if the @ref ili9341 is
+ *          not currently using the 16 bits per pixel Bits Per Pixel (BPP) type with the ILI9341 Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p pixels is NULL, if \p stride is lower than \p width or if something else went wrong
+ *          with the SPI.
+ */
+ILI9341_Status ili9341_blit(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t *pixels,
+                            uint16_t stride);
+
+/**@brief   Drains the SPI Transfer Queue of the @ref ili9341 by starting the DMA transfer of the next queued segment
+ *          (if any) whenever the previous one has been completely sent to the ILI9341 Device.
+ *
+ * @details The functions of the @ref ili9341 do not wait for their data to be sent before returning. Instead, they
+ *          place each of their commands and data into a bounded SPI Transfer Queue, where each queued segment holds
+ *          whether it is a Command or a Data (i.e., the D/C pin state with which it has to be sent), whether the CS pin
+ *          has to be released after it and who owns its buffer. This function is the one that then consumes that
+ *          queue, one segment per DMA transfer, so that the application can keep running while, for example, a full
+ *          screen update is being streamed out.
+ *
+ * @note    <b>This function must be called from the \c HAL_SPI_TxCpltCallback function of your application</b>, as
+ *          shown in the following code example:
+ * @code
+  void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+  {
+      ili9341_spi_tx_cplt_callback(hspi);
+  }
+ * @endcode
+ * @note    This function will do nothing if \p hspi param does not point to any of the SPI Handle Structures with
+ *          which the ILI9341 Device Handles were initialized. Therefore, it is safe to call it for every SPI of your
+ *          MCU/MPU.
+ *
+ * @param[in] hspi  Pointer to the SPI Handle Structure of the SPI that has just completed a DMA transfer.
+ */
+void ili9341_spi_tx_cplt_callback(SPI_HandleTypeDef *hspi);
+
+/**@brief   Aborts all the segments pending in the SPI Transfer Queue of the SPI Bus of \p hspi and latches an
+ *          @ref ILI9341_EC_ERR Exception Code into each of the ILI9341 Device Handles that had segments in it, so that
+ *          it is returned by their next call to @ref ili9341_wait_until_idle .
+ *
+ * @note    <b>This function should be called from the \c HAL_SPI_ErrorCallback function of your application</b>.
+ * @note    This function will do nothing if \p hspi param does not point to any of the SPI Handle Structures with
+ *          which the ILI9341 Device Handles were initialized.
+ *
+ * @param[in] hspi  Pointer to the SPI Handle Structure of the SPI that has reported an error.
+ */
+void ili9341_spi_error_callback(SPI_HandleTypeDef *hspi);
+
+/**@brief   Tells whether an ILI9341 Device still has segments in the SPI Transfer Queue of its SPI Bus that have not
+ *          been completely sent to it.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ *
+ * @retval  0   If none of the segments of the ILI9341 Device are pending to be sent.
+ * @retval  1   Otherwise.
+ */
+uint8_t ili9341_is_busy(ILI9341_handle_t *p_handle);
+
+/**@brief   Halts the application until all the segments of an ILI9341 Device that are in the SPI Transfer Queue of
+ *          its SPI Bus have been completely sent to it.
+ *
+ * @details Only the segments of the given ILI9341 Device are waited for. Therefore, the segments of the other ILI9341
+ *          Devices of the same SPI Bus may still be pending to be sent once this function returns.
+ *
+ * @note    Since any SPI/DMA error can only be detected from within an interrupt, the @ref ili9341 latches the first
+ *          error that takes place while sending the segments of each ILI9341 Device, which is then reported and
+ *          cleared by this function.
+ * @note    <b style="color:red">WARNING:</b> Do not call this function from within an interrupt whose priority is
+ *          equal or higher than the one of the DMA-SPI designated to the @ref ili9341 , since the queue would then
+ *          never be drained.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ *
+ * @retval  ILI9341_EC_OK if all the queued segments were sent successfully to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending any of the queued segments.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+ILI9341_Status ili9341_wait_until_idle(ILI9341_handle_t *p_handle);
 
 #endif /* ILI9341_TFT_LCD_DRIVER_H_ */
 
@@ -0,0 +1,545 @@
+/** @addtogroup ili9341_fonts
+ * @{
+ */
+
+#include "ili9341_fonts.h"
+
+#define ILI9341_FONTS_RLE_INK_FLAG          (0x80)  /**< @brief Bit of a Run-Length Encoded token that tells that it is not a run of pixels without coverage. */
+#define ILI9341_FONTS_RLE_LITERAL_FLAG      (0x40)  /**< @brief Bit of a Run-Length Encoded token, with @ref ILI9341_FONTS_RLE_INK_FLAG set, that tells that its pixels are followed by their coverages rather than having full coverage. */
+#define ILI9341_FONTS_RLE_BACKGROUND_MASK   (0x7F)  /**< @brief Mask of the number of pixels, minus one, of a Run-Length Encoded token of pixels without coverage. */
+#define ILI9341_FONTS_RLE_COUNT_MASK        (0x3F)  /**< @brief Mask of the number of pixels, minus one, of the rest of the Run-Length Encoded tokens. */
+
+/**@brief	ILI9341 Glyph Decoder parameters structure.
+ *
+ * @details This contains the position within the bitmap of a glyph, either plain or Run-Length Encoded, up to which
+ *          the coverages of its pixels have been decoded.
+ */
+typedef struct
+{
+    const uint8_t *p_data;      //!< Pointer to the next byte of the bitmap to be read.
+    uint16_t count;             //!< Number of pixels of the current token that have not been decoded yet, where a plain bitmap is decoded as a single token of packed coverages.
+    uint8_t coverage;           //!< Coverage of the pixels of the current token, if it is a run.
+    uint8_t is_packed;          //!< Whether the coverages of the pixels of the current token are packed at @ref p_data (1) or the current token is a run (0).
+    uint8_t shift;              //!< Number of bits by which the byte at @ref p_data is shifted right to get the coverage of the next pixel, if the current token is packed.
+    uint8_t bpp;                //!< Number of bits of the coverage of each pixel.
+    uint8_t mask;               //!< Mask of the coverage of a pixel (i.e., <tt>2^bpp - 1</tt>).
+} ILI9341_glyph_decoder_t;
+
+/**@brief	ILI9341 Color Ramp parameters structure.
+ *
+ * @details This contains the colors with which the pixels of the glyphs are drawn for each of their coverages, when
+ *          drawn with the given pair of ink and background colors in the given Bits Per Pixel (BPP) type.
+ */
+typedef struct
+{
+    ILI9341_COLOR color;                                //!< Color of the ink of the glyphs, which is the last color of @ref ramp .
+    ILI9341_COLOR background;                           //!< Background color, which is the first color of @ref ramp .
+    ILI9341_BPP_t bpp;                                  //!< Bits Per Pixel (BPP) type of @ref color , @ref background and @ref ramp .
+    ILI9341_COLOR ramp[ILI9341_FONTS_RAMP_LENGTH];      //!< Colors from @ref background up to @ref color , each of whose channels is linearly interpolated between them.
+} ILI9341_ramp_def_t;
+
+/**@brief   Strip buffers into which the text boxes are rendered, where one of them is filled while the other one is
+ *          being sent by DMA.
+ */
+static union
+{
+    uint16_t bpp_16[2][ILI9341_FONTS_STRIP_PIXELS];                             //!< Strip buffers viewed as 16 bits per pixel pixels.
+    uint8_t bpp_18[2][ILI9341_FONTS_STRIP_PIXELS * sizeof(uint16_t)];          //!< Strip buffers viewed as the 3 bytes (i.e., Red, Green and Blue) of each 18 bits per pixel pixel.
+} strip_buffers;
+
+/**@brief   Flags that tell whether each of @ref strip_buffers is still in use by the DMA (1) or not (0), as given to
+ *          @ref ili9341_write_pixels_16bpp and @ref ili9341_write_pixels .
+ */
+static volatile uint8_t is_strip_buffer_in_use[2];
+
+/**@brief   Color ramps of the pairs of ink and background colors with which text has recently been drawn.
+ */
+static ILI9341_ramp_def_t ramp_cache[ILI9341_FONTS_RAMP_CACHE_SIZE];
+
+/**@brief   Number of color ramps of @ref ramp_cache that have been computed.
+ */
+static uint8_t ramp_count = 0;
+
+/**@brief   Index of the color ramp of @ref ramp_cache that is to be replaced by the next one to be computed once all of
+ *          them are in use, which is always the one that was computed the longest time ago.
+ */
+static uint8_t next_ramp = 0;
+
+/**@brief   Gets the color ramp of a pair of ink and background colors from @ref ramp_cache , computing it into the
+ *          cache first if it is not there yet.
+ *
+ * @param bpp           Bits Per Pixel (BPP) type of \p color and \p background .
+ * @param color         Color of the ink of the glyphs.
+ * @param background    Background color.
+ *
+ * @return  Pointer to the colors of the ramp, which remain valid until the ramp is replaced by another one.
+ */
+static const ILI9341_COLOR *ili9341_get_ramp(ILI9341_BPP_t bpp, ILI9341_COLOR color, ILI9341_COLOR background);
+
+/**@brief   Finds the glyph of a character in a font.
+ *
+ * @param[in] p_font    Pointer to the font.
+ * @param character     Character whose glyph is to be found.
+ *
+ * @return  Pointer to the glyph of \p character , or NULL if it has none in \p p_font .
+ */
+static const ILI9341_glyph_t *ili9341_find_glyph(const ILI9341_font_t *p_font, uint8_t character);
+
+/**@brief   Gets the kerning adjustment of a pair of characters in a font.
+ *
+ * @param[in] p_font    Pointer to the font.
+ * @param left          Character of the glyph at the left.
+ * @param right         Character of the glyph at the right.
+ *
+ * @return  The number of columns by which the pen is moved before drawing the glyph of \p right , which is 0 if the
+ *          pair has no kerning pair in \p p_font .
+ */
+static int8_t ili9341_get_kerning(const ILI9341_font_t *p_font, uint8_t left, uint8_t right);
+
+/**@brief   Decodes the coverage of the next pixel of the bitmap of a glyph.
+ *
+ * @param[in,out] p_decoder Pointer to the Glyph Decoder of the bitmap.
+ *
+ * @return  The coverage of the pixel.
+ */
+static uint8_t ili9341_decode_coverage(ILI9341_glyph_decoder_t *p_decoder);
+
+/**@brief   Skips the given number of pixels of the bitmap of a glyph, where whole runs are skipped at once.
+ *
+ * @param[in,out] p_decoder Pointer to the Glyph Decoder of the bitmap.
+ * @param count             Number of pixels to be skipped.
+ */
+static void ili9341_skip_coverages(ILI9341_glyph_decoder_t *p_decoder, uint32_t count);
+
+/**@brief   Renders the pixels of the glyphs of a string that lie within a strip of rows of its text box into one of the
+ *          strip buffers of this module, which must have already been filled with the background color.
+ *
+ * @param[in] p_font    Pointer to the font of the string.
+ * @param[in] p_string  Pointer to the null terminated string.
+ * @param pen_x         Column at which the pen starts (i.e., the left side of the text box).
+ * @param baseline      Row of the baseline of the string.
+ * @param x0            Left-most column of the strip.
+ * @param x1            Right-most column of the strip.
+ * @param y0            Top-most row of the strip.
+ * @param y1            Bottom-most row of the strip.
+ * @param bpp           Bits Per Pixel (BPP) type of the pixels of the strip buffer.
+ * @param[in] p_ramp    Pointer to the color ramp, in the Bit Color Order of \p bpp , with which the pixels of the glyphs
+ *                      are drawn.
+ * @param index         Index of the strip buffer into which the ink is to be rendered.
+ */
+static void ili9341_render_glyphs(const ILI9341_font_t *p_font, const char *p_string, int32_t pen_x, int32_t baseline, int32_t x0, int32_t x1,
+                                  int32_t y0, int32_t y1, ILI9341_BPP_t bpp, const ILI9341_COLOR *p_ramp, uint8_t index);
+
+uint16_t ili9341_get_string_width(const ILI9341_font_t *p_font, const char *p_string)
+{
+    /** <b>Local \c int32_t variable width:</b> Sum of the advances and kerning adjustments of the glyphs that have been walked through so far. */
+    int32_t width = 0;
+    /** <b>Local \c ILI9341_glyph_t pointer p_glyph:</b> Points to the glyph of the character that is currently being measured. */
+    const ILI9341_glyph_t *p_glyph;
+    /** <b>Local \c uint8_t variable previous:</b> Previous character of the string that has a glyph. */
+    uint8_t previous = 0;
+    /** <b>Local \c uint8_t variable has_previous:</b> Whether a previous character of the string has a glyph (1) or not (0). */
+    uint8_t has_previous = 0;
+
+    if ((p_font == NULL) || (p_string == NULL))
+    {
+        return 0;
+    }
+
+    for (; *p_string != '\0'; p_string++)
+    {
+        p_glyph = ili9341_find_glyph(p_font, (uint8_t) *p_string);
+        if (p_glyph == NULL)
+        {
+            continue;
+        }
+        if (has_previous)
+        {
+            width += ili9341_get_kerning(p_font, previous, (uint8_t) *p_string);
+        }
+        width += p_glyph->x_advance;
+        previous = (uint8_t) *p_string;
+        has_previous = 1;
+    }
+
+    return (width < 0) ? 0 : ((width > UINT16_MAX) ? UINT16_MAX : (uint16_t) width);
+}
+
+ILI9341_Status ili9341_draw_string(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const ILI9341_font_t *p_font, const char *p_string,
+                                   ILI9341_COLOR color, ILI9341_COLOR background)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret;
+    /** <b>Local \c ILI9341_clip_rect_def_t pointer p_clip:</b> Points to the Clip Rectangle of the ILI9341 Device. */
+    const ILI9341_clip_rect_def_t *p_clip = &p_handle->clip_rect;
+    /** <b>Local \c ILI9341_BPP_t variable bpp:</b> Bits Per Pixel (BPP) type that the @ref ili9341 is currently using with the ILI9341 Device. */
+    ILI9341_BPP_t bpp = get_ili9341_bpp_type(p_handle);
+    /** <b>Local \c int32_t variables x0, y0, x1 and y1:</b> Left-most column, top-most row, right-most column and bottom-most row of the text box after being clipped to the Clip Rectangle. */
+    int32_t x0, y0, x1, y1;
+    /** <b>Local \c int32_t variable last_row:</b> Bottom-most row of the strip that is currently being rendered. */
+    int32_t last_row;
+    /** <b>Local \c uint32_t variable width:</b> Number of columns of the visible part of the text box. */
+    uint32_t width;
+    /** <b>Local \c uint32_t variable strip_rows:</b> Number of whole rows of the visible part of the text box that fit in a strip buffer. */
+    uint32_t strip_rows;
+    /** <b>Local \c uint32_t variable count:</b> Number of pixels of the strip that is currently being rendered. */
+    uint32_t count;
+    /** <b>Local \c ILI9341_COLOR pointer p_ramp:</b> Points to the color ramp from \p background up to \p color . */
+    const ILI9341_COLOR *p_ramp;
+    /** <b>Local \c uint8_t pointer p_pixel:</b> Points to the next 18 bits per pixel pixel of the strip buffer to be filled with the background color. */
+    uint8_t *p_pixel;
+    /** <b>Local \c uint8_t variable index:</b> Index of the strip buffer into which the current strip is being rendered. */
+    uint8_t index = 0;
+
+    if ((p_font == NULL) || (p_string == NULL) || ((p_font->bpp != 1) && (p_font->bpp != 2) && (p_font->bpp != 4)))
+    {
+        return ILI9341_EC_ERR;
+    }
+
+    /* Clip the text box to the Clip Rectangle and reject it, before any SPI traffic, if nothing of it is left. */
+    x0 = (x < p_clip->x0) ? p_clip->x0 : x;
+    y0 = (y < p_clip->y0) ? p_clip->y0 : y;
+    x1 = (int32_t) x + ili9341_get_string_width(p_font, p_string) - 1;
+    y1 = (int32_t) y + p_font->ascent + p_font->descent - 1;
+    x1 = (x1 > p_clip->x1) ? p_clip->x1 : x1;
+    y1 = (y1 > p_clip->y1) ? p_clip->y1 : y1;
+    if ((x0 > x1) || (y0 > y1))
+    {
+        return ILI9341_EC_NA;
+    }
+    width = (uint32_t) (x1 - x0 + 1);
+    p_ramp = ili9341_get_ramp(bpp, color, background);
+    strip_rows = ((bpp == ILI9341_BPP_16) ? ILI9341_FONTS_STRIP_PIXELS : (ILI9341_FONTS_STRIP_PIXELS * sizeof(uint16_t) / 3)) / width;
+
+    ret = ili9341_set_window(p_handle, (uint16_t) x0, (uint16_t) y0, (uint16_t) x1, (uint16_t) y1);
+    if (ret != ILI9341_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Render each strip of whole rows of the text box into the current strip buffer and queue it, while the previous strip may still be being sent from the other one. */
+    for (int32_t row = y0; row <= y1; row += (int32_t) strip_rows)
+    {
+        last_row = row + (int32_t) strip_rows - 1;
+        last_row = (last_row > y1) ? y1 : last_row;
+        count = width * (uint32_t) (last_row - row + 1);
+        while (is_strip_buffer_in_use[index] != 0);
+        if (bpp == ILI9341_BPP_16)
+        {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                strip_buffers.bpp_16[index][i] = background.bpp_16;
+            }
+        }
+        else
+        {
+            p_pixel = strip_buffers.bpp_18[index];
+            for (uint32_t i = 0; i < count; i++, p_pixel += 3)
+            {
+                p_pixel[0] = (uint8_t) (background.bpp_18 >> 16);
+                p_pixel[1] = (uint8_t) (background.bpp_18 >> 8);
+                p_pixel[2] = (uint8_t) background.bpp_18;
+            }
+        }
+        ili9341_render_glyphs(p_font, p_string, x, (int32_t) y + p_font->ascent, x0, x1, row, last_row, bpp, p_ramp, index);
+
+        ret = (bpp == ILI9341_BPP_16) ? ili9341_write_pixels_16bpp(p_handle, strip_buffers.bpp_16[index], count, &is_strip_buffer_in_use[index])
+              : ili9341_write_pixels(p_handle, strip_buffers.bpp_18[index], count * 3, &is_strip_buffer_in_use[index]);
+        if (ret != ILI9341_EC_OK)
+        {
+            return ret;
+        }
+        index ^= 1;
+    }
+
+    return ILI9341_EC_OK;
+}
+
+static void ili9341_render_glyphs(const ILI9341_font_t *p_font, const char *p_string, int32_t pen_x, int32_t baseline, int32_t x0, int32_t x1,
+                                  int32_t y0, int32_t y1, ILI9341_BPP_t bpp, const ILI9341_COLOR *p_ramp, uint8_t index)
+{
+    /** <b>Local \c ILI9341_glyph_t pointer p_glyph:</b> Points to the glyph that is currently being rendered. */
+    const ILI9341_glyph_t *p_glyph;
+    /** <b>Local \c ILI9341_glyph_decoder_t variable decoder:</b> Holds the position within the bitmap of the glyph up to which it has been decoded. */
+    ILI9341_glyph_decoder_t decoder;
+    /** <b>Local \c uint8_t variable coverage:</b> Coverage of the pixel of the glyph that is currently being rendered. */
+    uint8_t coverage;
+    /** <b>Local \c uint8_t variable step:</b> Factor by which a coverage is scaled to index the color ramp. */
+    uint8_t step = (uint8_t) ((ILI9341_FONTS_RAMP_LENGTH - 1) / ((1 << p_font->bpp) - 1));
+    /** <b>Local \c int32_t variables gx and gy:</b> Column and row of the top-left corner of the bitmap of the glyph. */
+    int32_t gx, gy;
+    /** <b>Local \c int32_t variables c0, c1, r0 and r1:</b> First and last columns and rows of the bitmap of the glyph, relative to its top-left corner, that lie within the strip. */
+    int32_t c0, c1, r0, r1;
+    /** <b>Local \c uint32_t variable offset:</b> Index, within the strip buffer, of the pixel that is currently being rendered. */
+    uint32_t offset;
+    /** <b>Local \c uint32_t variable width:</b> Number of columns of the strip. */
+    uint32_t width = (uint32_t) (x1 - x0 + 1);
+    /** <b>Local \c uint8_t variable previous:</b> Previous character of the string that has a glyph. */
+    uint8_t previous = 0;
+    /** <b>Local \c uint8_t variable has_previous:</b> Whether a previous character of the string has a glyph (1) or not (0). */
+    uint8_t has_previous = 0;
+
+    for (; *p_string != '\0'; p_string++)
+    {
+        p_glyph = ili9341_find_glyph(p_font, (uint8_t) *p_string);
+        if (p_glyph == NULL)
+        {
+            continue;
+        }
+        if (has_previous)
+        {
+            pen_x += ili9341_get_kerning(p_font, previous, (uint8_t) *p_string);
+        }
+        previous = (uint8_t) *p_string;
+        has_previous = 1;
+        gx = pen_x + p_glyph->x_offset;
+        gy = baseline + p_glyph->y_offset;
+        pen_x += p_glyph->x_advance;
+
+        /* Clip the bitmap of the glyph to the strip, which leaves nothing of it for most glyphs whenever the text box is clipped. */
+        c0 = (gx < x0) ? (x0 - gx) : 0;
+        r0 = (gy < y0) ? (y0 - gy) : 0;
+        c1 = (gx + p_glyph->width - 1 > x1) ? (x1 - gx) : (p_glyph->width - 1);
+        r1 = (gy + p_glyph->height - 1 > y1) ? (y1 - gy) : (p_glyph->height - 1);
+        if ((c0 > c1) || (r0 > r1))
+        {
+            continue;
+        }
+
+        /* Decode the bitmap of the glyph from its first pixel, skipping the ones that lie outside of the strip. */
+        decoder.p_data = &p_font->p_bitmaps[p_glyph->bitmap_offset];
+        decoder.count = p_font->is_rle ? 0 : (uint16_t) (p_glyph->width * p_glyph->height);
+        decoder.coverage = 0;
+        decoder.is_packed = 1;
+        decoder.shift = (uint8_t) (8 - p_font->bpp);
+        decoder.bpp = p_font->bpp;
+        decoder.mask = (uint8_t) ((1 << p_font->bpp) - 1);
+        ili9341_skip_coverages(&decoder, (uint32_t) r0 * p_glyph->width + (uint32_t) c0);
+        for (int32_t r = r0; r <= r1; r++)
+        {
+            offset = (uint32_t) (gy + r - y0) * width + (uint32_t) (gx + c0 - x0);
+            for (int32_t c = c0; c <= c1; c++, offset++)
+            {
+                /* The pixels without coverage keep the background color, whereas the rest take the color of the ramp that their coverage indexes. */
+                coverage = ili9341_decode_coverage(&decoder);
+                if (coverage != 0)
+                {
+                    if (bpp == ILI9341_BPP_16)
+                    {
+                        strip_buffers.bpp_16[index][offset] = p_ramp[coverage * step].bpp_16;
+                    }
+                    else
+                    {
+                        strip_buffers.bpp_18[index][offset * 3] = (uint8_t) (p_ramp[coverage * step].bpp_18 >> 16);
+                        strip_buffers.bpp_18[index][offset * 3 + 1] = (uint8_t) (p_ramp[coverage * step].bpp_18 >> 8);
+                        strip_buffers.bpp_18[index][offset * 3 + 2] = (uint8_t) p_ramp[coverage * step].bpp_18;
+                    }
+                }
+            }
+            if (r != r1)
+            {
+                ili9341_skip_coverages(&decoder, (uint32_t) (p_glyph->width - 1 - c1 + c0));
+            }
+        }
+    }
+}
+
+static const ILI9341_glyph_t *ili9341_find_glyph(const ILI9341_font_t *p_font, uint8_t character)
+{
+    /** <b>Local \c int32_t variables low and high:</b> First and last indexes of @ref ILI9341_font_t::p_characters within which the character is still being searched. */
+    int32_t low, high;
+    /** <b>Local \c int32_t variable middle:</b> Index of @ref ILI9341_font_t::p_characters that is currently being compared. */
+    int32_t middle;
+
+    if ((character < p_font->first) || (character > p_font->last))
+    {
+        return NULL;
+    }
+    if (p_font->p_characters == NULL)
+    {
+        return &p_font->p_glyphs[character - p_font->first];
+    }
+
+    low = 0;
+    high = (int32_t) p_font->glyph_count - 1;
+    while (low <= high)
+    {
+        middle = (low + high) / 2;
+        if (p_font->p_characters[middle] == character)
+        {
+            return &p_font->p_glyphs[middle];
+        }
+        if (p_font->p_characters[middle] < character)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle - 1;
+        }
+    }
+
+    return NULL;
+}
+
+static int8_t ili9341_get_kerning(const ILI9341_font_t *p_font, uint8_t left, uint8_t right)
+{
+    /** <b>Local \c int32_t variables low and high:</b> First and last indexes of @ref ILI9341_font_t::p_kerning_pairs within which the pair is still being searched. */
+    int32_t low = 0, high;
+    /** <b>Local \c int32_t variable middle:</b> Index of @ref ILI9341_font_t::p_kerning_pairs that is currently being compared. */
+    int32_t middle;
+    /** <b>Local \c uint16_t variable key:</b> Pair of characters that is being searched, with \p left in its Most Significant Byte. */
+    uint16_t key = (uint16_t) ((left << 8) | right);
+    /** <b>Local \c uint16_t variable current:</b> Pair of characters of the kerning pair that is currently being compared, with its left character in its Most Significant Byte. */
+    uint16_t current;
+
+    if (p_font->p_kerning_pairs == NULL)
+    {
+        return 0;
+    }
+
+    high = (int32_t) p_font->kerning_pair_count - 1;
+    while (low <= high)
+    {
+        middle = (low + high) / 2;
+        current = (uint16_t) ((p_font->p_kerning_pairs[middle].left << 8) | p_font->p_kerning_pairs[middle].right);
+        if (current == key)
+        {
+            return p_font->p_kerning_pairs[middle].adjustment;
+        }
+        if (current < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle - 1;
+        }
+    }
+
+    return 0;
+}
+
+static uint8_t ili9341_decode_coverage(ILI9341_glyph_decoder_t *p_decoder)
+{
+    /** <b>Local \c uint8_t variable token:</b> Token of the bitmap that is currently being read. */
+    uint8_t token;
+    /** <b>Local \c uint8_t variable coverage:</b> Coverage of the pixel. */
+    uint8_t coverage;
+
+    /* Read the next token whenever the current one is used up, which only happens with Run-Length Encoded bitmaps since a plain bitmap is a single token. */
+    if (p_decoder->count == 0)
+    {
+        token = *p_decoder->p_data++;
+        if ((token & ILI9341_FONTS_RLE_INK_FLAG) == 0)
+        {
+            p_decoder->count = (uint16_t) ((token & ILI9341_FONTS_RLE_BACKGROUND_MASK) + 1);
+            p_decoder->coverage = 0;
+            p_decoder->is_packed = 0;
+        }
+        else
+        {
+            p_decoder->count = (uint16_t) ((token & ILI9341_FONTS_RLE_COUNT_MASK) + 1);
+            p_decoder->coverage = p_decoder->mask;
+            p_decoder->is_packed = (token & ILI9341_FONTS_RLE_LITERAL_FLAG) != 0;
+            p_decoder->shift = (uint8_t) (8 - p_decoder->bpp);
+        }
+    }
+    p_decoder->count--;
+    if (!p_decoder->is_packed)
+    {
+        return p_decoder->coverage;
+    }
+
+    /* The next token starts at the byte that follows the last one that holds any coverage of the current token. */
+    coverage = (uint8_t) ((*p_decoder->p_data >> p_decoder->shift) & p_decoder->mask);
+    if ((p_decoder->shift == 0) || (p_decoder->count == 0))
+    {
+        p_decoder->p_data++;
+        p_decoder->shift = (uint8_t) (8 - p_decoder->bpp);
+    }
+    else
+    {
+        p_decoder->shift = (uint8_t) (p_decoder->shift - p_decoder->bpp);
+    }
+
+    return coverage;
+}
+
+static void ili9341_skip_coverages(ILI9341_glyph_decoder_t *p_decoder, uint32_t count)
+{
+    while (count != 0)
+    {
+        if ((p_decoder->count != 0) && !p_decoder->is_packed)
+        {
+            if (p_decoder->count > count)
+            {
+                p_decoder->count = (uint16_t) (p_decoder->count - count);
+                return;
+            }
+            count -= p_decoder->count;
+            p_decoder->count = 0;
+            continue;
+        }
+        ili9341_decode_coverage(p_decoder);
+        count--;
+    }
+}
+
+static const ILI9341_COLOR *ili9341_get_ramp(ILI9341_BPP_t bpp, ILI9341_COLOR color, ILI9341_COLOR background)
+{
+    /** <b>Local \c ILI9341_ramp_def_t pointer p_entry:</b> Points to the entry of @ref ramp_cache that is currently being checked or computed. */
+    ILI9341_ramp_def_t *p_entry;
+    /** <b>Local \c uint32_t variables fg and bg:</b> Colors of the ink and of the background, each of whose channels is at bits 16, 8 and 0 up to the number of bits of that channel. */
+    uint32_t fg, bg;
+    /** <b>Local \c uint32_t variables red, green and blue:</b> Channels of the color of the ramp that is currently being computed. */
+    uint32_t red, green, blue;
+
+    /* Only the bits of the colors that belong to the Bits Per Pixel (BPP) type are compared, since the rest of the union may hold anything. */
+    for (uint8_t i = 0; i < ramp_count; i++)
+    {
+        p_entry = &ramp_cache[i];
+        if ((p_entry->bpp == bpp) && ((bpp == ILI9341_BPP_16) ? ((p_entry->color.bpp_16 == color.bpp_16) && (p_entry->background.bpp_16 == background.bpp_16))
+                                      : ((p_entry->color.bpp_18 == color.bpp_18) && (p_entry->background.bpp_18 == background.bpp_18))))
+        {
+            return p_entry->ramp;
+        }
+    }
+
+    p_entry = &ramp_cache[next_ramp];
+    next_ramp = (uint8_t) ((next_ramp + 1) % ILI9341_FONTS_RAMP_CACHE_SIZE);
+    ramp_count = (ramp_count < ILI9341_FONTS_RAMP_CACHE_SIZE) ? (uint8_t) (ramp_count + 1) : ramp_count;
+    p_entry->color = color;
+    p_entry->background = background;
+    p_entry->bpp = bpp;
+    if (bpp == ILI9341_BPP_16)
+    {
+        fg = ((uint32_t) (color.bpp_16 >> 11) << 16) | ((uint32_t) ((color.bpp_16 >> 5) & 0x3F) << 8) | (color.bpp_16 & 0x1F);
+        bg = ((uint32_t) (background.bpp_16 >> 11) << 16) | ((uint32_t) ((background.bpp_16 >> 5) & 0x3F) << 8) | (background.bpp_16 & 0x1F);
+    }
+    else
+    {
+        fg = (color.bpp_18 >> 2) & 0x3F3F3F;
+        bg = (background.bpp_18 >> 2) & 0x3F3F3F;
+    }
+
+    /* Interpolate each channel, rounded to the nearest value, so that the first and last colors are exactly the background and the ink. */
+    for (uint8_t i = 0; i < ILI9341_FONTS_RAMP_LENGTH; i++)
+    {
+        red = (((bg >> 16) & 0xFF) * (ILI9341_FONTS_RAMP_LENGTH - 1 - i) + ((fg >> 16) & 0xFF) * i + (ILI9341_FONTS_RAMP_LENGTH - 1) / 2) / (ILI9341_FONTS_RAMP_LENGTH - 1);
+        green = (((bg >> 8) & 0xFF) * (ILI9341_FONTS_RAMP_LENGTH - 1 - i) + ((fg >> 8) & 0xFF) * i + (ILI9341_FONTS_RAMP_LENGTH - 1) / 2) / (ILI9341_FONTS_RAMP_LENGTH - 1);
+        blue = ((bg & 0xFF) * (ILI9341_FONTS_RAMP_LENGTH - 1 - i) + (fg & 0xFF) * i + (ILI9341_FONTS_RAMP_LENGTH - 1) / 2) / (ILI9341_FONTS_RAMP_LENGTH - 1);
+        if (bpp == ILI9341_BPP_16)
+        {
+            p_entry->ramp[i].bpp_16 = (uint16_t) ((red << 11) | (green << 5) | blue);
+        }
+        else
+        {
+            p_entry->ramp[i].bpp_18 = (red << 18) | (green << 10) | (blue << 2);
+        }
+    }
+
+    return p_entry->ramp;
+}
+
+/** @} */
@@ -0,0 +1,1048 @@
+/** @addtogroup ili9341_graphics
+ * @{
+ */
+
+#include "ili9341_graphics.h"
+
+#define ILI9341_GRAPHICS_FIXED_POINT_SHIFT      (16)                                            /**< @brief Number of fractional bits of the fixed point columns with which the edges of a polygon are walked. */
+#define ILI9341_GRAPHICS_FIXED_POINT_HALF       (1L << (ILI9341_GRAPHICS_FIXED_POINT_SHIFT - 1))  /**< @brief Half a pixel in the fixed point format given by @ref ILI9341_GRAPHICS_FIXED_POINT_SHIFT . */
+
+/**@brief	ILI9341 Graphics Polygon Edge parameters structure.
+ *
+ * @details This contains all the fields required to walk a single non-horizontal edge of a polygon, one row at a time,
+ *          from its top row down to its bottom row.
+ */
+typedef struct
+{
+    int64_t x;              //!< Column, in fixed point (see @ref ILI9341_GRAPHICS_FIXED_POINT_SHIFT ), at which the edge crosses the center of the row that is currently being filled.
+    int64_t x_step;         //!< Fixed point columns that @ref x advances per row.
+    int16_t x_top;          //!< Column of the top-most end of the edge.
+    int16_t y_top;          //!< First row whose center is crossed by the edge (i.e., the row of its top-most end).
+    int16_t y_bottom;       //!< Row right after the last row whose center is crossed by the edge (i.e., the row of its bottom-most end).
+    int8_t winding;         //!< Direction of the edge, which is 1 if it goes down and -1 if it goes up, as given by the order of the vertices of the polygon.
+} ILI9341_edge_def_t;
+
+/**@brief	ILI9341 Graphics Quadrant Profile parameters structure.
+ *
+ * @details This contains the terms with which the half width of each row of one quadrant of a circle or of an ellipse
+ *          is evaluated with the midpoint criterion, which tells that the pixel that lies \c dx columns and \c dy rows
+ *          away from the center of an ellipse of radii \c rx and \c ry is inside of it whenever
+ *          <tt>4·dx²·(2·ry+1)² + 4·dy²·(2·rx+1)² <= (2·rx+1)²·(2·ry+1)²</tt> (i.e., whenever its center lies inside of
+ *          the ellipse whose radii are half a pixel longer).
+ */
+typedef struct
+{
+    int64_t term_x;         //!< Squared horizontal diameter of the ellipse plus one (i.e., <tt>(2·rx+1)²</tt>).
+    int64_t term_y;         //!< Squared vertical diameter of the ellipse plus one (i.e., <tt>(2·ry+1)²</tt>).
+    int64_t threshold;      //!< Product of @ref term_x and @ref term_y .
+    int32_t radius_x;       //!< Horizontal radius of the ellipse, which is the half width of its middle row.
+    int32_t radius_y;       //!< Vertical radius of the ellipse, which is the number of rows of a quadrant minus one.
+} ILI9341_profile_def_t;
+
+/**@brief	ILI9341 Graphics Rounded Shape parameters structure.
+ *
+ * @details This contains the state that is shared by all the runs of a circle, ellipse, arc or rounded rectangle
+ *          while it is being drawn, including the angles within which an arc is to be kept.
+ */
+typedef struct
+{
+    ILI9341_handle_t *p_handle;     //!< Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+    ILI9341_COLOR color;            //!< Color of the shape.
+    ILI9341_Status ret;             //!< Return value of the whole shape (see @ref ili9341_merge_status ).
+    uint8_t is_stopped;             //!< Whether an error stopped drawing the shape (1) or not (0).
+    uint8_t is_sector;              //!< Whether only the pixels within the angles of an arc are to be drawn (1) or not (0).
+    uint8_t is_reflex;              //!< Whether the angles of the arc sweep more than 180 degrees (1) or not (0).
+    int32_t center_x;               //!< Column of the center of the arc.
+    int32_t center_y;               //!< Row of the center of the arc.
+    int32_t start_x;                //!< Cosine of the angle at which the arc starts, in Q15 fixed point.
+    int32_t start_y;                //!< Sine of the angle at which the arc starts, in Q15 fixed point.
+    int32_t end_x;                  //!< Cosine of the angle at which the arc ends, in Q15 fixed point.
+    int32_t end_y;                  //!< Sine of the angle at which the arc ends, in Q15 fixed point.
+} ILI9341_shape_def_t;
+
+/**@brief   Sines of the angles from 0 up to 90 degrees, in Q15 fixed point, with which the angles of the arcs are
+ *          evaluated.
+ */
+static const int16_t sine_table[91] =
+{
+    0, 572, 1144, 1715, 2286, 2856, 3425, 3993, 4560, 5126,
+    5690, 6252, 6813, 7371, 7927, 8481, 9032, 9580, 10126, 10668,
+    11207, 11743, 12275, 12803, 13328, 13848, 14364, 14876, 15383, 15886,
+    16383, 16876, 17364, 17846, 18323, 18794, 19260, 19720, 20173, 20621,
+    21062, 21497, 21925, 22347, 22762, 23170, 23571, 23964, 24351, 24730,
+    25101, 25465, 25821, 26169, 26509, 26841, 27165, 27481, 27788, 28087,
+    28377, 28659, 28932, 29196, 29451, 29697, 29934, 30162, 30381, 30591,
+    30791, 30982, 31163, 31335, 31498, 31650, 31794, 31927, 32051, 32165,
+    32269, 32364, 32448, 32523, 32587, 32642, 32687, 32722, 32747, 32762,
+    32767
+};
+
+/**@brief   Merges the @ref ILI9341_Status value of drawing one of the parts of a shape into the @ref ILI9341_Status
+ *          value of the whole shape.
+ *
+ * @details A shape is reported as drawn (i.e., @ref ILI9341_EC_OK ) as soon as one of its parts was drawn, while
+ *          its parts that lie outside of the screen (i.e., @ref ILI9341_EC_NA ) are ignored.
+ *
+ * @param[in,out] p_ret Pointer to the @ref ILI9341_Status value of the whole shape, which must start as
+ *                      @ref ILI9341_EC_NA .
+ * @param status        @ref ILI9341_Status value of drawing one of the parts of the shape.
+ *
+ * @retval  1 if \p status is an error, in which case it is also written into \p p_ret and the shape must no longer be
+ *          drawn.
+ * @retval  0 otherwise.
+ */
+static uint8_t ili9341_merge_status(ILI9341_Status *p_ret, ILI9341_Status status);
+
+/**@brief   Draws a horizontal or vertical run of pixels of the same color, clipped to the screen.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param is_vertical   Whether the run is vertical (1) or horizontal (0).
+ * @param fixed         Row of a horizontal run or column of a vertical run.
+ * @param start         Column of the first pixel of a horizontal run or row of the first pixel of a vertical run.
+ * @param end           Column of the last pixel of a horizontal run or row of the last pixel of a vertical run, which
+ *                      may be lower than \p start .
+ * @param color         Color of the run.
+ *
+ * @retval  ILI9341_EC_OK if drawing the run was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested run lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+static ILI9341_Status ili9341_draw_run(ILI9341_handle_t *p_handle, uint8_t is_vertical, int32_t fixed, int32_t start, int32_t end, ILI9341_COLOR color);
+
+/**@brief   Draws a straight line between two points by coalescing its consecutive pixels into runs.
+ *
+ * @param[in] p_handle              Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x0                        Column of the first end of the line.
+ * @param y0                        Row of the first end of the line.
+ * @param x1                        Column of the second end of the line.
+ * @param y1                        Row of the second end of the line.
+ * @param color                     Color of the line.
+ * @param is_first_pixel_skipped    Whether the pixel at the first end of the line is not to be drawn (1) or not (0),
+ *                                  which is used to avoid drawing twice the pixels that are shared by connected lines.
+ *
+ * @retval  ILI9341_EC_OK if drawing the line was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the requested line lies within the screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+static ILI9341_Status ili9341_draw_line_runs(ILI9341_handle_t *p_handle, int32_t x0, int32_t y0, int32_t x1, int32_t y1, ILI9341_COLOR color,
+                                             uint8_t is_first_pixel_skipped);
+
+/**@brief   Draws the horizontal run of pixels whose centers lie between two fixed point columns of a row of a polygon.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param y             Row of the run.
+ * @param x_start       Fixed point column (see @ref ILI9341_GRAPHICS_FIXED_POINT_SHIFT ) at which the run starts.
+ * @param x_end         Fixed point column at which the run ends, which must not be lower than \p x_start .
+ * @param color         Color of the run.
+ *
+ * @retval  ILI9341_EC_OK if drawing the run was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel center lies between \p x_start and \p x_end or if none of them lies within the
+ *          screen.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+static ILI9341_Status ili9341_draw_span(ILI9341_handle_t *p_handle, int32_t y, int64_t x_start, int64_t x_end, ILI9341_COLOR color);
+
+/**@brief   Initializes the Quadrant Profile of an ellipse.
+ *
+ * @param[out] p_profile    Pointer to the Quadrant Profile to be initialized.
+ * @param radius_x          Horizontal radius of the ellipse.
+ * @param radius_y          Vertical radius of the ellipse.
+ */
+static void ili9341_init_profile(ILI9341_profile_def_t *p_profile, int32_t radius_x, int32_t radius_y);
+
+/**@brief   Gets the half width of a row of a Quadrant Profile.
+ *
+ * @details Since the half widths of the rows of a quadrant never grow while walking away from its middle row, each
+ *          half width is searched downwards from the one of the previous row, so that walking a whole quadrant costs a
+ *          number of evaluations that is proportional to its perimeter.
+ *
+ * @param[in] p_profile Pointer to the Quadrant Profile.
+ * @param dy            Distance of the row from the middle row of the ellipse.
+ * @param x             Half width of the previous row, from which the search starts.
+ *
+ * @return  The distance from the center column of the ellipse to the last pixel of the requested row that lies inside of
+ *          it, or -1 if no pixel of that row does.
+ */
+static int32_t ili9341_get_half_width(const ILI9341_profile_def_t *p_profile, int32_t dy, int32_t x);
+
+/**@brief   Gets the sine of an angle.
+ *
+ * @param angle Angle in degrees, which may lie outside of the range of 0 up to 359 degrees.
+ *
+ * @return  The sine of \p angle in Q15 fixed point.
+ */
+static int32_t ili9341_get_sine(int32_t angle);
+
+/**@brief   Initializes the state with which a rounded shape is to be drawn.
+ *
+ * @param[out] p_shape  Pointer to the state to be initialized.
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param color         Color of the shape.
+ */
+static void ili9341_init_shape(ILI9341_shape_def_t *p_shape, ILI9341_handle_t *p_handle, ILI9341_COLOR color);
+
+/**@brief   Restricts a rounded shape to the pixels that lie within the angles of an arc.
+ *
+ * @param[in,out] p_shape   Pointer to the state of the shape.
+ * @param xc                Column of the center of the arc.
+ * @param yc                Row of the center of the arc.
+ * @param start_angle       Angle, in degrees, at which the arc starts.
+ * @param end_angle         Angle, in degrees, at which the arc ends.
+ *
+ * @retval  1 if there is something to be drawn within the requested angles.
+ * @retval  0 if \p end_angle is not greater than \p start_angle .
+ */
+static uint8_t ili9341_set_shape_sector(ILI9341_shape_def_t *p_shape, int32_t xc, int32_t yc, int32_t start_angle, int32_t end_angle);
+
+/**@brief   Tells whether a pixel lies within the angles of the arc of a rounded shape.
+ *
+ * @param[in] p_shape   Pointer to the state of the shape.
+ * @param x             Column of the pixel.
+ * @param y             Row of the pixel.
+ *
+ * @retval  1 if the center of the pixel lies within the angles of the arc, including its start and end angles.
+ * @retval  0 otherwise.
+ */
+static uint8_t ili9341_is_in_sector(const ILI9341_shape_def_t *p_shape, int32_t x, int32_t y);
+
+/**@brief   Draws a horizontal or vertical run of pixels of a rounded shape.
+ *
+ * @details The run is drawn as with @ref ili9341_draw_run , except that, if the shape is restricted to the angles of an
+ *          arc, it is first clipped to the screen and then split into the runs that lie within those angles.
+ *
+ * @param[in,out] p_shape   Pointer to the state of the shape.
+ * @param is_vertical       Whether the run is vertical (1) or horizontal (0).
+ * @param fixed             Row of a horizontal run or column of a vertical run.
+ * @param start             Column of the first pixel of a horizontal run or row of the first pixel of a vertical run.
+ * @param end               Column of the last pixel of a horizontal run or row of the last pixel of a vertical run,
+ *                          which must not be lower than \p start .
+ */
+static void ili9341_draw_shape_run(ILI9341_shape_def_t *p_shape, uint8_t is_vertical, int32_t fixed, int32_t start, int32_t end);
+
+/**@brief   Fills a rectangle of a rounded shape, clipped to the screen.
+ *
+ * @param[in,out] p_shape   Pointer to the state of the shape, which must not be restricted to the angles of an arc.
+ * @param x0                Column of the left side of the rectangle.
+ * @param y0                Row of the top side of the rectangle.
+ * @param x1                Column of the right side of the rectangle, which must not be lower than \p x0 .
+ * @param y1                Row of the bottom side of the rectangle, which must not be lower than \p y0 .
+ */
+static void ili9341_fill_shape_rect(ILI9341_shape_def_t *p_shape, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+
+/**@brief   Draws the runs of a rounded shape that lie at a given distance from its middle rows.
+ *
+ * @details A rounded shape is made of a Quadrant Profile whose top-left, top-right, bottom-left and bottom-right
+ *          quadrants are centered at (\p left , \p top ), (\p right , \p top ), (\p left , \p bottom ) and
+ *          (\p right , \p bottom ) respectively, where the 4 of them are the center of a circle or of an ellipse and
+ *          the corners of a rounded rectangle. The runs of the mirrored quadrants are merged whenever they touch, which
+ *          is also how the sides of a rounded rectangle are drawn.
+ *
+ * @param[in,out] p_shape   Pointer to the state of the shape.
+ * @param is_vertical       Whether the runs are vertical (1) or horizontal (0).
+ * @param distance          Number of columns (for vertical runs) or rows (for horizontal runs) between the runs and the
+ *                          center of their quadrant.
+ * @param low               Lowest distance, along the runs, between the runs and the center of their quadrant.
+ * @param high              Highest distance, along the runs, between the runs and the center of their quadrant.
+ * @param left              Column of the center of the left quadrants.
+ * @param top               Row of the center of the top quadrants.
+ * @param right             Column of the center of the right quadrants, which must not be lower than \p left .
+ * @param bottom            Row of the center of the bottom quadrants, which must not be lower than \p top .
+ */
+static void ili9341_draw_mirrored_runs(ILI9341_shape_def_t *p_shape, uint8_t is_vertical, int32_t distance, int32_t low, int32_t high, int32_t left,
+                                       int32_t top, int32_t right, int32_t bottom);
+
+/**@brief   Draws the outline of a rounded shape.
+ *
+ * @details For each row of the Quadrant Profile, the pixels of the outline are the ones that lie inside of the shape
+ *          while the pixels of the next row (i.e., away from the middle rows) that share their columns do not. Those
+ *          pixels are drawn as a single horizontal run, except for the rows that have a single pixel of the outline
+ *          at the same column as the previous row, which are merged into vertical runs instead.
+ *
+ * @param[in,out] p_shape   Pointer to the state of the shape.
+ * @param[in] p_profile     Pointer to the Quadrant Profile of the shape.
+ * @param left              Column of the center of the left quadrants.
+ * @param top               Row of the center of the top quadrants.
+ * @param right             Column of the center of the right quadrants, which must not be lower than \p left .
+ * @param bottom            Row of the center of the bottom quadrants, which must not be lower than \p top .
+ */
+static void ili9341_draw_profile(ILI9341_shape_def_t *p_shape, const ILI9341_profile_def_t *p_profile, int32_t left, int32_t top, int32_t right,
+                                 int32_t bottom);
+
+/**@brief   Fills a rounded shape.
+ *
+ * @details The consecutive rows of the Quadrant Profile that have the same half width are filled as a single
+ *          rectangle, where the rows around the middle rows of the shape are merged with the rows in between its top and
+ *          bottom quadrants.
+ *
+ * @param[in,out] p_shape   Pointer to the state of the shape, which must not be restricted to the angles of an arc.
+ * @param[in] p_profile     Pointer to the Quadrant Profile of the shape.
+ * @param left              Column of the center of the left quadrants.
+ * @param top               Row of the center of the top quadrants.
+ * @param right             Column of the center of the right quadrants, which must not be lower than \p left .
+ * @param bottom            Row of the center of the bottom quadrants, which must not be lower than \p top .
+ */
+static void ili9341_fill_profile(ILI9341_shape_def_t *p_shape, const ILI9341_profile_def_t *p_profile, int32_t left, int32_t top, int32_t right,
+                                 int32_t bottom);
+
+ILI9341_Status ili9341_draw_line(ILI9341_handle_t *p_handle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, ILI9341_COLOR color)
+{
+    return ili9341_draw_line_runs(p_handle, x0, y0, x1, y1, color, 0);
+}
+
+ILI9341_Status ili9341_draw_polyline(ILI9341_handle_t *p_handle, const ILI9341_point_t *p_points, uint16_t point_count, ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of the whole polyline. */
+    ILI9341_Status ret = ILI9341_EC_NA;
+
+    if ((p_points == NULL) || (point_count == 0))
+    {
+        return ILI9341_EC_ERR;
+    }
+    if (point_count == 1)
+    {
+        return ili9341_draw_pixel(p_handle, p_points[0].x, p_points[0].y, color);
+    }
+
+    /* Draw each line, where all of them except the first one skip the pixel that they share with the previous line. */
+    for (uint16_t i = 1; i < point_count; i++)
+    {
+        if (ili9341_merge_status(&ret, ili9341_draw_line_runs(p_handle, p_points[i - 1].x, p_points[i - 1].y, p_points[i].x, p_points[i].y,
+                                                              color, (i != 1))))
+        {
+            break;
+        }
+    }
+
+    return ret;
+}
+
+ILI9341_Status ili9341_fill_polygon(ILI9341_handle_t *p_handle, const ILI9341_point_t *p_points, uint8_t point_count, ILI9341_FILL_RULE_t fill_rule,
+                                    ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of the whole polygon. */
+    ILI9341_Status ret = ILI9341_EC_NA;
+    /** <b>Local \c ILI9341_edge_def_t array edges:</b> Edge Table of the polygon, sorted by the top row of its edges. */
+    ILI9341_edge_def_t edges[ILI9341_GRAPHICS_MAX_POLYGON_VERTICES];
+    /** <b>Local \c uint8_t array active_edges:</b> Active Edge Table of the polygon, which holds the indexes in \c edges of the edges that cross the current row, sorted by the column at which they cross it. */
+    uint8_t active_edges[ILI9341_GRAPHICS_MAX_POLYGON_VERTICES];
+    /** <b>Local \c uint8_t variable edge_count:</b> Number of edges in \c edges . */
+    uint8_t edge_count = 0;
+    /** <b>Local \c uint8_t variable active_count:</b> Number of edges in \c active_edges . */
+    uint8_t active_count = 0;
+    /** <b>Local \c uint8_t variable next_edge:</b> Index in \c edges of the next edge to be added into \c active_edges . */
+    uint8_t next_edge = 0;
+    /** <b>Local \c ILI9341_edge_def_t variable edge:</b> Edge that is currently being built or sorted. */
+    ILI9341_edge_def_t edge;
+    /** <b>Local \c int32_t variable y:</b> Row of the polygon that is currently being filled. */
+    int32_t y;
+    /** <b>Local \c int32_t variable y_end:</b> Row right after the last row of the polygon that lies within the screen. */
+    int32_t y_end = 0;
+    /** <b>Local \c int32_t variable winding:</b> Sum of the directions of the active edges that lie to the left of the current column. */
+    int32_t winding;
+    /** <b>Local \c int32_t variable previous_winding:</b> Value that \c winding had before crossing the current active edge. */
+    int32_t previous_winding;
+    /** <b>Local \c int64_t variable x_start:</b> Fixed point column at which the span that is currently being built starts. */
+    int64_t x_start = 0;
+    /** <b>Local \c int64_t variable span_start:</b> Fixed point column at which the span that is pending to be drawn starts. */
+    int64_t span_start = 0;
+    /** <b>Local \c int64_t variable span_end:</b> Fixed point column at which the span that is pending to be drawn ends. */
+    int64_t span_end = 0;
+    /** <b>Local \c uint8_t variable is_span_pending:</b> Whether there is a span of the current row pending to be drawn (1) or not (0), which is held back in case that the next span touches it. */
+    uint8_t is_span_pending;
+    /** <b>Local \c uint8_t variable a:</b> Index of the first point of the edge that is currently being built. */
+    uint8_t a;
+    /** <b>Local \c uint8_t variable b:</b> Index of the second point of the edge that is currently being built, or of the edge that is currently being inserted into a table. */
+    uint8_t b;
+    /** <b>Local \c uint8_t variable c:</b> Position of the Active Edge Table into which an edge is currently being inserted. */
+    uint8_t c;
+
+    if ((p_points == NULL) || (point_count < 3) || (point_count > ILI9341_GRAPHICS_MAX_POLYGON_VERTICES)
+        || ((fill_rule != ILI9341_FILL_RULE_EVEN_ODD) && (fill_rule != ILI9341_FILL_RULE_NON_ZERO)))
+    {
+        return ILI9341_EC_ERR;
+    }
+
+    /* Build the Edge Table out of the non-horizontal edges of the polygon, sorted by their top row (i.e., via insertion sort, since polygons have few edges). */
+    for (a = 0; a < point_count; a++)
+    {
+        b = (uint8_t) ((a + 1) % point_count);
+        if (p_points[a].y == p_points[b].y)
+        {
+            continue; // Horizontal edges are already covered by the rows of their neighbouring edges.
+        }
+        edge.winding = (p_points[a].y < p_points[b].y) ? 1 : -1;
+        if (edge.winding > 0)
+        {
+            edge.x_top = p_points[a].x;
+            edge.y_top = p_points[a].y;
+            edge.y_bottom = p_points[b].y;
+            edge.x_step = ((int64_t) (p_points[b].x - p_points[a].x) * ((int64_t) 1 << ILI9341_GRAPHICS_FIXED_POINT_SHIFT)) / (p_points[b].y - p_points[a].y);
+        }
+        else
+        {
+            edge.x_top = p_points[b].x;
+            edge.y_top = p_points[b].y;
+            edge.y_bottom = p_points[a].y;
+            edge.x_step = ((int64_t) (p_points[a].x - p_points[b].x) * ((int64_t) 1 << ILI9341_GRAPHICS_FIXED_POINT_SHIFT)) / (p_points[a].y - p_points[b].y);
+        }
+        y_end = ((edge_count == 0) || (edge.y_bottom > y_end)) ? edge.y_bottom : y_end;
+        for (b = edge_count; (b > 0) && (edges[b - 1].y_top > edge.y_top); b--)
+        {
+            edges[b] = edges[b - 1];
+        }
+        edges[b] = edge;
+        edge_count++;
+    }
+    if (edge_count == 0)
+    {
+        return ILI9341_EC_NA; // All the vertices of the polygon lie in a single row, so it has no inside.
+    }
+
+    /* Fill the rows of the polygon that lie within the screen. */
+    y = (edges[0].y_top < 0) ? 0 : edges[0].y_top;
+    y_end = (y_end > ILI9341_SCREEN_HEIGHT) ? ILI9341_SCREEN_HEIGHT : y_end;
+    for (; y < y_end; y++)
+    {
+        /* Remove the edges that no longer cross the current row from the Active Edge Table. */
+        for (a = 0, b = 0; a < active_count; a++)
+        {
+            if (edges[active_edges[a]].y_bottom > y)
+            {
+                active_edges[b++] = active_edges[a];
+            }
+        }
+        active_count = b;
+
+        /* Add the edges that start crossing the current row into the Active Edge Table, starting them at the center of the current row. */
+        for (; (next_edge < edge_count) && (edges[next_edge].y_top <= y); next_edge++)
+        {
+            if (edges[next_edge].y_bottom > y)
+            {
+                edges[next_edge].x = ((int64_t) edges[next_edge].x_top * ((int64_t) 1 << ILI9341_GRAPHICS_FIXED_POINT_SHIFT))
+                                     + (edges[next_edge].x_step * (2 * (y - edges[next_edge].y_top) + 1)) / 2;
+                active_edges[active_count++] = next_edge;
+            }
+        }
+
+        /* Sort the Active Edge Table by the column at which its edges cross the current row (i.e., via insertion sort, since it is nearly sorted from the previous row). */
+        for (a = 1; a < active_count; a++)
+        {
+            b = active_edges[a];
+            for (c = a; (c > 0) && (edges[active_edges[c - 1]].x > edges[b].x); c--)
+            {
+                active_edges[c] = active_edges[c - 1];
+            }
+            active_edges[c] = b;
+        }
+
+        /* Draw the spans of the current row that lie inside of the polygon according to the requested Fill Rule, where the spans that touch each other are merged into a single one. */
+        winding = 0;
+        is_span_pending = 0;
+        for (a = 0; a < active_count; a++)
+        {
+            previous_winding = winding;
+            winding = (fill_rule == ILI9341_FILL_RULE_EVEN_ODD) ? (winding ^ 1) : (winding + edges[active_edges[a]].winding);
+            if ((previous_winding == 0) && (winding != 0))
+            {
+                x_start = edges[active_edges[a]].x;
+            }
+            else if ((previous_winding != 0) && (winding == 0))
+            {
+                if (is_span_pending && (x_start <= span_end))
+                {
+                    span_end = edges[active_edges[a]].x;
+                    continue;
+                }
+                if (is_span_pending && ili9341_merge_status(&ret, ili9341_draw_span(p_handle, y, span_start, span_end, color)))
+                {
+                    return ret;
+                }
+                span_start = x_start;
+                span_end = edges[active_edges[a]].x;
+                is_span_pending = 1;
+            }
+        }
+        if (is_span_pending && ili9341_merge_status(&ret, ili9341_draw_span(p_handle, y, span_start, span_end, color)))
+        {
+            return ret;
+        }
+
+        /* Advance the active edges towards the center of the next row. */
+        for (a = 0; a < active_count; a++)
+        {
+            edges[active_edges[a]].x += edges[active_edges[a]].x_step;
+        }
+    }
+
+    return ret;
+}
+
+ILI9341_Status ili9341_fill_triangle(ILI9341_handle_t *p_handle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                     ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_point_t array points:</b> Vertices of the requested triangle. */
+    ILI9341_point_t points[3] = {{x0, y0}, {x1, y1}, {x2, y2}};
+
+    return ili9341_fill_polygon(p_handle, points, 3, ILI9341_FILL_RULE_EVEN_ODD, color);
+}
+
+ILI9341_Status ili9341_draw_circle(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius, ILI9341_COLOR color)
+{
+    return ili9341_draw_ellipse(p_handle, xc, yc, radius, radius, color);
+}
+
+ILI9341_Status ili9341_fill_circle(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius, ILI9341_COLOR color)
+{
+    return ili9341_fill_ellipse(p_handle, xc, yc, radius, radius, color);
+}
+
+ILI9341_Status ili9341_draw_ellipse(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius_x, uint16_t radius_y, ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_shape_def_t variable shape:</b> State with which the ellipse is drawn. */
+    ILI9341_shape_def_t shape;
+    /** <b>Local \c ILI9341_profile_def_t variable profile:</b> Quadrant Profile of the ellipse. */
+    ILI9341_profile_def_t profile;
+
+    if ((radius_x > ILI9341_GRAPHICS_MAX_RADIUS) || (radius_y > ILI9341_GRAPHICS_MAX_RADIUS))
+    {
+        return ILI9341_EC_ERR;
+    }
+    ili9341_init_shape(&shape, p_handle, color);
+    ili9341_init_profile(&profile, radius_x, radius_y);
+    ili9341_draw_profile(&shape, &profile, xc, yc, xc, yc);
+
+    return shape.ret;
+}
+
+ILI9341_Status ili9341_fill_ellipse(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius_x, uint16_t radius_y, ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_shape_def_t variable shape:</b> State with which the ellipse is filled. */
+    ILI9341_shape_def_t shape;
+    /** <b>Local \c ILI9341_profile_def_t variable profile:</b> Quadrant Profile of the ellipse. */
+    ILI9341_profile_def_t profile;
+
+    if ((radius_x > ILI9341_GRAPHICS_MAX_RADIUS) || (radius_y > ILI9341_GRAPHICS_MAX_RADIUS))
+    {
+        return ILI9341_EC_ERR;
+    }
+    ili9341_init_shape(&shape, p_handle, color);
+    ili9341_init_profile(&profile, radius_x, radius_y);
+    ili9341_fill_profile(&shape, &profile, xc, yc, xc, yc);
+
+    return shape.ret;
+}
+
+ILI9341_Status ili9341_draw_arc(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t radius, int16_t start_angle, int16_t end_angle,
+                                ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_shape_def_t variable shape:</b> State with which the arc is drawn. */
+    ILI9341_shape_def_t shape;
+    /** <b>Local \c ILI9341_profile_def_t variable profile:</b> Quadrant Profile of the circle of the arc. */
+    ILI9341_profile_def_t profile;
+
+    if (radius > ILI9341_GRAPHICS_MAX_RADIUS)
+    {
+        return ILI9341_EC_ERR;
+    }
+    ili9341_init_shape(&shape, p_handle, color);
+    if (!ili9341_set_shape_sector(&shape, xc, yc, start_angle, end_angle))
+    {
+        return ILI9341_EC_NA;
+    }
+    ili9341_init_profile(&profile, radius, radius);
+    ili9341_draw_profile(&shape, &profile, xc, yc, xc, yc);
+
+    return shape.ret;
+}
+
+ILI9341_Status ili9341_fill_arc(ILI9341_handle_t *p_handle, int16_t xc, int16_t yc, uint16_t inner_radius, uint16_t outer_radius, int16_t start_angle,
+                                int16_t end_angle, ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_shape_def_t variable shape:</b> State with which the sector is filled. */
+    ILI9341_shape_def_t shape;
+    /** <b>Local \c ILI9341_profile_def_t variable outer_profile:</b> Quadrant Profile of the outer circle of the ring. */
+    ILI9341_profile_def_t outer_profile;
+    /** <b>Local \c ILI9341_profile_def_t variable inner_profile:</b> Quadrant Profile of the hole of the ring. */
+    ILI9341_profile_def_t inner_profile;
+    /** <b>Local \c int32_t variable outer_half_width:</b> Half width of the current row of the outer circle of the ring. */
+    int32_t outer_half_width = outer_radius;
+    /** <b>Local \c int32_t variable inner_half_width:</b> Half width of the current row of the hole of the ring, which is -1 for the rows that the hole does not reach. */
+    int32_t inner_half_width = (inner_radius > 0) ? inner_radius : -1;
+
+    if ((outer_radius > ILI9341_GRAPHICS_MAX_RADIUS) || (inner_radius >= outer_radius))
+    {
+        return ILI9341_EC_ERR;
+    }
+    ili9341_init_shape(&shape, p_handle, color);
+    if (!ili9341_set_shape_sector(&shape, xc, yc, start_angle, end_angle))
+    {
+        return ILI9341_EC_NA;
+    }
+    ili9341_init_profile(&outer_profile, outer_radius, outer_radius);
+    if (!shape.is_sector && (inner_radius == 0))
+    {
+        ili9341_fill_profile(&shape, &outer_profile, xc, yc, xc, yc); // A whole disc is filled faster as a circle.
+        return shape.ret;
+    }
+    ili9341_init_profile(&inner_profile, inner_radius, inner_radius);
+
+    /* Fill each row of the ring with the runs that lie between its hole and its outer circle, if any. */
+    for (int32_t dy = 0; (dy <= outer_radius) && !shape.is_stopped; dy++)
+    {
+        outer_half_width = ili9341_get_half_width(&outer_profile, dy, outer_half_width);
+        inner_half_width = ili9341_get_half_width(&inner_profile, dy, inner_half_width);
+        ili9341_draw_mirrored_runs(&shape, 0, dy, inner_half_width + 1, outer_half_width, xc, yc, xc, yc);
+    }
+
+    return shape.ret;
+}
+
+ILI9341_Status ili9341_draw_round_rect(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t radius,
+                                       ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_shape_def_t variable shape:</b> State with which the rectangle is drawn. */
+    ILI9341_shape_def_t shape;
+    /** <b>Local \c ILI9341_profile_def_t variable profile:</b> Quadrant Profile of the corners of the rectangle. */
+    ILI9341_profile_def_t profile;
+
+    if ((width == 0) || (height == 0))
+    {
+        return ILI9341_EC_NA;
+    }
+    radius = (radius > (width - 1) / 2) ? (uint16_t) ((width - 1) / 2) : radius;
+    radius = (radius > (height - 1) / 2) ? (uint16_t) ((height - 1) / 2) : radius;
+    ili9341_init_shape(&shape, p_handle, color);
+    ili9341_init_profile(&profile, radius, radius);
+    ili9341_draw_profile(&shape, &profile, x + radius, y + radius, x + width - 1 - radius, y + height - 1 - radius);
+
+    return shape.ret;
+}
+
+ILI9341_Status ili9341_fill_round_rect(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t radius,
+                                       ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_shape_def_t variable shape:</b> State with which the rectangle is filled. */
+    ILI9341_shape_def_t shape;
+    /** <b>Local \c ILI9341_profile_def_t variable profile:</b> Quadrant Profile of the corners of the rectangle. */
+    ILI9341_profile_def_t profile;
+
+    if ((width == 0) || (height == 0))
+    {
+        return ILI9341_EC_NA;
+    }
+    radius = (radius > (width - 1) / 2) ? (uint16_t) ((width - 1) / 2) : radius;
+    radius = (radius > (height - 1) / 2) ? (uint16_t) ((height - 1) / 2) : radius;
+    ili9341_init_shape(&shape, p_handle, color);
+    ili9341_init_profile(&profile, radius, radius);
+    ili9341_fill_profile(&shape, &profile, x + radius, y + radius, x + width - 1 - radius, y + height - 1 - radius);
+
+    return shape.ret;
+}
+
+static ILI9341_Status ili9341_draw_line_runs(ILI9341_handle_t *p_handle, int32_t x0, int32_t y0, int32_t x1, int32_t y1, ILI9341_COLOR color,
+                                             uint8_t is_first_pixel_skipped)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of the whole line. */
+    ILI9341_Status ret = ILI9341_EC_NA;
+    /** <b>Local \c uint8_t variable is_vertical:</b> Whether the line is more vertical than horizontal (1) or not (0), in which case its runs will be vertical instead of horizontal. */
+    uint8_t is_vertical;
+    /** <b>Local \c int32_t variable major:</b> Current coordinate of the line along the axis in which it advances by one pixel per step (i.e., the major axis). */
+    int32_t major;
+    /** <b>Local \c int32_t variable minor:</b> Current coordinate of the line along the other axis (i.e., the minor axis). */
+    int32_t minor;
+    /** <b>Local \c int32_t variable major_end:</b> Coordinate of the second end of the line along the major axis. */
+    int32_t major_end;
+    /** <b>Local \c int32_t variable delta_major:</b> Absolute length of the line along the major axis. */
+    int32_t delta_major;
+    /** <b>Local \c int32_t variable delta_minor:</b> Absolute length of the line along the minor axis. */
+    int32_t delta_minor;
+    /** <b>Local \c int32_t variable step_major:</b> Direction (i.e., 1 or -1) in which the line advances along the major axis. */
+    int32_t step_major;
+    /** <b>Local \c int32_t variable step_minor:</b> Direction (i.e., 1 or -1) in which the line advances along the minor axis. */
+    int32_t step_minor;
+    /** <b>Local \c int32_t variable error:</b> Bresenham decision variable, which tells when the line has to advance along the minor axis. */
+    int32_t error;
+    /** <b>Local \c int32_t variable run_start:</b> Coordinate along the major axis of the first pixel of the run that is currently being built. */
+    int32_t run_start;
+
+    /* Make the major axis the one along which the line is the longest. */
+    is_vertical = ((y1 > y0 ? y1 - y0 : y0 - y1) > (x1 > x0 ? x1 - x0 : x0 - x1));
+    if (is_vertical)
+    {
+        major = y0;
+        minor = x0;
+        major_end = y1;
+        step_minor = (x1 >= x0) ? 1 : -1;
+        delta_minor = (x1 - x0) * step_minor;
+    }
+    else
+    {
+        major = x0;
+        minor = y0;
+        major_end = x1;
+        step_minor = (y1 >= y0) ? 1 : -1;
+        delta_minor = (y1 - y0) * step_minor;
+    }
+    step_major = (major_end >= major) ? 1 : -1;
+    delta_major = (major_end - major) * step_major;
+
+    /* Walk the line along its major axis and draw a run each time that it advances along its minor axis. */
+    run_start = is_first_pixel_skipped ? (major + step_major) : major;
+    error = 2 * delta_minor - delta_major;
+    for (; major != major_end; major += step_major)
+    {
+        if (error > 0)
+        {
+            if ((major - run_start) * step_major >= 0)
+            {
+                if (ili9341_merge_status(&ret, ili9341_draw_run(p_handle, is_vertical, minor, run_start, major, color)))
+                {
+                    return ret;
+                }
+            }
+            minor += step_minor;
+            error -= 2 * delta_major;
+            run_start = major + step_major;
+        }
+        error += 2 * delta_minor;
+    }
+    if ((major - run_start) * step_major >= 0)
+    {
+        ili9341_merge_status(&ret, ili9341_draw_run(p_handle, is_vertical, minor, run_start, major, color));
+    }
+
+    return ret;
+}
+
+static ILI9341_Status ili9341_draw_run(ILI9341_handle_t *p_handle, uint8_t is_vertical, int32_t fixed, int32_t start, int32_t end, ILI9341_COLOR color)
+{
+    /** <b>Local \c int32_t variable limit:</b> Number of pixels of the screen along the run. */
+    int32_t limit = is_vertical ? ILI9341_SCREEN_HEIGHT : ILI9341_SCREEN_WIDTH;
+    /** <b>Local \c int32_t variable low:</b> Lowest coordinate of the run, clipped to the screen. */
+    int32_t low = (start < end) ? start : end;
+    /** <b>Local \c int32_t variable high:</b> Highest coordinate of the run, clipped to the screen. */
+    int32_t high = (start < end) ? end : start;
+
+    /* Clip the run to the screen so that its length always fits into the parameters of @ref ili9341_fill_rect . */
+    if ((high < 0) || (low >= limit) || (fixed < 0) || (fixed >= (is_vertical ? ILI9341_SCREEN_WIDTH : ILI9341_SCREEN_HEIGHT)))
+    {
+        return ILI9341_EC_NA;
+    }
+    low = (low < 0) ? 0 : low;
+    high = (high >= limit) ? (limit - 1) : high;
+
+    /* Draw single pixels inside the SPI Transfer Queue itself and longer runs as 1 pixel thick rectangles. */
+    if (low == high)
+    {
+        return is_vertical ? ili9341_draw_pixel(p_handle, (int16_t) fixed, (int16_t) low, color) : ili9341_draw_pixel(p_handle, (int16_t) low, (int16_t) fixed, color);
+    }
+    if (is_vertical)
+    {
+        return ili9341_draw_vline(p_handle, (int16_t) fixed, (int16_t) low, (uint16_t) (high - low + 1), color);
+    }
+    return ili9341_draw_hline(p_handle, (int16_t) low, (int16_t) fixed, (uint16_t) (high - low + 1), color);
+}
+
+static ILI9341_Status ili9341_draw_span(ILI9341_handle_t *p_handle, int32_t y, int64_t x_start, int64_t x_end, ILI9341_COLOR color)
+{
+    /** <b>Local \c int64_t variable first:</b> Column of the first pixel whose center lies at or after \p x_start . */
+    int64_t first = (x_start + ILI9341_GRAPHICS_FIXED_POINT_HALF - 1) >> ILI9341_GRAPHICS_FIXED_POINT_SHIFT;
+    /** <b>Local \c int64_t variable last:</b> Column of the last pixel whose center lies before \p x_end . */
+    int64_t last = ((x_end + ILI9341_GRAPHICS_FIXED_POINT_HALF - 1) >> ILI9341_GRAPHICS_FIXED_POINT_SHIFT) - 1;
+
+    if ((first > last) || (last < 0) || (first >= ILI9341_SCREEN_WIDTH))
+    {
+        return ILI9341_EC_NA;
+    }
+    return ili9341_draw_run(p_handle, 0, y, (int32_t) ((first < 0) ? 0 : first), (int32_t) ((last >= ILI9341_SCREEN_WIDTH) ? (ILI9341_SCREEN_WIDTH - 1) : last),
+                            color);
+}
+
+static uint8_t ili9341_merge_status(ILI9341_Status *p_ret, ILI9341_Status status)
+{
+    if (status == ILI9341_EC_OK)
+    {
+        *p_ret = ILI9341_EC_OK;
+    }
+    else if (status != ILI9341_EC_NA)
+    {
+        *p_ret = status;
+        return 1;
+    }
+
+    return 0;
+}
+
+static void ili9341_init_profile(ILI9341_profile_def_t *p_profile, int32_t radius_x, int32_t radius_y)
+{
+    p_profile->term_x = (int64_t) (2 * radius_x + 1) * (2 * radius_x + 1);
+    p_profile->term_y = (int64_t) (2 * radius_y + 1) * (2 * radius_y + 1);
+    p_profile->threshold = p_profile->term_x * p_profile->term_y;
+    p_profile->radius_x = radius_x;
+    p_profile->radius_y = radius_y;
+}
+
+static int32_t ili9341_get_half_width(const ILI9341_profile_def_t *p_profile, int32_t dy, int32_t x)
+{
+    while ((x >= 0) && ((4 * (int64_t) x * x * p_profile->term_y + 4 * (int64_t) dy * dy * p_profile->term_x) > p_profile->threshold))
+    {
+        x--;
+    }
+
+    return x;
+}
+
+static int32_t ili9341_get_sine(int32_t angle)
+{
+    angle %= 360;
+    angle = (angle < 0) ? (angle + 360) : angle;
+    if (angle <= 90)
+    {
+        return sine_table[angle];
+    }
+    if (angle <= 180)
+    {
+        return sine_table[180 - angle];
+    }
+    if (angle <= 270)
+    {
+        return -sine_table[angle - 180];
+    }
+
+    return -sine_table[360 - angle];
+}
+
+static void ili9341_init_shape(ILI9341_shape_def_t *p_shape, ILI9341_handle_t *p_handle, ILI9341_COLOR color)
+{
+    p_shape->p_handle = p_handle;
+    p_shape->color = color;
+    p_shape->ret = ILI9341_EC_NA;
+    p_shape->is_stopped = 0;
+    p_shape->is_sector = 0;
+    p_shape->is_reflex = 0;
+}
+
+static uint8_t ili9341_set_shape_sector(ILI9341_shape_def_t *p_shape, int32_t xc, int32_t yc, int32_t start_angle, int32_t end_angle)
+{
+    if (end_angle <= start_angle)
+    {
+        return 0;
+    }
+    p_shape->is_sector = ((end_angle - start_angle) < 360);
+    p_shape->is_reflex = ((end_angle - start_angle) > 180);
+    p_shape->center_x = xc;
+    p_shape->center_y = yc;
+    p_shape->start_x = ili9341_get_sine(start_angle + 90);
+    p_shape->start_y = ili9341_get_sine(start_angle);
+    p_shape->end_x = ili9341_get_sine(end_angle + 90);
+    p_shape->end_y = ili9341_get_sine(end_angle);
+
+    return 1;
+}
+
+static uint8_t ili9341_is_in_sector(const ILI9341_shape_def_t *p_shape, int32_t x, int32_t y)
+{
+    /** <b>Local \c int64_t variable dx:</b> Column of the pixel relative to the center of the arc. */
+    int64_t dx = x - p_shape->center_x;
+    /** <b>Local \c int64_t variable dy:</b> Row of the pixel relative to the center of the arc. */
+    int64_t dy = y - p_shape->center_y;
+    /** <b>Local \c uint8_t variable is_after_start:</b> Whether the pixel lies clockwise from the start angle by up to 180 degrees (1) or not (0), as given by the sign of the cross product of their directions. */
+    uint8_t is_after_start = ((p_shape->start_x * dy - p_shape->start_y * dx) >= 0);
+    /** <b>Local \c uint8_t variable is_before_end:</b> Whether the pixel lies counterclockwise from the end angle by up to 180 degrees (1) or not (0). */
+    uint8_t is_before_end = ((dx * p_shape->end_y - dy * p_shape->end_x) >= 0);
+
+    /* An arc of up to 180 degrees is the intersection of both half planes, while a longer arc is their union. */
+    return p_shape->is_reflex ? (is_after_start || is_before_end) : (is_after_start && is_before_end);
+}
+
+static void ili9341_draw_shape_run(ILI9341_shape_def_t *p_shape, uint8_t is_vertical, int32_t fixed, int32_t start, int32_t end)
+{
+    /** <b>Local \c int32_t variable limit:</b> Number of pixels of the screen along the run. */
+    int32_t limit = is_vertical ? ILI9341_SCREEN_HEIGHT : ILI9341_SCREEN_WIDTH;
+    /** <b>Local \c int32_t variable run_start:</b> First pixel of the part of the run that is currently within the angles of the arc, or -1 if none. */
+    int32_t run_start = -1;
+    /** <b>Local \c uint8_t variable is_inside:</b> Whether the current pixel lies within the angles of the arc (1) or not (0). */
+    uint8_t is_inside;
+
+    if (p_shape->is_stopped)
+    {
+        return;
+    }
+    if (!p_shape->is_sector)
+    {
+        p_shape->is_stopped = ili9341_merge_status(&p_shape->ret, ili9341_draw_run(p_shape->p_handle, is_vertical, fixed, start, end, p_shape->color));
+        return;
+    }
+
+    /* Clip the run to the screen before testing its pixels and then draw each of its parts that lie within the angles of the arc. */
+    if ((end < 0) || (start >= limit) || (fixed < 0) || (fixed >= (is_vertical ? ILI9341_SCREEN_WIDTH : ILI9341_SCREEN_HEIGHT)))
+    {
+        return;
+    }
+    start = (start < 0) ? 0 : start;
+    end = (end >= limit) ? (limit - 1) : end;
+    for (int32_t i = start; i <= end + 1; i++)
+    {
+        is_inside = (i <= end) && (is_vertical ? ili9341_is_in_sector(p_shape, fixed, i) : ili9341_is_in_sector(p_shape, i, fixed));
+        if (is_inside && (run_start < 0))
+        {
+            run_start = i;
+        }
+        else if (!is_inside && (run_start >= 0))
+        {
+            if (ili9341_merge_status(&p_shape->ret, ili9341_draw_run(p_shape->p_handle, is_vertical, fixed, run_start, i - 1, p_shape->color)))
+            {
+                p_shape->is_stopped = 1;
+                return;
+            }
+            run_start = -1;
+        }
+    }
+}
+
+static void ili9341_fill_shape_rect(ILI9341_shape_def_t *p_shape, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    if (p_shape->is_stopped || (x1 < 0) || (x0 >= ILI9341_SCREEN_WIDTH) || (y1 < 0) || (y0 >= ILI9341_SCREEN_HEIGHT))
+    {
+        return;
+    }
+    if (y0 == y1)
+    {
+        ili9341_draw_shape_run(p_shape, 0, y0, x0, x1); // Single rows are drawn as runs so that single pixels go inline.
+        return;
+    }
+    x0 = (x0 < 0) ? 0 : x0;
+    y0 = (y0 < 0) ? 0 : y0;
+    x1 = (x1 >= ILI9341_SCREEN_WIDTH) ? (ILI9341_SCREEN_WIDTH - 1) : x1;
+    y1 = (y1 >= ILI9341_SCREEN_HEIGHT) ? (ILI9341_SCREEN_HEIGHT - 1) : y1;
+    p_shape->is_stopped = ili9341_merge_status(&p_shape->ret, ili9341_fill_rect(p_shape->p_handle, (int16_t) x0, (int16_t) y0, (uint16_t) (x1 - x0 + 1),
+                                                                                 (uint16_t) (y1 - y0 + 1), p_shape->color));
+}
+
+static void ili9341_draw_mirrored_runs(ILI9341_shape_def_t *p_shape, uint8_t is_vertical, int32_t distance, int32_t low, int32_t high, int32_t left,
+                                       int32_t top, int32_t right, int32_t bottom)
+{
+    /** <b>Local \c int32_t variable fixed_low:</b> Row (or column, for vertical runs) of the runs of the top (or left) quadrants. */
+    int32_t fixed_low = (is_vertical ? left : top) - distance;
+    /** <b>Local \c int32_t variable fixed_high:</b> Row (or column, for vertical runs) of the runs of the bottom (or right) quadrants. */
+    int32_t fixed_high = (is_vertical ? right : bottom) + distance;
+    /** <b>Local \c int32_t variable run_low:</b> Center of the top (or left) quadrants along the runs. */
+    int32_t run_low = is_vertical ? top : left;
+    /** <b>Local \c int32_t variable run_high:</b> Center of the bottom (or right) quadrants along the runs. */
+    int32_t run_high = is_vertical ? bottom : right;
+
+    if (low > high)
+    {
+        return;
+    }
+    for (int32_t fixed = fixed_low;; fixed = fixed_high)
+    {
+        if (low == 0)
+        {
+            ili9341_draw_shape_run(p_shape, is_vertical, fixed, run_low - high, run_high + high); // Both mirrors touch, so they are merged.
+        }
+        else
+        {
+            ili9341_draw_shape_run(p_shape, is_vertical, fixed, run_low - high, run_low - low);
+            ili9341_draw_shape_run(p_shape, is_vertical, fixed, run_high + low, run_high + high);
+        }
+        if ((fixed == fixed_high) || p_shape->is_stopped)
+        {
+            break; // Both mirrors have been drawn or they lie at the very same row (or column).
+        }
+    }
+}
+
+static void ili9341_draw_profile(ILI9341_shape_def_t *p_shape, const ILI9341_profile_def_t *p_profile, int32_t left, int32_t top, int32_t right,
+                                 int32_t bottom)
+{
+    /** <b>Local \c int32_t variable half_width:</b> Half width of the current row of the Quadrant Profile. */
+    int32_t half_width = p_profile->radius_x;
+    /** <b>Local \c int32_t variable next_half_width:</b> Half width of the next row of the Quadrant Profile, which is -1 after its last row. */
+    int32_t next_half_width;
+    /** <b>Local \c int32_t variable low:</b> Distance from the center column of the quadrant to the first pixel of the outline at the current row. */
+    int32_t low;
+    /** <b>Local \c int32_t variable column:</b> Distance from the center column of the quadrant to the vertical run that is currently being built, or -1 if none. */
+    int32_t column = -1;
+    /** <b>Local \c int32_t variable run_start:</b> Row of the Quadrant Profile at which the vertical run that is currently being built starts. */
+    int32_t run_start = 0;
+    /** <b>Local \c int32_t variable dy:</b> Current row of the Quadrant Profile. */
+    int32_t dy;
+
+    for (dy = 0; (dy <= p_profile->radius_y) && !p_shape->is_stopped; dy++)
+    {
+        next_half_width = (dy < p_profile->radius_y) ? ili9341_get_half_width(p_profile, dy + 1, half_width) : -1;
+        low = (next_half_width < half_width) ? (next_half_width + 1) : half_width;
+        if ((low == half_width) && ((low != 0) || (left == right)))
+        {
+            /* The outline has a single pixel at this row of the quadrant, which either extends the current vertical run or starts a new one. */
+            if (column != half_width)
+            {
+                if (column >= 0)
+                {
+                    ili9341_draw_mirrored_runs(p_shape, 1, column, run_start, dy - 1, left, top, right, bottom);
+                }
+                column = half_width;
+                run_start = dy;
+            }
+        }
+        else
+        {
+            if (column >= 0)
+            {
+                ili9341_draw_mirrored_runs(p_shape, 1, column, run_start, dy - 1, left, top, right, bottom);
+                column = -1;
+            }
+            ili9341_draw_mirrored_runs(p_shape, 0, dy, low, half_width, left, top, right, bottom);
+            if ((dy == 0) && (bottom - top > 1))
+            {
+                /* The sides of a rounded rectangle are not reached by any vertical run of its corners, so they are drawn on their own. */
+                ili9341_draw_shape_run(p_shape, 1, left - half_width, top + 1, bottom - 1);
+                if (right != left)
+                {
+                    ili9341_draw_shape_run(p_shape, 1, right + half_width, top + 1, bottom - 1);
+                }
+            }
+        }
+        half_width = next_half_width;
+    }
+    if (column >= 0)
+    {
+        ili9341_draw_mirrored_runs(p_shape, 1, column, run_start, p_profile->radius_y, left, top, right, bottom);
+    }
+}
+
+static void ili9341_fill_profile(ILI9341_shape_def_t *p_shape, const ILI9341_profile_def_t *p_profile, int32_t left, int32_t top, int32_t right,
+                                 int32_t bottom)
+{
+    /** <b>Local \c int32_t variable half_width:</b> Half width of the current row of the Quadrant Profile. */
+    int32_t half_width = p_profile->radius_x;
+    /** <b>Local \c int32_t variable next_half_width:</b> Half width of the next row of the Quadrant Profile, which is -1 after its last row. */
+    int32_t next_half_width;
+    /** <b>Local \c int32_t variable band_start:</b> Row of the Quadrant Profile at which the current band of rows of the same half width starts. */
+    int32_t band_start = 0;
+
+    for (int32_t dy = 0; (dy <= p_profile->radius_y) && !p_shape->is_stopped; dy++)
+    {
+        next_half_width = (dy < p_profile->radius_y) ? ili9341_get_half_width(p_profile, dy + 1, half_width) : -1;
+        if (next_half_width != half_width)
+        {
+            if (band_start == 0)
+            {
+                ili9341_fill_shape_rect(p_shape, left - half_width, top - dy, right + half_width, bottom + dy);
+            }
+            else
+            {
+                ili9341_fill_shape_rect(p_shape, left - half_width, top - dy, right + half_width, top - band_start);
+                ili9341_fill_shape_rect(p_shape, left - half_width, bottom + band_start, right + half_width, bottom + dy);
+            }
+            band_start = dy + 1;
+        }
+        half_width = next_half_width;
+    }
+}
+
+/** @} */
@@ -0,0 +1,537 @@
+/** @addtogroup ili9341_images
+ * @{
+ */
+
+#include "ili9341_images.h"
+
+#define ILI9341_QOI_OP_INDEX        (0x00)  /**< @brief Tag of the QOI operations that repeat the pixel stored at the given position of the hash table. */
+#define ILI9341_QOI_OP_DIFF         (0x40)  /**< @brief Tag of the QOI operations that add a difference from -2 up to 1 to each channel of the previous pixel. */
+#define ILI9341_QOI_OP_LUMA         (0x80)  /**< @brief Tag of the QOI operations that add a green difference from -32 up to 31 to the previous pixel, plus a red and a blue difference from -8 up to 7 relative to it. */
+#define ILI9341_QOI_OP_RUN          (0xC0)  /**< @brief Tag of the QOI operations that repeat the previous pixel from 1 up to 62 times. */
+#define ILI9341_QOI_OP_PIXEL        (0xFE)  /**< @brief QOI operation that is followed by a whole pixel (i.e., 2 bytes for @ref ILI9341_BPP_16 images and 3 bytes for @ref ILI9341_BPP_18 ones). */
+#define ILI9341_QOI_TAG_MASK        (0xC0)  /**< @brief Mask of the tag of the first byte of a QOI operation. */
+#define ILI9341_QOI_INDEX_SIZE      (64)    /**< @brief Number of pixels of the hash table of the QOI decoder. */
+
+/**@brief   Decodes the next pixels of a compressed image.
+ *
+ * @param[in,out] p_decoder Pointer to the state of the decoder of the compressed image.
+ * @param[out] p_pixels     Pointer to the memory into which the decoded pixels are to be written in the Bits Per Pixel
+ *                          (BPP) type given to @ref ili9341_stream_image , or NULL if they are to be decoded and
+ *                          discarded (i.e., skipped).
+ * @param count             Number of pixels to be decoded.
+ */
+typedef void (*ILI9341_image_decoder_t)(void *p_decoder, void *p_pixels, uint32_t count);
+
+/**@brief	ILI9341 Run-Length Encoded Image Decoder parameters structure.
+ *
+ * @details This contains the position within the tokens of an @ref ILI9341_rle_image_t up to which it has been
+ *          decoded, so that its pixels can be decoded in chunks of any size.
+ */
+typedef struct
+{
+    const uint16_t *p_data;     //!< Pointer to the next word of the tokens of the image to be read.
+    const uint16_t *p_end;      //!< Pointer right after the last word of the tokens of the image.
+    uint32_t remaining;         //!< Number of pixels of the current token that have not been decoded yet.
+    uint16_t run_pixel;         //!< Pixel that is repeated by the current token, if it is a run.
+    uint8_t is_run;             //!< Whether the current token is a run (1) or a sequence of literal pixels (0).
+    uint8_t is_corrupt;         //!< Whether the tokens of the image ended before all of its pixels were decoded (1) or not (0).
+} ILI9341_rle_decoder_t;
+
+/**@brief	ILI9341 QOI Image Decoder parameters structure.
+ *
+ * @details This contains the position within the operations of an @ref ILI9341_qoi_image_t up to which it has been
+ *          decoded, together with the previous pixel and the hash table of recently seen pixels on which its next
+ *          operations are based.
+ */
+typedef struct
+{
+    const uint8_t *p_data;                      //!< Pointer to the next byte of the operations of the image to be read.
+    const uint8_t *p_end;                       //!< Pointer right after the last byte of the operations of the image.
+    uint32_t index[ILI9341_QOI_INDEX_SIZE];     //!< Hash table of recently seen pixels, each of them packed as <tt>(red << 16) | (green << 8) | blue</tt> .
+    uint32_t output;                            //!< Previous pixel, already converted into the Bits Per Pixel (BPP) type in which the pixels are being decoded.
+    uint8_t red;                                //!< Red channel of the previous pixel.
+    uint8_t green;                              //!< Green channel of the previous pixel.
+    uint8_t blue;                               //!< Blue channel of the previous pixel.
+    uint8_t red_blue_mask;                      //!< Mask of the red and blue channels of the pixels of the image (i.e., 0x1F or 0x3F).
+    uint8_t run;                                //!< Number of times that the previous pixel is still to be repeated.
+    ILI9341_BPP_t image_bpp;                    //!< Bits Per Pixel (BPP) type of the pixels of the image.
+    ILI9341_BPP_t output_bpp;                   //!< Bits Per Pixel (BPP) type in which the pixels are being decoded.
+    uint8_t is_corrupt;                         //!< Whether the operations of the image ended before all of its pixels were decoded (1) or not (0).
+} ILI9341_qoi_decoder_t;
+
+/**@brief   Line buffers into which the compressed images are decoded, where one of them is filled while the other one
+ *          is being sent by DMA.
+ */
+static union
+{
+    uint16_t bpp_16[2][ILI9341_IMAGES_LINE_BUFFER_PIXELS];                                  //!< Line buffers viewed as 16 bits per pixel pixels.
+    uint8_t bpp_18[2][ILI9341_IMAGES_LINE_BUFFER_PIXELS * sizeof(uint16_t)];               //!< Line buffers viewed as the 3 bytes (i.e., Red, Green and Blue) of each 18 bits per pixel pixel.
+} line_buffers;
+
+/**@brief   Flags that tell whether each of @ref line_buffers is still in use by the DMA (1) or not (0), as given to
+ *          @ref ili9341_write_pixels_16bpp and @ref ili9341_write_pixels .
+ */
+static volatile uint8_t is_line_buffer_in_use[2];
+
+/**@brief   Streams the pixels of a compressed image into its Address Window through the two line buffers of this
+ *          module, where each line buffer is decoded while the other one is being sent by DMA.
+ *
+ * @details The image is clipped to the Clip Rectangle, where its pixels that lie above or beside the Clip Rectangle
+ *          are skipped by \p decode and the rows below it are never decoded. Since the visible pixels of consecutive
+ *          rows are sent back to back into the same Address Window, each line buffer is always filled up before being
+ *          sent regardless of the width of the image. A line buffer holds @ref ILI9341_IMAGES_LINE_BUFFER_PIXELS
+ *          pixels in 16 bits per pixel, but only two thirds of that in 18 bits per pixel.
+ *
+ * @param[in] p_handle      Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x                 Column of the top-left corner of the image.
+ * @param y                 Row of the top-left corner of the image.
+ * @param width             Number of columns of the image.
+ * @param height            Number of rows of the image.
+ * @param bpp               Bits Per Pixel (BPP) type in which \p decode writes the pixels.
+ * @param decode            Decoder with which the pixels of the image are decoded in the order in which they are
+ *                          stored (i.e., row by row from its top-left corner).
+ * @param[in,out] p_decoder Pointer to the state of \p decode .
+ *
+ * @retval  ILI9341_EC_OK if drawing the image was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the image lies within the Clip Rectangle or if the @ref ili9341 is not
+ *          currently using the \p bpp Bits Per Pixel (BPP) type with the ILI9341 Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if something went wrong with the SPI.
+ */
+static ILI9341_Status ili9341_stream_image(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                                           ILI9341_BPP_t bpp, ILI9341_image_decoder_t decode, void *p_decoder);
+
+/**@brief   Queues the pixels that have been decoded into one of the line buffers of this module to be sent by DMA into
+ *          the current Address Window, where the in-use flag of that line buffer is set until the DMA is done with it.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param bpp           Bits Per Pixel (BPP) type of the pixels in the line buffer.
+ * @param index         Index of the line buffer (i.e., 0 or 1).
+ * @param count         Number of pixels in the line buffer.
+ *
+ * @retval  ILI9341_EC_OK if writing the pixels was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if something went wrong with the SPI.
+ */
+static ILI9341_Status ili9341_write_line_buffer(ILI9341_handle_t *p_handle, ILI9341_BPP_t bpp, uint8_t index, uint32_t count);
+
+/**@brief   Decodes the next pixels of an @ref ILI9341_rle_image_t .
+ *
+ * @details Whenever the tokens of the image end before the requested pixels have been decoded, the rest of them are
+ *          decoded as black and @ref ILI9341_rle_decoder_t::is_corrupt is set.
+ *
+ * @param[in,out] p_decoder Pointer to the @ref ILI9341_rle_decoder_t of the image.
+ * @param[out] p_output     Pointer to the memory into which the decoded pixels are to be written, or NULL if they are
+ *                          to be skipped.
+ * @param count             Number of pixels to be decoded.
+ */
+static void ili9341_decode_rle(void *p_decoder, void *p_output, uint32_t count);
+
+/**@brief   Decodes the next pixels of an @ref ILI9341_qoi_image_t .
+ *
+ * @details Each pixel is converted from the Bits Per Pixel (BPP) type of the image into the one given by
+ *          @ref ILI9341_qoi_decoder_t::output_bpp only whenever an operation changes it, so that runs cost a single
+ *          store per pixel. Whenever the operations of the image end before the requested pixels have been decoded,
+ *          the rest of them are decoded as black and @ref ILI9341_qoi_decoder_t::is_corrupt is set.
+ *
+ * @param[in,out] p_decoder Pointer to the @ref ILI9341_qoi_decoder_t of the image.
+ * @param[out] p_output     Pointer to the memory into which the decoded pixels are to be written, or NULL if they are
+ *                          to be skipped.
+ * @param count             Number of pixels to be decoded.
+ */
+static void ili9341_decode_qoi(void *p_decoder, void *p_output, uint32_t count);
+
+ILI9341_Status ili9341_draw_sprite(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const ILI9341_sprite_t *p_sprite)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of the whole sprite. */
+    ILI9341_Status ret = ILI9341_EC_NA;
+    /** <b>Local \c ILI9341_Status variable status:</b> Holds the Return value of drawing a single run of the sprite. */
+    ILI9341_Status status;
+    /** <b>Local \c ILI9341_sprite_run_t pointer p_run:</b> Points to the run of the sprite that is currently being drawn. */
+    const ILI9341_sprite_run_t *p_run;
+    /** <b>Local \c uint16_t pointer p_pixels:</b> Points to the first pixel of the run of the sprite that is currently being drawn. */
+    const uint16_t *p_pixels;
+    /** <b>Local \c int32_t variable run_x:</b> Column of the top-left corner of the run of the sprite that is currently being drawn. */
+    int32_t run_x;
+    /** <b>Local \c int32_t variable run_y:</b> Row of the top-left corner of the run of the sprite that is currently being drawn. */
+    int32_t run_y;
+
+    if (p_sprite == NULL)
+    {
+        return ILI9341_EC_ERR;
+    }
+
+    /* Draw each run straight from the pixels of the sprite, where the runs that lie outside of the Clip Rectangle (or all of them, if the 16 bits per pixel Bits Per Pixel (BPP) type is not being used) are skipped by @ref ili9341_blit itself. */
+    p_pixels = p_sprite->p_pixels;
+    for (uint16_t i = 0; i < p_sprite->run_count; i++)
+    {
+        p_run = &p_sprite->p_runs[i];
+        run_x = (int32_t) x + p_run->x;
+        run_y = (int32_t) y + p_run->y;
+        status = ((run_x >= ILI9341_SCREEN_WIDTH) || (run_y >= ILI9341_SCREEN_HEIGHT)) ? ILI9341_EC_NA
+                 : ili9341_blit(p_handle, (int16_t) run_x, (int16_t) run_y, p_run->width, p_run->height, p_pixels, p_run->width);
+        if (status == ILI9341_EC_OK)
+        {
+            ret = ILI9341_EC_OK;
+        }
+        else if (status != ILI9341_EC_NA)
+        {
+            return status;
+        }
+        p_pixels += (uint32_t) p_run->width * p_run->height;
+    }
+
+    return ret;
+}
+
+ILI9341_Status ili9341_draw_rle_image(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const ILI9341_rle_image_t *p_image)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret;
+    /** <b>Local \c ILI9341_rle_decoder_t variable decoder:</b> Holds the position within the tokens of the image up to which it has been decoded. */
+    ILI9341_rle_decoder_t decoder;
+
+    if (p_image == NULL)
+    {
+        return ILI9341_EC_ERR;
+    }
+
+    decoder.p_data = p_image->p_data;
+    decoder.p_end = p_image->p_data + p_image->size;
+    decoder.remaining = 0;
+    decoder.run_pixel = 0;
+    decoder.is_run = 0;
+    decoder.is_corrupt = 0;
+    ret = ili9341_stream_image(p_handle, x, y, p_image->width, p_image->height, ILI9341_BPP_16, ili9341_decode_rle, &decoder);
+
+    return ((ret == ILI9341_EC_OK) && decoder.is_corrupt) ? ILI9341_EC_ERR : ret;
+}
+
+ILI9341_Status ili9341_draw_qoi_image(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const ILI9341_qoi_image_t *p_image)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret;
+    /** <b>Local \c ILI9341_qoi_decoder_t variable decoder:</b> Holds the position within the operations of the image up to which it has been decoded, together with the state on which its next operations are based. */
+    ILI9341_qoi_decoder_t decoder;
+
+    if ((p_image == NULL) || ((p_image->bpp_type != ILI9341_BPP_16) && (p_image->bpp_type != ILI9341_BPP_18)))
+    {
+        return ILI9341_EC_ERR;
+    }
+
+    /* Start from a black previous pixel and an empty hash table, which the encoder assumes as well. */
+    decoder.p_data = p_image->p_data;
+    decoder.p_end = p_image->p_data + p_image->size;
+    memset(decoder.index, 0, sizeof(decoder.index));
+    decoder.output = 0;
+    decoder.red = 0;
+    decoder.green = 0;
+    decoder.blue = 0;
+    decoder.red_blue_mask = (p_image->bpp_type == ILI9341_BPP_16) ? 0x1F : 0x3F;
+    decoder.run = 0;
+    decoder.image_bpp = p_image->bpp_type;
+    decoder.output_bpp = get_ili9341_bpp_type(p_handle);
+    decoder.is_corrupt = 0;
+    ret = ili9341_stream_image(p_handle, x, y, p_image->width, p_image->height, decoder.output_bpp, ili9341_decode_qoi, &decoder);
+
+    return ((ret == ILI9341_EC_OK) && decoder.is_corrupt) ? ILI9341_EC_ERR : ret;
+}
+
+static ILI9341_Status ili9341_stream_image(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                                           ILI9341_BPP_t bpp, ILI9341_image_decoder_t decode, void *p_decoder)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret;
+    /** <b>Local \c ILI9341_clip_rect_def_t pointer p_clip:</b> Points to the Clip Rectangle of the ILI9341 Device. */
+    const ILI9341_clip_rect_def_t *p_clip = &p_handle->clip_rect;
+    /** <b>Local \c int32_t variable x0:</b> Left-most column of the image after being clipped to the Clip Rectangle. */
+    int32_t x0 = (x < p_clip->x0) ? p_clip->x0 : x;
+    /** <b>Local \c int32_t variable y0:</b> Top-most row of the image after being clipped to the Clip Rectangle. */
+    int32_t y0 = (y < p_clip->y0) ? p_clip->y0 : y;
+    /** <b>Local \c int32_t variable x1:</b> Right-most column of the image after being clipped to the Clip Rectangle. */
+    int32_t x1 = (int32_t) x + width - 1;
+    /** <b>Local \c int32_t variable y1:</b> Bottom-most row of the image after being clipped to the Clip Rectangle. */
+    int32_t y1 = (int32_t) y + height - 1;
+    /** <b>Local \c uint32_t variable left_skip:</b> Number of pixels of each row of the image that lie at the left of the Clip Rectangle. */
+    uint32_t left_skip;
+    /** <b>Local \c uint32_t variable right_skip:</b> Number of pixels of each row of the image that lie at the right of the Clip Rectangle. */
+    uint32_t right_skip;
+    /** <b>Local \c uint32_t variable remaining:</b> Number of visible pixels of the current row that have not been decoded yet. */
+    uint32_t remaining;
+    /** <b>Local \c uint32_t variable chunk:</b> Number of pixels that are decoded at once into the current line buffer. */
+    uint32_t chunk;
+    /** <b>Local \c uint32_t variable capacity:</b> Number of pixels of \p bpp that fit in a line buffer. */
+    uint32_t capacity = (bpp == ILI9341_BPP_16) ? ILI9341_IMAGES_LINE_BUFFER_PIXELS : (ILI9341_IMAGES_LINE_BUFFER_PIXELS * sizeof(uint16_t) / 3);
+    /** <b>Local \c uint32_t variable filled:</b> Number of pixels that have been decoded into the current line buffer. */
+    uint32_t filled = 0;
+    /** <b>Local \c uint8_t variable index:</b> Index of the line buffer that is currently being decoded into. */
+    uint8_t index = 0;
+
+    /* Clip the image to the Clip Rectangle and reject it, before any SPI traffic, if nothing of it is left. */
+    x1 = (x1 > p_clip->x1) ? p_clip->x1 : x1;
+    y1 = (y1 > p_clip->y1) ? p_clip->y1 : y1;
+    if ((get_ili9341_bpp_type(p_handle) != bpp) || (width == 0) || (height == 0) || (x0 > x1) || (y0 > y1))
+    {
+        return ILI9341_EC_NA;
+    }
+    left_skip = (uint32_t) (x0 - x);
+    right_skip = (uint32_t) ((int32_t) x + width - 1 - x1);
+
+    ret = ili9341_set_window(p_handle, (uint16_t) x0, (uint16_t) y0, (uint16_t) x1, (uint16_t) y1);
+    if (ret != ILI9341_EC_OK)
+    {
+        return ret;
+    }
+    if (y0 > y)
+    {
+        decode(p_decoder, NULL, (uint32_t) (y0 - y) * width);
+    }
+
+    /* Decode the visible pixels of each row into the current line buffer and, whenever it gets full, queue it and swap to the other one, which is first waited for until the DMA is done with it. */
+    for (int32_t row = y0; row <= y1; row++)
+    {
+        if (left_skip != 0)
+        {
+            decode(p_decoder, NULL, left_skip);
+        }
+        remaining = (uint32_t) (x1 - x0 + 1);
+        while (remaining != 0)
+        {
+            if (filled == 0)
+            {
+                while (is_line_buffer_in_use[index] != 0);
+            }
+            chunk = capacity - filled;
+            chunk = (chunk > remaining) ? remaining : chunk;
+            decode(p_decoder, (bpp == ILI9341_BPP_16) ? (void *) &line_buffers.bpp_16[index][filled] : (void *) &line_buffers.bpp_18[index][filled * 3], chunk);
+            filled += chunk;
+            remaining -= chunk;
+            if (filled == capacity)
+            {
+                ret = ili9341_write_line_buffer(p_handle, bpp, index, filled);
+                if (ret != ILI9341_EC_OK)
+                {
+                    return ret;
+                }
+                index ^= 1;
+                filled = 0;
+            }
+        }
+        if (right_skip != 0)
+        {
+            decode(p_decoder, NULL, right_skip);
+        }
+    }
+    if (filled != 0)
+    {
+        ret = ili9341_write_line_buffer(p_handle, bpp, index, filled);
+    }
+
+    return ret;
+}
+
+static ILI9341_Status ili9341_write_line_buffer(ILI9341_handle_t *p_handle, ILI9341_BPP_t bpp, uint8_t index, uint32_t count)
+{
+    if (bpp == ILI9341_BPP_16)
+    {
+        return ili9341_write_pixels_16bpp(p_handle, line_buffers.bpp_16[index], count, &is_line_buffer_in_use[index]);
+    }
+    return ili9341_write_pixels(p_handle, line_buffers.bpp_18[index], count * 3, &is_line_buffer_in_use[index]);
+}
+
+static void ili9341_decode_rle(void *p_decoder, void *p_output, uint32_t count)
+{
+    /** <b>Local \c ILI9341_rle_decoder_t pointer p_rle:</b> Points to the state of the decoder of the image. */
+    ILI9341_rle_decoder_t *p_rle = (ILI9341_rle_decoder_t *) p_decoder;
+    /** <b>Local \c uint16_t pointer p_pixels:</b> Points to the memory into which the next decoded pixel is to be written, or NULL if the pixels are being skipped. */
+    uint16_t *p_pixels = (uint16_t *) p_output;
+    /** <b>Local \c uint32_t variable n:</b> Number of pixels that are decoded at once from the current token. */
+    uint32_t n;
+    /** <b>Local \c uint16_t variable header:</b> Header word of the token that is being started. */
+    uint16_t header;
+
+    while (count != 0)
+    {
+        /* Start the next token, or decode the rest of the pixels as black if the tokens of the image have ended. */
+        if (p_rle->remaining == 0)
+        {
+            header = (p_rle->p_data < p_rle->p_end) ? *p_rle->p_data : 0;
+            if ((p_rle->p_data >= p_rle->p_end) || ((header & 0x8000) && (p_rle->p_data + 1 >= p_rle->p_end))
+                || (!(header & 0x8000) && ((uint32_t) (p_rle->p_end - p_rle->p_data - 1) < (uint32_t) header + 1)))
+            {
+                p_rle->is_corrupt = 1;
+                p_rle->p_data = p_rle->p_end;
+                p_rle->is_run = 1;
+                p_rle->run_pixel = 0;
+                p_rle->remaining = count;
+            }
+            else
+            {
+                p_rle->p_data++;
+                p_rle->is_run = (header & 0x8000) ? 1 : 0;
+                p_rle->remaining = (uint32_t) (header & 0x7FFF) + 1;
+                if (p_rle->is_run)
+                {
+                    p_rle->run_pixel = *p_rle->p_data++;
+                }
+            }
+        }
+
+        n = (p_rle->remaining < count) ? p_rle->remaining : count;
+        if (p_pixels != NULL)
+        {
+            if (p_rle->is_run)
+            {
+                for (uint32_t i = 0; i < n; i++)
+                {
+                    p_pixels[i] = p_rle->run_pixel;
+                }
+            }
+            else
+            {
+                memcpy(p_pixels, p_rle->p_data, n * sizeof(uint16_t));
+            }
+            p_pixels += n;
+        }
+        if (!p_rle->is_run)
+        {
+            p_rle->p_data += n;
+        }
+        p_rle->remaining -= n;
+        count -= n;
+    }
+}
+
+static void ili9341_decode_qoi(void *p_decoder, void *p_output, uint32_t count)
+{
+    /** <b>Local \c ILI9341_qoi_decoder_t pointer p_qoi:</b> Points to the state of the decoder of the image. */
+    ILI9341_qoi_decoder_t *p_qoi = (ILI9341_qoi_decoder_t *) p_decoder;
+    /** <b>Local \c uint8_t pointer p_pixels:</b> Points to the memory into which the next decoded pixel is to be written, or NULL if the pixels are being skipped. */
+    uint8_t *p_pixels = (uint8_t *) p_output;
+    /** <b>Local \c uint32_t variable n:</b> Number of times that the current pixel is written at once. */
+    uint32_t n;
+    /** <b>Local \c uint8_t variable op:</b> First byte of the operation that is being decoded. */
+    uint8_t op;
+    /** <b>Local \c int8_t variable green_diff:</b> Difference of the green channel of a QOI luma operation. */
+    int8_t green_diff;
+    /** <b>Local \c uint32_t variable pixel_size:</b> Number of bytes of the pixels of the image that follow a QOI pixel operation. */
+    uint32_t pixel_size = (p_qoi->image_bpp == ILI9341_BPP_16) ? 2 : 3;
+    /** <b>Local \c uint32_t variable packed:</b> Previous pixel packed as <tt>(red << 16) | (green << 8) | blue</tt> . */
+    uint32_t packed;
+    /** <b>Local \c uint8_t variable red:</b> Red channel of the previous pixel, expanded into 6 bits. */
+    uint8_t red;
+    /** <b>Local \c uint8_t variable blue:</b> Blue channel of the previous pixel, expanded into 6 bits. */
+    uint8_t blue;
+
+    while (count != 0)
+    {
+        /* Repeat the previous pixel for as long as its run lasts, or otherwise apply the next operation to it. */
+        n = 1;
+        if (p_qoi->run != 0)
+        {
+            n = (p_qoi->run < count) ? p_qoi->run : count;
+            p_qoi->run -= (uint8_t) n;
+        }
+        else
+        {
+            op = (p_qoi->p_data < p_qoi->p_end) ? *p_qoi->p_data++ : ILI9341_QOI_OP_PIXEL;
+            if (op == ILI9341_QOI_OP_PIXEL)
+            {
+                if ((uint32_t) (p_qoi->p_end - p_qoi->p_data) < pixel_size)
+                {
+                    /* Decode the rest of the pixels of the image as black. */
+                    p_qoi->is_corrupt = 1;
+                    p_qoi->p_data = p_qoi->p_end;
+                    p_qoi->red = 0;
+                    p_qoi->green = 0;
+                    p_qoi->blue = 0;
+                }
+                else if (pixel_size == 2)
+                {
+                    packed = ((uint32_t) p_qoi->p_data[0] << 8) | p_qoi->p_data[1];
+                    p_qoi->red = (uint8_t) (packed >> 11);
+                    p_qoi->green = (uint8_t) ((packed >> 5) & 0x3F);
+                    p_qoi->blue = (uint8_t) (packed & 0x1F);
+                    p_qoi->p_data += 2;
+                }
+                else
+                {
+                    p_qoi->red = p_qoi->p_data[0] >> 2;
+                    p_qoi->green = p_qoi->p_data[1] >> 2;
+                    p_qoi->blue = p_qoi->p_data[2] >> 2;
+                    p_qoi->p_data += 3;
+                }
+            }
+            else
+            {
+                switch (op & ILI9341_QOI_TAG_MASK)
+                {
+                    case ILI9341_QOI_OP_INDEX:
+                        packed = p_qoi->index[op];
+                        p_qoi->red = (uint8_t) (packed >> 16);
+                        p_qoi->green = (uint8_t) (packed >> 8);
+                        p_qoi->blue = (uint8_t) packed;
+                        break;
+                    case ILI9341_QOI_OP_DIFF:
+                        p_qoi->red += ((op >> 4) & 0x03) - 2;
+                        p_qoi->green += ((op >> 2) & 0x03) - 2;
+                        p_qoi->blue += (op & 0x03) - 2;
+                        break;
+                    case ILI9341_QOI_OP_LUMA:
+                        if (p_qoi->p_data >= p_qoi->p_end)
+                        {
+                            /* Decode this and the rest of the pixels of the image as black, just like a cut pixel operation. */
+                            p_qoi->is_corrupt = 1;
+                            p_qoi->red = 0;
+                            p_qoi->green = 0;
+                            p_qoi->blue = 0;
+                            break;
+                        }
+                        green_diff = (int8_t) ((op & 0x3F) - 32);
+                        p_qoi->red += green_diff - 8 + (*p_qoi->p_data >> 4);
+                        p_qoi->green += green_diff;
+                        p_qoi->blue += green_diff - 8 + (*p_qoi->p_data & 0x0F);
+                        p_qoi->p_data++;
+                        break;
+                    default:
+                        p_qoi->run = op & 0x3F; // The previous pixel is repeated once right now and then this many more times.
+                        break;
+                }
+                p_qoi->red &= p_qoi->red_blue_mask;
+                p_qoi->green &= 0x3F;
+                p_qoi->blue &= p_qoi->red_blue_mask;
+            }
+            p_qoi->index[(p_qoi->red * 3 + p_qoi->green * 5 + p_qoi->blue * 7) % ILI9341_QOI_INDEX_SIZE] =
+                ((uint32_t) p_qoi->red << 16) | ((uint32_t) p_qoi->green << 8) | p_qoi->blue;
+
+            /* Convert the new pixel into the Bits Per Pixel (BPP) type in which the pixels are being decoded. */
+            red = (p_qoi->image_bpp == ILI9341_BPP_16) ? (uint8_t) ((p_qoi->red << 1) | (p_qoi->red >> 4)) : p_qoi->red;
+            blue = (p_qoi->image_bpp == ILI9341_BPP_16) ? (uint8_t) ((p_qoi->blue << 1) | (p_qoi->blue >> 4)) : p_qoi->blue;
+            p_qoi->output = (p_qoi->output_bpp == ILI9341_BPP_16)
+                            ? (((uint32_t) (red >> 1) << 11) | ((uint32_t) p_qoi->green << 5) | (uint32_t) (blue >> 1))
+                            : (((uint32_t) red << 18) | ((uint32_t) p_qoi->green << 10) | ((uint32_t) blue << 2));
+        }
+
+        if (p_pixels != NULL)
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                if (p_qoi->output_bpp == ILI9341_BPP_16)
+                {
+                    *(uint16_t *) p_pixels = (uint16_t) p_qoi->output;
+                    p_pixels += sizeof(uint16_t);
+                }
+                else
+                {
+                    p_pixels[0] = (uint8_t) (p_qoi->output >> 16);
+                    p_pixels[1] = (uint8_t) (p_qoi->output >> 8);
+                    p_pixels[2] = (uint8_t) p_qoi->output;
+                    p_pixels += 3;
+                }
+            }
+        }
+        count -= n;
+    }
+}
+
+/** @} */
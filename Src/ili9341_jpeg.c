@@ -0,0 +1,1074 @@
+/** @addtogroup ili9341_jpeg
+ * @{
+ */
+
+#include "ili9341_jpeg.h"
+
+#define ILI9341_JPEG_MARKER_PREFIX      (0xFF)      /**< @brief Byte with which every JPEG marker starts. */
+#define ILI9341_JPEG_MARKER_SOF0        (0xC0)      /**< @brief JPEG marker of the frame header of a baseline image. */
+#define ILI9341_JPEG_MARKER_SOF1        (0xC1)      /**< @brief JPEG marker of the frame header of an extended sequential image with Huffman coding. */
+#define ILI9341_JPEG_MARKER_SOF15       (0xCF)      /**< @brief Last of the JPEG markers of the frame headers. */
+#define ILI9341_JPEG_MARKER_DHT         (0xC4)      /**< @brief JPEG marker of a Huffman table definition (which shares the range of the frame headers). */
+#define ILI9341_JPEG_MARKER_JPG         (0xC8)      /**< @brief Reserved JPEG marker (which shares the range of the frame headers). */
+#define ILI9341_JPEG_MARKER_DAC         (0xCC)      /**< @brief JPEG marker of an arithmetic coding conditioning definition (which shares the range of the frame headers). */
+#define ILI9341_JPEG_MARKER_RST0        (0xD0)      /**< @brief First of the JPEG restart markers. */
+#define ILI9341_JPEG_MARKER_RST7        (0xD7)      /**< @brief Last of the JPEG restart markers. */
+#define ILI9341_JPEG_MARKER_SOI         (0xD8)      /**< @brief JPEG marker of the start of an image. */
+#define ILI9341_JPEG_MARKER_EOI         (0xD9)      /**< @brief JPEG marker of the end of an image. */
+#define ILI9341_JPEG_MARKER_SOS         (0xDA)      /**< @brief JPEG marker of a scan header. */
+#define ILI9341_JPEG_MARKER_DQT         (0xDB)      /**< @brief JPEG marker of a quantization table definition. */
+#define ILI9341_JPEG_MARKER_DRI         (0xDD)      /**< @brief JPEG marker of a restart interval definition. */
+#define ILI9341_JPEG_MAX_COMPONENTS     (3)         /**< @brief Maximum number of components of the supported JPEG images. */
+#define ILI9341_JPEG_MAX_BLOCKS         (6)         /**< @brief Maximum number of 8x8 blocks of an MCU (i.e., 4 luma blocks and 2 chroma blocks with 4:2:0 subsampling). */
+#define ILI9341_JPEG_LOOKUP_BITS        (8)         /**< @brief Number of bits of the lookup table with which the shorter Huffman codes are decoded at once. */
+#define ILI9341_JPEG_IDCT_CONST_BITS    (13)        /**< @brief Number of fractional bits of the constants of the inverse DCT. */
+#define ILI9341_JPEG_IDCT_PASS1_BITS    (2)         /**< @brief Number of extra fractional bits that are kept between both passes of the inverse DCT. */
+#define ILI9341_JPEG_COEFFICIENT_LIMIT  (8191)      /**< @brief Largest magnitude of the DC predictors and of the dequantized coefficients, which only corrupt images exceed, so that no intermediate value of the first pass of the inverse DCT overflows 32 bits. */
+#define ILI9341_JPEG_WORKSPACE_LIMIT    (32767)     /**< @brief Largest magnitude of the results of the first pass of the inverse DCT, which only corrupt images exceed, so that no intermediate value of its second pass overflows 32 bits. */
+#define ILI9341_JPEG_FIX_0_298631336    (2446)      /**< @brief 0.298631336 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_0_390180644    (3196)      /**< @brief 0.390180644 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_0_541196100    (4433)      /**< @brief 0.541196100 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_0_765366865    (6270)      /**< @brief 0.765366865 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_0_899976223    (7373)      /**< @brief 0.899976223 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_1_175875602    (9633)      /**< @brief 1.175875602 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_1_501321110    (12299)     /**< @brief 1.501321110 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_1_847759065    (15137)     /**< @brief 1.847759065 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_1_961570560    (16069)     /**< @brief 1.961570560 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_2_053119869    (16819)     /**< @brief 2.053119869 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_2_562915447    (20995)     /**< @brief 2.562915447 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_FIX_3_072711026    (25172)     /**< @brief 3.072711026 in the fixed point format of the inverse DCT. */
+#define ILI9341_JPEG_COLOR_SHIFT        (16)        /**< @brief Number of fractional bits of the constants of the YCbCr to RGB conversion. */
+#define ILI9341_JPEG_COLOR_HALF         (1L << (ILI9341_JPEG_COLOR_SHIFT - 1))  /**< @brief Half in the fixed point format of the YCbCr to RGB conversion. */
+#define ILI9341_JPEG_FIX_1_40200        (91881)     /**< @brief Weight of Cr in Red, in the fixed point format of the YCbCr to RGB conversion. */
+#define ILI9341_JPEG_FIX_0_34414        (22554)     /**< @brief Weight of Cb in Green (negated), in the fixed point format of the YCbCr to RGB conversion. */
+#define ILI9341_JPEG_FIX_0_71414        (46802)     /**< @brief Weight of Cr in Green (negated), in the fixed point format of the YCbCr to RGB conversion. */
+#define ILI9341_JPEG_FIX_1_77200        (116130)    /**< @brief Weight of Cb in Blue, in the fixed point format of the YCbCr to RGB conversion. */
+#define ILI9341_JPEG_DESCALE(x, n)      (((x) + (1L << ((n) - 1))) >> (n))                  /**< @brief Divides a fixed point value by <tt>2^n</tt> , rounding to the nearest integer. */
+#define ILI9341_JPEG_CLAMP(x)           (((x) < 0) ? 0 : (((x) > 255) ? 255 : (x)))         /**< @brief Clamps a sample into the range of 0 up to 255. */
+#define ILI9341_JPEG_LIMIT(x, limit)    (((x) < -(limit)) ? -(limit) : (((x) > (limit)) ? (limit) : (x)))  /**< @brief Clamps a value into the range of <tt>-limit</tt> up to \c limit . */
+
+/**@brief	ILI9341 JPEG Huffman Table parameters structure.
+ *
+ * @details This contains a Huffman table of a JPEG image, arranged so that its codes of up to
+ *          @ref ILI9341_JPEG_LOOKUP_BITS bits are decoded with a single lookup and the longer ones by comparing them
+ *          against the largest code of each length.
+ */
+typedef struct
+{
+    int32_t max_code[17];                               //!< Largest code of each length (i.e., from 1 up to 16 bits), or -1 if there is no code of that length.
+    int32_t value_offset[17];                           //!< Offset that, added to a code of each length, gives the index of its value in @ref values .
+    uint16_t lookup[1 << ILI9341_JPEG_LOOKUP_BITS];     //!< Length (in the Most Significant Byte) and value (in the Least Significant Byte) of the code that each combination of the next @ref ILI9341_JPEG_LOOKUP_BITS bits starts with, or 0 if that code is longer.
+    uint8_t values[256];                                //!< Values of the codes, sorted by their codes.
+} ILI9341_jpeg_huffman_def_t;
+
+/**@brief	ILI9341 JPEG Component parameters structure.
+ *
+ * @details This contains the parameters of one of the components (i.e., Y, Cb or Cr) of a JPEG image.
+ */
+typedef struct
+{
+    uint8_t id;                 //!< Identifier of the component within the frame and scan headers.
+    uint8_t h;                  //!< Horizontal sampling factor of the component.
+    uint8_t v;                  //!< Vertical sampling factor of the component.
+    uint8_t quant_table;        //!< Index of the quantization table of the component.
+    uint8_t dc_table;           //!< Index, within @ref ILI9341_jpeg_decoder_def_t::huffman , of the DC Huffman table of the component.
+    uint8_t ac_table;           //!< Index, within @ref ILI9341_jpeg_decoder_def_t::huffman , of the AC Huffman table of the component.
+    int32_t dc_predictor;       //!< DC coefficient of the previous block of the component.
+} ILI9341_jpeg_component_def_t;
+
+/**@brief	ILI9341 JPEG Decoder parameters structure.
+ *
+ * @details This contains the whole state with which a JPEG image is decoded, from the source of its bytes up to the
+ *          samples of the MCU that is currently being decoded.
+ */
+typedef struct
+{
+    const uint8_t *p_next;                                                      //!< Pointer to the next byte of the JPEG image to be read.
+    const uint8_t *p_end;                                                       //!< Pointer right after the last byte of the JPEG image that is available in memory.
+    ILI9341_jpeg_read_t read;                                                   //!< Function with which the next chunk of the JPEG image is read once @ref p_next reaches @ref p_end , or NULL if the whole JPEG image is in memory.
+    void *p_context;                                                            //!< Pointer that is given as is to @ref read .
+    uint32_t bit_buffer;                                                        //!< Bits of the entropy coded data that have been read but not consumed yet, aligned to the Most Significant Bit.
+    uint8_t bit_count;                                                          //!< Number of bits in @ref bit_buffer .
+    uint8_t padding_bits;                                                       //!< Number of the last bits in @ref bit_buffer that are zeros padded after a marker rather than entropy coded data.
+    uint8_t marker;                                                             //!< Marker at which the entropy coded data has stopped, or 0 if none has been found yet.
+    uint8_t is_eof;                                                             //!< Whether the JPEG image ended (1) or not (0).
+    uint8_t is_corrupt;                                                         //!< Whether the entropy coded data was found to be corrupt or too short (1) or not (0).
+    uint8_t component_count;                                                    //!< Number of components of the JPEG image.
+    uint8_t max_h;                                                              //!< Largest horizontal sampling factor of the components, which is the number of luma blocks per MCU horizontally.
+    uint8_t max_v;                                                              //!< Largest vertical sampling factor of the components, which is the number of luma blocks per MCU vertically.
+    uint16_t width;                                                             //!< Number of columns of the JPEG image.
+    uint16_t height;                                                            //!< Number of rows of the JPEG image.
+    uint16_t restart_interval;                                                  //!< Number of MCUs between restart markers, or 0 if there are no restart markers.
+    uint8_t defined_tables;                                                     //!< Tables that the JPEG image has defined so far, where bit i stands for @ref quant [i] and bit 4 + i for @ref huffman [i], since the ones of a previous image must never be used.
+    uint16_t quant[4][64];                                                      //!< Quantization tables, in zigzag order.
+    ILI9341_jpeg_huffman_def_t huffman[4];                                      //!< Huffman tables, where the first two are the DC ones and the last two the AC ones.
+    ILI9341_jpeg_component_def_t components[ILI9341_JPEG_MAX_COMPONENTS];       //!< Components of the JPEG image.
+    int32_t coefficients[64];                                                   //!< Dequantized coefficients of the block that is currently being decoded, in natural order.
+    uint8_t samples[ILI9341_JPEG_MAX_BLOCKS][64];                               //!< Samples of the blocks of the MCU that is currently being decoded, where the luma blocks come first in raster order and are followed by the Cb and Cr blocks.
+} ILI9341_jpeg_decoder_def_t;
+
+/**@brief   Natural order (i.e., row by row) index of each of the coefficients of a block in zigzag order.
+ */
+static const uint8_t zigzag[64] =
+{
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+/**@brief   Decoder with which the JPEG images are decoded, which is shared by all the ILI9341 Devices.
+ */
+static ILI9341_jpeg_decoder_def_t jpeg_decoder;
+
+/**@brief   Buffer into which @ref ili9341_draw_jpeg_stream reads the JPEG image in chunks.
+ */
+static uint8_t input_buffer[ILI9341_JPEG_INPUT_BUFFER_SIZE];
+
+/**@brief   Tile buffers into which the MCUs are converted into 16 bits per pixel pixels, where one of them is filled
+ *          while the other one is being sent by DMA.
+ */
+static uint16_t tile_buffers[2][ILI9341_JPEG_TILE_PIXELS];
+
+/**@brief   Flags that tell whether each of @ref tile_buffers is still in use by the DMA (1) or not (0), as given to
+ *          @ref ili9341_write_pixels_16bpp .
+ */
+static volatile uint8_t is_tile_buffer_in_use[2];
+
+/**@brief   Decodes the JPEG image whose source has been set in @ref jpeg_decoder onto the ILI9341 3.2" TFT LCD
+ *          Display.
+ *
+ * @details The MCU rows of the image are split into tiles of as many MCUs as fit in one of the @ref tile_buffers ,
+ *          where the visible pixels of each tile are converted into its tile buffer and sent through an Address Window
+ *          of their own while the next tile is being decoded into the other tile buffer.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x             Column of the top-left corner of the image.
+ * @param y             Row of the top-left corner of the image.
+ *
+ * @retval  ILI9341_EC_OK if drawing the image was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NA if no pixel of the image lies within the Clip Rectangle or if the @ref ili9341 is not
+ *          currently using the 16 bits per pixel Bits Per Pixel (BPP) type with the ILI9341 Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if the image is not a supported JPEG image, if its entropy coded data is corrupt or if
+ *          something else went wrong with the SPI.
+ */
+static ILI9341_Status ili9341_decode_jpeg(ILI9341_handle_t *p_handle, int16_t x, int16_t y);
+
+/**@brief   Reads the next byte of the JPEG image, refilling @ref input_buffer whenever needed.
+ *
+ * @param[in,out] p_decoder Pointer to the JPEG Decoder.
+ *
+ * @return  The next byte of the JPEG image, or 0 if it has ended (in which case
+ *          @ref ILI9341_jpeg_decoder_def_t::is_eof is set).
+ */
+static uint8_t ili9341_jpeg_read_byte(ILI9341_jpeg_decoder_def_t *p_decoder);
+
+/**@brief   Reads the next big-endian 16 bit value of the JPEG image.
+ *
+ * @param[in,out] p_decoder Pointer to the JPEG Decoder.
+ *
+ * @return  The next 16 bit value of the JPEG image.
+ */
+static uint16_t ili9341_jpeg_read_u16(ILI9341_jpeg_decoder_def_t *p_decoder);
+
+/**@brief   Reads the markers of the JPEG image, together with the tables and headers that they hold, up to and
+ *          including its scan header.
+ *
+ * @param[in,out] p_decoder Pointer to the JPEG Decoder.
+ *
+ * @retval  ILI9341_EC_OK if the JPEG image is supported and its entropy coded data is next.
+ * @retval  ILI9341_EC_ERR if the JPEG image is malformed, ends too soon or is not supported.
+ */
+static ILI9341_Status ili9341_jpeg_read_headers(ILI9341_jpeg_decoder_def_t *p_decoder);
+
+/**@brief   Reads the Huffman tables of a Define Huffman Table marker segment.
+ *
+ * @param[in,out] p_decoder Pointer to the JPEG Decoder.
+ * @param length            Length of the marker segment, excluding its length field.
+ *
+ * @retval  ILI9341_EC_OK if the Huffman tables were successfully read.
+ * @retval  ILI9341_EC_ERR if the marker segment is malformed.
+ */
+static ILI9341_Status ili9341_jpeg_read_huffman_tables(ILI9341_jpeg_decoder_def_t *p_decoder, int32_t length);
+
+/**@brief   Refills the bit buffer of the JPEG Decoder with the next bytes of the entropy coded data, up to at least 25
+ *          bits.
+ *
+ * @details The stuffed zero bytes that follow each 0xFF byte are dropped. Once a marker is found, zero bits are padded
+ *          instead and any of them that gets consumed flags the entropy coded data as corrupt.
+ *
+ * @param[in,out] p_decoder Pointer to the JPEG Decoder.
+ */
+static void ili9341_jpeg_fill_bits(ILI9341_jpeg_decoder_def_t *p_decoder);
+
+/**@brief   Consumes the given number of bits from the bit buffer of the JPEG Decoder.
+ *
+ * @param[in,out] p_decoder Pointer to the JPEG Decoder.
+ * @param count             Number of bits to be consumed, which must not exceed the number of bits in the buffer.
+ */
+static void ili9341_jpeg_consume_bits(ILI9341_jpeg_decoder_def_t *p_decoder, uint8_t count);
+
+/**@brief   Decodes the next Huffman coded value of the entropy coded data.
+ *
+ * @param[in,out] p_decoder Pointer to the JPEG Decoder.
+ * @param[in] p_table       Pointer to the Huffman table with which the value is coded.
+ *
+ * @return  The decoded value, or 0 if no code of \p p_table matches (in which case the entropy coded data is flagged
+ *          as corrupt).
+ */
+static uint8_t ili9341_jpeg_decode_huffman(ILI9341_jpeg_decoder_def_t *p_decoder, const ILI9341_jpeg_huffman_def_t *p_table);
+
+/**@brief   Reads the next given number of bits of the entropy coded data as a signed coefficient, as given by the
+ *          magnitude category with which it was coded.
+ *
+ * @param[in,out] p_decoder Pointer to the JPEG Decoder.
+ * @param size              Number of bits of the coefficient (i.e., from 0 up to 15).
+ *
+ * @return  The signed coefficient.
+ */
+static int32_t ili9341_jpeg_receive_extend(ILI9341_jpeg_decoder_def_t *p_decoder, uint8_t size);
+
+/**@brief   Decodes the next block of the entropy coded data.
+ *
+ * @param[in,out] p_decoder     Pointer to the JPEG Decoder.
+ * @param[in,out] p_component   Pointer to the component of the block.
+ * @param is_visible            Whether the dequantized coefficients of the block are to be written into
+ *                              @ref ILI9341_jpeg_decoder_def_t::coefficients (1), or only decoded to reach the next
+ *                              block (0).
+ *
+ * @return  1 if any of the AC coefficients of the block is not zero, or 0 otherwise.
+ */
+static uint8_t ili9341_jpeg_decode_block(ILI9341_jpeg_decoder_def_t *p_decoder, ILI9341_jpeg_component_def_t *p_component, uint8_t is_visible);
+
+/**@brief   Applies the inverse DCT to the dequantized coefficients of a block.
+ *
+ * @details This is the separable integer inverse DCT of Loeffler, Ligtenberg and Moschytz (the same as the "islow"
+ *          method of the Independent JPEG Group), which takes 12 multiplications per row and per column.
+ *
+ * @param[in] p_coefficients    Pointer to the 64 dequantized coefficients of the block, in natural order, each of them
+ *                              within the range of <tt>-ILI9341_JPEG_COEFFICIENT_LIMIT</tt> up to
+ *                              @ref ILI9341_JPEG_COEFFICIENT_LIMIT .
+ * @param[out] p_samples        Pointer to the memory into which the 64 samples of the block are to be written, row by
+ *                              row.
+ */
+static void ili9341_jpeg_idct(const int32_t *p_coefficients, uint8_t *p_samples);
+
+/**@brief   Skips the entropy coded data up to the next restart marker, and resets the DC predictors and the bit
+ *          buffer of the JPEG Decoder.
+ *
+ * @param[in,out] p_decoder Pointer to the JPEG Decoder.
+ */
+static void ili9341_jpeg_restart(ILI9341_jpeg_decoder_def_t *p_decoder);
+
+ILI9341_Status ili9341_draw_jpeg(ILI9341_handle_t *p_handle, int16_t x, int16_t y, const uint8_t *p_data, uint32_t size)
+{
+    if (p_data == NULL)
+    {
+        return ILI9341_EC_ERR;
+    }
+
+    jpeg_decoder.p_next = p_data;
+    jpeg_decoder.p_end = p_data + size;
+    jpeg_decoder.read = NULL;
+    jpeg_decoder.p_context = NULL;
+    return ili9341_decode_jpeg(p_handle, x, y);
+}
+
+ILI9341_Status ili9341_draw_jpeg_stream(ILI9341_handle_t *p_handle, int16_t x, int16_t y, ILI9341_jpeg_read_t read, void *p_context)
+{
+    if (read == NULL)
+    {
+        return ILI9341_EC_ERR;
+    }
+
+    jpeg_decoder.p_next = input_buffer;
+    jpeg_decoder.p_end = input_buffer;
+    jpeg_decoder.read = read;
+    jpeg_decoder.p_context = p_context;
+    return ili9341_decode_jpeg(p_handle, x, y);
+}
+
+static ILI9341_Status ili9341_decode_jpeg(ILI9341_handle_t *p_handle, int16_t x, int16_t y)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret;
+    /** <b>Local \c ILI9341_jpeg_decoder_def_t pointer p_decoder:</b> Points to the JPEG Decoder. */
+    ILI9341_jpeg_decoder_def_t *p_decoder = &jpeg_decoder;
+    /** <b>Local \c ILI9341_clip_rect_def_t pointer p_clip:</b> Points to the Clip Rectangle of the ILI9341 Device. */
+    const ILI9341_clip_rect_def_t *p_clip = &p_handle->clip_rect;
+    /** <b>Local \c ILI9341_jpeg_component_def_t pointer p_component:</b> Points to the component whose blocks are currently being decoded. */
+    ILI9341_jpeg_component_def_t *p_component;
+    /** <b>Local \c int32_t variables vx0, vy0, vx1 and vy1:</b> Left-most column, top-most row, right-most column and bottom-most row of the image after being clipped to the Clip Rectangle. */
+    int32_t vx0, vy0, vx1, vy1;
+    /** <b>Local \c int32_t variables tx0, ty0, tx1 and ty1:</b> Left-most column, top-most row, right-most column and bottom-most row of the visible part of the current tile. */
+    int32_t tx0, ty0, tx1, ty1;
+    /** <b>Local \c int32_t variables mcu_x and mcu_y:</b> Column and row of the top-left corner of the current MCU. */
+    int32_t mcu_x, mcu_y;
+    /** <b>Local \c int32_t variables px0, py0, px1 and py1:</b> First and last columns and rows, relative to the current MCU, of its pixels that lie within the visible part of the current tile. */
+    int32_t px0, py0, px1, py1;
+    /** <b>Local \c uint16_t variables mcu_width and mcu_height:</b> Number of columns and rows of each MCU. */
+    uint16_t mcu_width, mcu_height;
+    /** <b>Local \c uint16_t variables mcu_columns and mcu_rows:</b> Number of MCUs of each MCU row and number of MCU rows of the image. */
+    uint16_t mcu_columns, mcu_rows;
+    /** <b>Local \c uint16_t variable tile_mcus:</b> Maximum number of MCUs of each tile. */
+    uint16_t tile_mcus;
+    /** <b>Local \c uint16_t variable tile_width:</b> Number of columns of the visible part of the current tile. */
+    uint16_t tile_width;
+    /** <b>Local \c uint16_t variable restart_count:</b> Number of MCUs that are left until the next restart marker. */
+    uint16_t restart_count;
+    /** <b>Local \c uint16_t pointer p_pixel:</b> Points to the pixel of the current tile buffer into which the next pixel of the current MCU is to be converted. */
+    uint16_t *p_pixel;
+    /** <b>Local \c uint8_t variable block:</b> Index of the block of the current MCU that is currently being decoded. */
+    uint8_t block;
+    /** <b>Local \c uint8_t variable is_tile_visible:</b> Whether any pixel of the current tile lies within the Clip Rectangle (1) or not (0). */
+    uint8_t is_tile_visible;
+    /** <b>Local \c uint8_t variable is_mcu_visible:</b> Whether any pixel of the current MCU lies within the Clip Rectangle (1) or not (0). */
+    uint8_t is_mcu_visible;
+    /** <b>Local \c uint8_t variable has_ac:</b> Whether any of the AC coefficients of the current block is not zero (1) or not (0). */
+    uint8_t has_ac;
+    /** <b>Local \c uint8_t variable index:</b> Index of the tile buffer into which the current tile is being converted. */
+    uint8_t index = 0;
+    /** <b>Local \c uint8_t variables shift_x and shift_y:</b> Number of bits by which the columns and rows of the luma samples are shifted to get the ones of the chroma samples. */
+    uint8_t shift_x, shift_y;
+    /** <b>Local \c int32_t variables luma, cb and cr:</b> Samples of the pixel that is currently being converted, with the chroma ones centered at zero. */
+    int32_t luma, cb, cr;
+    /** <b>Local \c int32_t variables red, green and blue:</b> Channels of the pixel that is currently being converted. */
+    int32_t red, green, blue;
+
+    if (get_ili9341_bpp_type(p_handle) != ILI9341_BPP_16)
+    {
+        return ILI9341_EC_NA;
+    }
+    p_decoder->bit_buffer = 0;
+    p_decoder->bit_count = 0;
+    p_decoder->padding_bits = 0;
+    p_decoder->marker = 0;
+    p_decoder->is_eof = 0;
+    p_decoder->is_corrupt = 0;
+    p_decoder->restart_interval = 0;
+    p_decoder->defined_tables = 0;
+    ret = ili9341_jpeg_read_headers(p_decoder);
+    if (ret != ILI9341_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Clip the image to the Clip Rectangle and reject it, before decoding any MCU, if nothing of it is left. */
+    vx0 = (x < p_clip->x0) ? p_clip->x0 : x;
+    vy0 = (y < p_clip->y0) ? p_clip->y0 : y;
+    vx1 = (int32_t) x + p_decoder->width - 1;
+    vy1 = (int32_t) y + p_decoder->height - 1;
+    vx1 = (vx1 > p_clip->x1) ? p_clip->x1 : vx1;
+    vy1 = (vy1 > p_clip->y1) ? p_clip->y1 : vy1;
+    if ((vx0 > vx1) || (vy0 > vy1))
+    {
+        return ILI9341_EC_NA;
+    }
+    mcu_width = (uint16_t) (8 * p_decoder->max_h);
+    mcu_height = (uint16_t) (8 * p_decoder->max_v);
+    mcu_columns = (uint16_t) ((p_decoder->width + mcu_width - 1) / mcu_width);
+    mcu_rows = (uint16_t) ((vy1 - y) / mcu_height + 1); // The MCU rows below the Clip Rectangle are not decoded at all.
+    tile_mcus = (uint16_t) (ILI9341_JPEG_TILE_PIXELS / ((uint32_t) mcu_width * mcu_height));
+    shift_x = (uint8_t) (p_decoder->max_h - 1);
+    shift_y = (uint8_t) (p_decoder->max_v - 1);
+    restart_count = p_decoder->restart_interval;
+
+    for (uint16_t row = 0; row < mcu_rows; row++)
+    {
+        mcu_y = (int32_t) y + (int32_t) row * mcu_height;
+        ty0 = (mcu_y < vy0) ? vy0 : mcu_y;
+        ty1 = (mcu_y + mcu_height - 1 > vy1) ? vy1 : (mcu_y + mcu_height - 1);
+        for (uint16_t column = 0; column < mcu_columns; column = (uint16_t) (column + tile_mcus))
+        {
+            /* Find the visible part of the tile and, if any, wait until its tile buffer is no longer in use by the DMA. */
+            mcu_x = (int32_t) x + (int32_t) column * mcu_width;
+            tx0 = (mcu_x < vx0) ? vx0 : mcu_x;
+            tx1 = mcu_x + (int32_t) tile_mcus * mcu_width - 1;
+            tx1 = (tx1 > vx1) ? vx1 : tx1;
+            is_tile_visible = (ty0 <= ty1) && (tx0 <= tx1);
+            tile_width = (uint16_t) (tx1 - tx0 + 1);
+            if (is_tile_visible)
+            {
+                while (is_tile_buffer_in_use[index] != 0);
+            }
+
+            for (uint16_t mcu = column; (mcu < column + tile_mcus) && (mcu < mcu_columns); mcu++)
+            {
+                if (p_decoder->restart_interval != 0)
+                {
+                    if (restart_count == 0)
+                    {
+                        ili9341_jpeg_restart(p_decoder);
+                        restart_count = p_decoder->restart_interval;
+                    }
+                    restart_count--;
+                }
+
+                /* Decode all the blocks of the MCU, but only apply the inverse DCT to the ones of a visible MCU. */
+                mcu_x = (int32_t) x + (int32_t) mcu * mcu_width;
+                px0 = ((tx0 > mcu_x) ? tx0 : mcu_x) - mcu_x;
+                px1 = ((tx1 < mcu_x + mcu_width - 1) ? tx1 : (mcu_x + mcu_width - 1)) - mcu_x;
+                py0 = ty0 - mcu_y;
+                py1 = ty1 - mcu_y;
+                is_mcu_visible = is_tile_visible && (px0 <= px1);
+                block = 0;
+                for (uint8_t i = 0; i < p_decoder->component_count; i++)
+                {
+                    p_component = &p_decoder->components[i];
+                    for (uint8_t j = 0; j < p_component->h * p_component->v; j++, block++)
+                    {
+                        has_ac = ili9341_jpeg_decode_block(p_decoder, p_component, is_mcu_visible);
+                        if (!is_mcu_visible)
+                        {
+                            continue;
+                        }
+                        if (has_ac)
+                        {
+                            ili9341_jpeg_idct(p_decoder->coefficients, p_decoder->samples[block]);
+                        }
+                        else
+                        {
+                            /* A block with only a DC coefficient is flat, so it does not need the inverse DCT. */
+                            luma = ILI9341_JPEG_DESCALE(p_decoder->coefficients[0] * (1L << ILI9341_JPEG_IDCT_PASS1_BITS), ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+                            memset(p_decoder->samples[block], ILI9341_JPEG_CLAMP(luma), 64);
+                        }
+                    }
+                }
+                if (!is_mcu_visible)
+                {
+                    continue;
+                }
+
+                /* Convert the visible pixels of the MCU into its place within the tile buffer. */
+                for (int32_t py = py0; py <= py1; py++)
+                {
+                    p_pixel = &tile_buffers[index][(uint32_t) (mcu_y + py - ty0) * tile_width + (uint32_t) (mcu_x + px0 - tx0)];
+                    for (int32_t px = px0; px <= px1; px++)
+                    {
+                        luma = p_decoder->samples[(py >> 3) * p_decoder->max_h + (px >> 3)][((py & 7) << 3) | (px & 7)];
+                        if (p_decoder->component_count == 1)
+                        {
+                            red = luma;
+                            green = luma;
+                            blue = luma;
+                        }
+                        else
+                        {
+                            block = (uint8_t) (p_decoder->max_h * p_decoder->max_v);
+                            cb = p_decoder->samples[block][((py >> shift_y) << 3) | (px >> shift_x)] - 128;
+                            cr = p_decoder->samples[block + 1][((py >> shift_y) << 3) | (px >> shift_x)] - 128;
+                            red = luma + ((ILI9341_JPEG_FIX_1_40200 * cr + ILI9341_JPEG_COLOR_HALF) >> ILI9341_JPEG_COLOR_SHIFT);
+                            green = luma + ((-ILI9341_JPEG_FIX_0_34414 * cb - ILI9341_JPEG_FIX_0_71414 * cr + ILI9341_JPEG_COLOR_HALF) >> ILI9341_JPEG_COLOR_SHIFT);
+                            blue = luma + ((ILI9341_JPEG_FIX_1_77200 * cb + ILI9341_JPEG_COLOR_HALF) >> ILI9341_JPEG_COLOR_SHIFT);
+                            red = ILI9341_JPEG_CLAMP(red);
+                            green = ILI9341_JPEG_CLAMP(green);
+                            blue = ILI9341_JPEG_CLAMP(blue);
+                        }
+                        *p_pixel++ = (uint16_t) (((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3));
+                    }
+                }
+            }
+
+            /* Send the visible part of the tile through an Address Window of its own while the next tile is decoded into the other tile buffer. */
+            if (is_tile_visible)
+            {
+                ret = ili9341_set_window(p_handle, (uint16_t) tx0, (uint16_t) ty0, (uint16_t) tx1, (uint16_t) ty1);
+                if (ret == ILI9341_EC_OK)
+                {
+                    ret = ili9341_write_pixels_16bpp(p_handle, tile_buffers[index], (uint32_t) tile_width * (uint32_t) (ty1 - ty0 + 1), &is_tile_buffer_in_use[index]);
+                }
+                if (ret != ILI9341_EC_OK)
+                {
+                    return ret;
+                }
+                index ^= 1;
+            }
+        }
+    }
+
+    return p_decoder->is_corrupt ? ILI9341_EC_ERR : ILI9341_EC_OK;
+}
+
+static uint8_t ili9341_jpeg_read_byte(ILI9341_jpeg_decoder_def_t *p_decoder)
+{
+    /** <b>Local \c uint32_t variable size:</b> Number of bytes that were read into @ref input_buffer . */
+    uint32_t size;
+
+    if (p_decoder->p_next == p_decoder->p_end)
+    {
+        size = (p_decoder->read == NULL) ? 0 : p_decoder->read(p_decoder->p_context, input_buffer, ILI9341_JPEG_INPUT_BUFFER_SIZE);
+        if (size == 0)
+        {
+            p_decoder->is_eof = 1;
+            return 0;
+        }
+        p_decoder->p_next = input_buffer;
+        p_decoder->p_end = input_buffer + size;
+    }
+    return *p_decoder->p_next++;
+}
+
+static uint16_t ili9341_jpeg_read_u16(ILI9341_jpeg_decoder_def_t *p_decoder)
+{
+    /** <b>Local \c uint16_t variable value:</b> Most Significant Byte of the value. */
+    uint16_t value = ili9341_jpeg_read_byte(p_decoder);
+
+    return (uint16_t) ((value << 8) | ili9341_jpeg_read_byte(p_decoder));
+}
+
+static ILI9341_Status ili9341_jpeg_read_headers(ILI9341_jpeg_decoder_def_t *p_decoder)
+{
+    /** <b>Local \c uint8_t variable marker:</b> Marker that is currently being read. */
+    uint8_t marker;
+    /** <b>Local \c int32_t variable length:</b> Number of bytes of the current marker segment that have not been read yet. */
+    int32_t length;
+    /** <b>Local \c uint8_t variable value:</b> Byte of the current marker segment that is currently being read. */
+    uint8_t value;
+    /** <b>Local \c uint8_t variable is_frame_read:</b> Whether the frame header has been read (1) or not (0). */
+    uint8_t is_frame_read = 0;
+    /** <b>Local \c ILI9341_jpeg_component_def_t pointer p_component:</b> Points to the component whose parameters are currently being read. */
+    ILI9341_jpeg_component_def_t *p_component;
+
+    if ((ili9341_jpeg_read_byte(p_decoder) != ILI9341_JPEG_MARKER_PREFIX) || (ili9341_jpeg_read_byte(p_decoder) != ILI9341_JPEG_MARKER_SOI))
+    {
+        return ILI9341_EC_ERR;
+    }
+
+    while (1)
+    {
+        /* Find the next marker, skipping its fill bytes, and read the length of its marker segment. */
+        if (ili9341_jpeg_read_byte(p_decoder) != ILI9341_JPEG_MARKER_PREFIX)
+        {
+            return ILI9341_EC_ERR;
+        }
+        do
+        {
+            marker = ili9341_jpeg_read_byte(p_decoder);
+        } while ((marker == ILI9341_JPEG_MARKER_PREFIX) && !p_decoder->is_eof);
+        if (p_decoder->is_eof || (marker == ILI9341_JPEG_MARKER_EOI))
+        {
+            return ILI9341_EC_ERR;
+        }
+        length = (int32_t) ili9341_jpeg_read_u16(p_decoder) - 2;
+        if (length < 0)
+        {
+            return ILI9341_EC_ERR;
+        }
+
+        switch (marker)
+        {
+            case ILI9341_JPEG_MARKER_SOF0:
+            case ILI9341_JPEG_MARKER_SOF1:
+                if ((ili9341_jpeg_read_byte(p_decoder) != 8) || (length < 6))
+                {
+                    return ILI9341_EC_ERR; // Only 8 bit samples are supported.
+                }
+                p_decoder->height = ili9341_jpeg_read_u16(p_decoder);
+                p_decoder->width = ili9341_jpeg_read_u16(p_decoder);
+                p_decoder->component_count = ili9341_jpeg_read_byte(p_decoder);
+                if ((p_decoder->width == 0) || (p_decoder->height == 0) || ((p_decoder->component_count != 1) && (p_decoder->component_count != ILI9341_JPEG_MAX_COMPONENTS))
+                    || (length != 6 + 3 * p_decoder->component_count))
+                {
+                    return ILI9341_EC_ERR;
+                }
+                p_decoder->max_h = 1;
+                p_decoder->max_v = 1;
+                for (uint8_t i = 0; i < p_decoder->component_count; i++)
+                {
+                    p_component = &p_decoder->components[i];
+                    p_component->id = ili9341_jpeg_read_byte(p_decoder);
+                    value = ili9341_jpeg_read_byte(p_decoder);
+                    p_component->h = value >> 4;
+                    p_component->v = value & 0x0F;
+                    p_component->quant_table = ili9341_jpeg_read_byte(p_decoder);
+                    if (p_decoder->component_count == 1)
+                    {
+                        p_component->h = 1; // The blocks of a single component scan are not interleaved, so its MCU is always a single block.
+                        p_component->v = 1;
+                    }
+                    if ((p_component->h < 1) || (p_component->h > 2) || (p_component->v < 1) || (p_component->v > 2)
+                        || ((i != 0) && ((p_component->h != 1) || (p_component->v != 1))) || (p_component->quant_table > 3))
+                    {
+                        return ILI9341_EC_ERR; // Only the luma may be subsampled, and only by 1 or 2.
+                    }
+                    p_decoder->max_h = (p_component->h > p_decoder->max_h) ? p_component->h : p_decoder->max_h;
+                    p_decoder->max_v = (p_component->v > p_decoder->max_v) ? p_component->v : p_decoder->max_v;
+                }
+                is_frame_read = 1;
+                length = 0;
+                break;
+            case ILI9341_JPEG_MARKER_DHT:
+                if (ili9341_jpeg_read_huffman_tables(p_decoder, length) != ILI9341_EC_OK)
+                {
+                    return ILI9341_EC_ERR;
+                }
+                length = 0;
+                break;
+            case ILI9341_JPEG_MARKER_DQT:
+                while (length > 0)
+                {
+                    value = ili9341_jpeg_read_byte(p_decoder);
+                    if (((value & 0x0F) > 3) || (length < 1 + ((value >> 4) ? 128 : 64)))
+                    {
+                        return ILI9341_EC_ERR;
+                    }
+                    for (uint8_t i = 0; i < 64; i++)
+                    {
+                        p_decoder->quant[value & 0x0F][i] = (value >> 4) ? ili9341_jpeg_read_u16(p_decoder) : ili9341_jpeg_read_byte(p_decoder);
+                    }
+                    p_decoder->defined_tables |= (uint8_t) (1U << (value & 0x0F));
+                    length -= 1 + ((value >> 4) ? 128 : 64);
+                }
+                break;
+            case ILI9341_JPEG_MARKER_DRI:
+                if (length != 2)
+                {
+                    return ILI9341_EC_ERR;
+                }
+                p_decoder->restart_interval = ili9341_jpeg_read_u16(p_decoder);
+                length = 0;
+                break;
+            case ILI9341_JPEG_MARKER_SOS:
+                /* Only a single scan that interleaves all the components is supported, whose entropy coded data follows right after its header. */
+                if (!is_frame_read || (ili9341_jpeg_read_byte(p_decoder) != p_decoder->component_count) || (length != 4 + 2 * p_decoder->component_count))
+                {
+                    return ILI9341_EC_ERR;
+                }
+                for (uint8_t i = 0; i < p_decoder->component_count; i++)
+                {
+                    p_component = &p_decoder->components[i];
+                    if (ili9341_jpeg_read_byte(p_decoder) != p_component->id)
+                    {
+                        return ILI9341_EC_ERR;
+                    }
+                    value = ili9341_jpeg_read_byte(p_decoder);
+                    if (((value >> 4) > 1) || ((value & 0x0F) > 1))
+                    {
+                        return ILI9341_EC_ERR;
+                    }
+                    p_component->dc_table = value >> 4;
+                    p_component->ac_table = (uint8_t) (2 + (value & 0x0F));
+                    p_component->dc_predictor = 0;
+                    if (!(p_decoder->defined_tables & (1U << p_component->quant_table)) || !(p_decoder->defined_tables & (1U << (4 + p_component->dc_table)))
+                        || !(p_decoder->defined_tables & (1U << (4 + p_component->ac_table))))
+                    {
+                        return ILI9341_EC_ERR; // The scan uses a table that the JPEG image has not defined.
+                    }
+                }
+                for (uint8_t i = 0; i < 3; i++)
+                {
+                    ili9341_jpeg_read_byte(p_decoder); // Spectral selection and successive approximation, which are fixed for sequential images.
+                }
+                return p_decoder->is_eof ? ILI9341_EC_ERR : ILI9341_EC_OK;
+            default:
+                if ((marker > ILI9341_JPEG_MARKER_SOF1) && (marker <= ILI9341_JPEG_MARKER_SOF15)
+                    && (marker != ILI9341_JPEG_MARKER_JPG) && (marker != ILI9341_JPEG_MARKER_DAC))
+                {
+                    return ILI9341_EC_ERR; // Progressive, lossless, hierarchical and arithmetic coded images are not supported.
+                }
+                break; // Any other marker segment (e.g., APPn or COM) is skipped.
+        }
+        for (; length > 0; length--)
+        {
+            ili9341_jpeg_read_byte(p_decoder);
+        }
+        if (p_decoder->is_eof)
+        {
+            return ILI9341_EC_ERR;
+        }
+    }
+}
+
+static ILI9341_Status ili9341_jpeg_read_huffman_tables(ILI9341_jpeg_decoder_def_t *p_decoder, int32_t length)
+{
+    /** <b>Local \c ILI9341_jpeg_huffman_def_t pointer p_table:</b> Points to the Huffman table that is currently being read. */
+    ILI9341_jpeg_huffman_def_t *p_table;
+    /** <b>Local \c uint8_t array counts:</b> Number of codes of each length (i.e., from 1 up to 16 bits). */
+    uint8_t counts[16];
+    /** <b>Local \c uint8_t variable value:</b> Class and destination of the Huffman table that is currently being read. */
+    uint8_t value;
+    /** <b>Local \c uint16_t variable total:</b> Number of codes of the Huffman table. */
+    uint16_t total;
+    /** <b>Local \c int32_t variable code:</b> Code that is currently being assigned. */
+    int32_t code;
+    /** <b>Local \c uint16_t variable k:</b> Index of the value of the code that is currently being assigned. */
+    uint16_t k;
+
+    while (length > 0)
+    {
+        value = ili9341_jpeg_read_byte(p_decoder);
+        if (((value >> 4) > 1) || ((value & 0x0F) > 1) || (length < 17))
+        {
+            return ILI9341_EC_ERR;
+        }
+        p_table = &p_decoder->huffman[((value >> 4) << 1) | (value & 0x0F)];
+        p_decoder->defined_tables |= (uint8_t) (1U << (4 + (((value >> 4) << 1) | (value & 0x0F))));
+        total = 0;
+        for (uint8_t i = 0; i < 16; i++)
+        {
+            counts[i] = ili9341_jpeg_read_byte(p_decoder);
+            total = (uint16_t) (total + counts[i]);
+        }
+        if ((total > 256) || (length < 17 + total))
+        {
+            return ILI9341_EC_ERR;
+        }
+        for (uint16_t i = 0; i < total; i++)
+        {
+            p_table->values[i] = ili9341_jpeg_read_byte(p_decoder);
+        }
+        length -= 17 + total;
+
+        /* Assign the canonical codes by increasing length, filling in the lookup table with the ones that fit in it. */
+        memset(p_table->lookup, 0, sizeof(p_table->lookup));
+        code = 0;
+        k = 0;
+        for (uint8_t bits = 1; bits <= 16; bits++)
+        {
+            if (code + counts[bits - 1] > (1L << bits))
+            {
+                return ILI9341_EC_ERR; // There are more codes than the ones that fit in this length.
+            }
+            p_table->value_offset[bits] = (int32_t) k - code;
+            for (uint8_t i = 0; i < counts[bits - 1]; i++, code++, k++)
+            {
+                if (bits <= ILI9341_JPEG_LOOKUP_BITS)
+                {
+                    for (uint16_t j = 0; j < (1U << (ILI9341_JPEG_LOOKUP_BITS - bits)); j++)
+                    {
+                        p_table->lookup[((uint32_t) code << (ILI9341_JPEG_LOOKUP_BITS - bits)) | j] = (uint16_t) ((bits << 8) | p_table->values[k]);
+                    }
+                }
+            }
+            p_table->max_code[bits] = (counts[bits - 1] != 0) ? (code - 1) : -1;
+            code <<= 1;
+        }
+    }
+
+    return ILI9341_EC_OK;
+}
+
+static void ili9341_jpeg_fill_bits(ILI9341_jpeg_decoder_def_t *p_decoder)
+{
+    /** <b>Local \c uint8_t variable value:</b> Next byte of the entropy coded data. */
+    uint8_t value;
+
+    while (p_decoder->bit_count <= 24)
+    {
+        value = 0;
+        if (p_decoder->marker == 0)
+        {
+            value = ili9341_jpeg_read_byte(p_decoder);
+            if (p_decoder->is_eof)
+            {
+                p_decoder->marker = ILI9341_JPEG_MARKER_EOI;
+            }
+            else if (value == ILI9341_JPEG_MARKER_PREFIX)
+            {
+                do
+                {
+                    value = ili9341_jpeg_read_byte(p_decoder);
+                } while ((value == ILI9341_JPEG_MARKER_PREFIX) && !p_decoder->is_eof);
+                if (p_decoder->is_eof || (value != 0))
+                {
+                    p_decoder->marker = p_decoder->is_eof ? ILI9341_JPEG_MARKER_EOI : value;
+                    value = 0;
+                }
+                else
+                {
+                    value = ILI9341_JPEG_MARKER_PREFIX; // A stuffed zero byte, which stands for a 0xFF byte of the entropy coded data.
+                }
+            }
+        }
+        if (p_decoder->marker != 0)
+        {
+            p_decoder->padding_bits = (uint8_t) (p_decoder->padding_bits + 8);
+        }
+        p_decoder->bit_buffer |= (uint32_t) value << (24 - p_decoder->bit_count);
+        p_decoder->bit_count = (uint8_t) (p_decoder->bit_count + 8);
+    }
+}
+
+static void ili9341_jpeg_consume_bits(ILI9341_jpeg_decoder_def_t *p_decoder, uint8_t count)
+{
+    p_decoder->bit_buffer <<= count;
+    p_decoder->bit_count = (uint8_t) (p_decoder->bit_count - count);
+    if (p_decoder->bit_count < p_decoder->padding_bits)
+    {
+        p_decoder->is_corrupt = 1;
+        p_decoder->padding_bits = p_decoder->bit_count;
+    }
+}
+
+static uint8_t ili9341_jpeg_decode_huffman(ILI9341_jpeg_decoder_def_t *p_decoder, const ILI9341_jpeg_huffman_def_t *p_table)
+{
+    /** <b>Local \c uint16_t variable entry:</b> Entry of the lookup table for the next bits of the entropy coded data. */
+    uint16_t entry;
+    /** <b>Local \c int32_t variable code:</b> Next bits of the entropy coded data, as a code of the length that is currently being tried. */
+    int32_t code;
+
+    ili9341_jpeg_fill_bits(p_decoder);
+    entry = p_table->lookup[p_decoder->bit_buffer >> (32 - ILI9341_JPEG_LOOKUP_BITS)];
+    if (entry != 0)
+    {
+        ili9341_jpeg_consume_bits(p_decoder, (uint8_t) (entry >> 8));
+        return (uint8_t) entry;
+    }
+    for (uint8_t bits = ILI9341_JPEG_LOOKUP_BITS + 1; bits <= 16; bits++)
+    {
+        code = (int32_t) (p_decoder->bit_buffer >> (32 - bits));
+        if (code <= p_table->max_code[bits])
+        {
+            ili9341_jpeg_consume_bits(p_decoder, bits);
+            return p_table->values[(uint8_t) (code + p_table->value_offset[bits])];
+        }
+    }
+    p_decoder->is_corrupt = 1;
+    ili9341_jpeg_consume_bits(p_decoder, 16);
+    return 0;
+}
+
+static int32_t ili9341_jpeg_receive_extend(ILI9341_jpeg_decoder_def_t *p_decoder, uint8_t size)
+{
+    /** <b>Local \c int32_t variable value:</b> Next \p size bits of the entropy coded data. */
+    int32_t value;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+    ili9341_jpeg_fill_bits(p_decoder);
+    value = (int32_t) (p_decoder->bit_buffer >> (32 - size));
+    ili9341_jpeg_consume_bits(p_decoder, size);
+
+    /* The values whose first bit is 0 are the negative ones of this magnitude category. */
+    return (value < (1L << (size - 1))) ? (value - (1L << size) + 1) : value;
+}
+
+static uint8_t ili9341_jpeg_decode_block(ILI9341_jpeg_decoder_def_t *p_decoder, ILI9341_jpeg_component_def_t *p_component, uint8_t is_visible)
+{
+    /** <b>Local \c uint16_t pointer p_quant:</b> Points to the quantization table of the component, in zigzag order. */
+    const uint16_t *p_quant = p_decoder->quant[p_component->quant_table];
+    /** <b>Local \c ILI9341_jpeg_huffman_def_t pointer p_ac_table:</b> Points to the AC Huffman table of the component. */
+    const ILI9341_jpeg_huffman_def_t *p_ac_table = &p_decoder->huffman[p_component->ac_table];
+    /** <b>Local \c uint8_t variable symbol:</b> Run length of zero coefficients (in the upper nibble) and magnitude category (in the lower nibble) of the next non-zero AC coefficient. */
+    uint8_t symbol;
+    /** <b>Local \c int32_t variable value:</b> Coefficient that is currently being decoded. */
+    int32_t value;
+    /** <b>Local \c uint8_t variable has_ac:</b> Whether any of the AC coefficients of the block is not zero (1) or not (0). */
+    uint8_t has_ac = 0;
+
+    if (is_visible)
+    {
+        memset(p_decoder->coefficients, 0, sizeof(p_decoder->coefficients));
+    }
+
+    /* The DC coefficient is coded as the difference from the one of the previous block of the same component. */
+    p_component->dc_predictor += ili9341_jpeg_receive_extend(p_decoder, ili9341_jpeg_decode_huffman(p_decoder, &p_decoder->huffman[p_component->dc_table]) & 0x0F);
+    p_component->dc_predictor = ILI9341_JPEG_LIMIT(p_component->dc_predictor, ILI9341_JPEG_COEFFICIENT_LIMIT);
+    value = p_component->dc_predictor * p_quant[0];
+    p_decoder->coefficients[0] = ILI9341_JPEG_LIMIT(value, ILI9341_JPEG_COEFFICIENT_LIMIT);
+
+    for (uint8_t k = 1; k < 64; k++)
+    {
+        symbol = ili9341_jpeg_decode_huffman(p_decoder, p_ac_table);
+        if ((symbol & 0x0F) == 0)
+        {
+            if (symbol != 0xF0)
+            {
+                break; // End of block, so the rest of the coefficients are zero.
+            }
+            k = (uint8_t) (k + 15); // Run of 16 zero coefficients.
+            continue;
+        }
+        k = (uint8_t) (k + (symbol >> 4));
+        value = ili9341_jpeg_receive_extend(p_decoder, symbol & 0x0F);
+        if (k > 63)
+        {
+            p_decoder->is_corrupt = 1;
+            break;
+        }
+        if (is_visible)
+        {
+            value *= p_quant[k];
+            p_decoder->coefficients[zigzag[k]] = ILI9341_JPEG_LIMIT(value, ILI9341_JPEG_COEFFICIENT_LIMIT);
+        }
+        has_ac = 1;
+    }
+
+    return has_ac;
+}
+
+static void ili9341_jpeg_idct(const int32_t *p_coefficients, uint8_t *p_samples)
+{
+    /** <b>Local \c int32_t array workspace:</b> Holds the results of the first pass (i.e., over the columns) of the inverse DCT. */
+    int32_t workspace[64];
+    /** <b>Local \c int32_t pointer p_in:</b> Points to the first value of the column or row that is currently being transformed. */
+    const int32_t *p_in;
+    /** <b>Local \c int32_t variables tmp0 up to tmp3, tmp10 up to tmp13 and z1 up to z5:</b> Hold the intermediate values of the even and odd parts of the current column or row. */
+    int32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13, z1, z2, z3, z4, z5;
+    /** <b>Local \c int32_t variable value:</b> Sample that is currently being written. */
+    int32_t value;
+
+    /* First pass: transform each column into the workspace, with ILI9341_JPEG_IDCT_PASS1_BITS extra fractional bits, limiting its results to ILI9341_JPEG_WORKSPACE_LIMIT so that the second pass cannot overflow on corrupt images. */
+    for (uint8_t column = 0; column < 8; column++)
+    {
+        p_in = &p_coefficients[column];
+        if ((p_in[8] | p_in[16] | p_in[24] | p_in[32] | p_in[40] | p_in[48] | p_in[56]) == 0)
+        {
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                workspace[i * 8 + column] = p_in[0] * (1L << ILI9341_JPEG_IDCT_PASS1_BITS);
+            }
+            continue;
+        }
+
+        /* Even part. */
+        z2 = p_in[16];
+        z3 = p_in[48];
+        z1 = (z2 + z3) * ILI9341_JPEG_FIX_0_541196100;
+        tmp2 = z1 - z3 * ILI9341_JPEG_FIX_1_847759065;
+        tmp3 = z1 + z2 * ILI9341_JPEG_FIX_0_765366865;
+        tmp0 = (p_in[0] + p_in[32]) * (1L << ILI9341_JPEG_IDCT_CONST_BITS);
+        tmp1 = (p_in[0] - p_in[32]) * (1L << ILI9341_JPEG_IDCT_CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        /* Odd part. */
+        tmp0 = p_in[56];
+        tmp1 = p_in[40];
+        tmp2 = p_in[24];
+        tmp3 = p_in[8];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        z4 = tmp1 + tmp3;
+        z5 = (z3 + z4) * ILI9341_JPEG_FIX_1_175875602;
+        tmp0 *= ILI9341_JPEG_FIX_0_298631336;
+        tmp1 *= ILI9341_JPEG_FIX_2_053119869;
+        tmp2 *= ILI9341_JPEG_FIX_3_072711026;
+        tmp3 *= ILI9341_JPEG_FIX_1_501321110;
+        z1 *= -ILI9341_JPEG_FIX_0_899976223;
+        z2 *= -ILI9341_JPEG_FIX_2_562915447;
+        z3 = z3 * -ILI9341_JPEG_FIX_1_961570560 + z5;
+        z4 = z4 * -ILI9341_JPEG_FIX_0_390180644 + z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        workspace[0 * 8 + column] = ILI9341_JPEG_LIMIT(ILI9341_JPEG_DESCALE(tmp10 + tmp3, ILI9341_JPEG_IDCT_CONST_BITS - ILI9341_JPEG_IDCT_PASS1_BITS), ILI9341_JPEG_WORKSPACE_LIMIT);
+        workspace[7 * 8 + column] = ILI9341_JPEG_LIMIT(ILI9341_JPEG_DESCALE(tmp10 - tmp3, ILI9341_JPEG_IDCT_CONST_BITS - ILI9341_JPEG_IDCT_PASS1_BITS), ILI9341_JPEG_WORKSPACE_LIMIT);
+        workspace[1 * 8 + column] = ILI9341_JPEG_LIMIT(ILI9341_JPEG_DESCALE(tmp11 + tmp2, ILI9341_JPEG_IDCT_CONST_BITS - ILI9341_JPEG_IDCT_PASS1_BITS), ILI9341_JPEG_WORKSPACE_LIMIT);
+        workspace[6 * 8 + column] = ILI9341_JPEG_LIMIT(ILI9341_JPEG_DESCALE(tmp11 - tmp2, ILI9341_JPEG_IDCT_CONST_BITS - ILI9341_JPEG_IDCT_PASS1_BITS), ILI9341_JPEG_WORKSPACE_LIMIT);
+        workspace[2 * 8 + column] = ILI9341_JPEG_LIMIT(ILI9341_JPEG_DESCALE(tmp12 + tmp1, ILI9341_JPEG_IDCT_CONST_BITS - ILI9341_JPEG_IDCT_PASS1_BITS), ILI9341_JPEG_WORKSPACE_LIMIT);
+        workspace[5 * 8 + column] = ILI9341_JPEG_LIMIT(ILI9341_JPEG_DESCALE(tmp12 - tmp1, ILI9341_JPEG_IDCT_CONST_BITS - ILI9341_JPEG_IDCT_PASS1_BITS), ILI9341_JPEG_WORKSPACE_LIMIT);
+        workspace[3 * 8 + column] = ILI9341_JPEG_LIMIT(ILI9341_JPEG_DESCALE(tmp13 + tmp0, ILI9341_JPEG_IDCT_CONST_BITS - ILI9341_JPEG_IDCT_PASS1_BITS), ILI9341_JPEG_WORKSPACE_LIMIT);
+        workspace[4 * 8 + column] = ILI9341_JPEG_LIMIT(ILI9341_JPEG_DESCALE(tmp13 - tmp0, ILI9341_JPEG_IDCT_CONST_BITS - ILI9341_JPEG_IDCT_PASS1_BITS), ILI9341_JPEG_WORKSPACE_LIMIT);
+    }
+
+    /* Second pass: transform each row of the workspace into samples, removing the extra fractional bits and the factor of 8 of both passes, and level shifting them back by 128. */
+    for (uint8_t row = 0; row < 8; row++, p_samples += 8)
+    {
+        p_in = &workspace[row * 8];
+        if ((p_in[1] | p_in[2] | p_in[3] | p_in[4] | p_in[5] | p_in[6] | p_in[7]) == 0)
+        {
+            value = ILI9341_JPEG_DESCALE(p_in[0], ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+            memset(p_samples, ILI9341_JPEG_CLAMP(value), 8);
+            continue;
+        }
+
+        /* Even part. */
+        z2 = p_in[2];
+        z3 = p_in[6];
+        z1 = (z2 + z3) * ILI9341_JPEG_FIX_0_541196100;
+        tmp2 = z1 - z3 * ILI9341_JPEG_FIX_1_847759065;
+        tmp3 = z1 + z2 * ILI9341_JPEG_FIX_0_765366865;
+        tmp0 = (p_in[0] + p_in[4]) * (1L << ILI9341_JPEG_IDCT_CONST_BITS);
+        tmp1 = (p_in[0] - p_in[4]) * (1L << ILI9341_JPEG_IDCT_CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        /* Odd part. */
+        tmp0 = p_in[7];
+        tmp1 = p_in[5];
+        tmp2 = p_in[3];
+        tmp3 = p_in[1];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        z4 = tmp1 + tmp3;
+        z5 = (z3 + z4) * ILI9341_JPEG_FIX_1_175875602;
+        tmp0 *= ILI9341_JPEG_FIX_0_298631336;
+        tmp1 *= ILI9341_JPEG_FIX_2_053119869;
+        tmp2 *= ILI9341_JPEG_FIX_3_072711026;
+        tmp3 *= ILI9341_JPEG_FIX_1_501321110;
+        z1 *= -ILI9341_JPEG_FIX_0_899976223;
+        z2 *= -ILI9341_JPEG_FIX_2_562915447;
+        z3 = z3 * -ILI9341_JPEG_FIX_1_961570560 + z5;
+        z4 = z4 * -ILI9341_JPEG_FIX_0_390180644 + z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        value = ILI9341_JPEG_DESCALE(tmp10 + tmp3, ILI9341_JPEG_IDCT_CONST_BITS + ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+        p_samples[0] = (uint8_t) ILI9341_JPEG_CLAMP(value);
+        value = ILI9341_JPEG_DESCALE(tmp10 - tmp3, ILI9341_JPEG_IDCT_CONST_BITS + ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+        p_samples[7] = (uint8_t) ILI9341_JPEG_CLAMP(value);
+        value = ILI9341_JPEG_DESCALE(tmp11 + tmp2, ILI9341_JPEG_IDCT_CONST_BITS + ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+        p_samples[1] = (uint8_t) ILI9341_JPEG_CLAMP(value);
+        value = ILI9341_JPEG_DESCALE(tmp11 - tmp2, ILI9341_JPEG_IDCT_CONST_BITS + ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+        p_samples[6] = (uint8_t) ILI9341_JPEG_CLAMP(value);
+        value = ILI9341_JPEG_DESCALE(tmp12 + tmp1, ILI9341_JPEG_IDCT_CONST_BITS + ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+        p_samples[2] = (uint8_t) ILI9341_JPEG_CLAMP(value);
+        value = ILI9341_JPEG_DESCALE(tmp12 - tmp1, ILI9341_JPEG_IDCT_CONST_BITS + ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+        p_samples[5] = (uint8_t) ILI9341_JPEG_CLAMP(value);
+        value = ILI9341_JPEG_DESCALE(tmp13 + tmp0, ILI9341_JPEG_IDCT_CONST_BITS + ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+        p_samples[3] = (uint8_t) ILI9341_JPEG_CLAMP(value);
+        value = ILI9341_JPEG_DESCALE(tmp13 - tmp0, ILI9341_JPEG_IDCT_CONST_BITS + ILI9341_JPEG_IDCT_PASS1_BITS + 3) + 128;
+        p_samples[4] = (uint8_t) ILI9341_JPEG_CLAMP(value);
+    }
+}
+
+static void ili9341_jpeg_restart(ILI9341_jpeg_decoder_def_t *p_decoder)
+{
+    /** <b>Local \c uint8_t variable value:</b> Byte of the JPEG image that is currently being read. */
+    uint8_t value;
+
+    /* Drop the bits that are left before the restart marker and, unless the bit buffer already stopped at a marker, look for it. */
+    p_decoder->bit_buffer = 0;
+    p_decoder->bit_count = 0;
+    p_decoder->padding_bits = 0;
+    while ((p_decoder->marker == 0) && !p_decoder->is_eof)
+    {
+        if (ili9341_jpeg_read_byte(p_decoder) != ILI9341_JPEG_MARKER_PREFIX)
+        {
+            continue;
+        }
+        do
+        {
+            value = ili9341_jpeg_read_byte(p_decoder);
+        } while ((value == ILI9341_JPEG_MARKER_PREFIX) && !p_decoder->is_eof);
+        if ((value != 0) && !p_decoder->is_eof)
+        {
+            p_decoder->marker = value;
+        }
+    }
+    if ((p_decoder->marker >= ILI9341_JPEG_MARKER_RST0) && (p_decoder->marker <= ILI9341_JPEG_MARKER_RST7))
+    {
+        p_decoder->marker = 0;
+    }
+
+    for (uint8_t i = 0; i < p_decoder->component_count; i++)
+    {
+        p_decoder->components[i].dc_predictor = 0;
+    }
+}
+
+/** @} */
@@ -13,15 +13,108 @@
 #define ILI9341_DISPLAY_FUNCTION_CONTROL_COMMAND            (0xB6)    /**< @brief Byte value that the ILI9341 interprets as the Display Function Control Command. */
 #define ILI9341_SLEEP_OUT_COMMAND                           (0x11)    /**< @brief Byte value that the ILI9341 interprets as the Sleep Out Command. */
 #define ILI9341_DISPLAY_ON_COMMAND                          (0x29)    /**< @brief Byte value that the ILI9341 interprets as the Display ON Command. */
+#define ILI9341_POWER_CONTROL_2_COMMAND                     (0xC1)    /**< @brief Byte value that the ILI9341 interprets as the Power Control 2 Command. */
+#define ILI9341_FRAME_RATE_CONTROL_NORMAL_MODE_COMMAND      (0xB1)    /**< @brief Byte value that the ILI9341 interprets as the Frame Rate Control (In Normal Mode/Full Colors) Command. */
+#define ILI9341_GAMMA_SET_COMMAND                           (0x26)    /**< @brief Byte value that the ILI9341 interprets as the Gamma Set Command. */
+#define ILI9341_POSITIVE_GAMMA_CORRECTION_COMMAND           (0xE0)    /**< @brief Byte value that the ILI9341 interprets as the Positive Gamma Correction Command. */
+#define ILI9341_NEGATIVE_GAMMA_CORRECTION_COMMAND           (0xE1)    /**< @brief Byte value that the ILI9341 interprets as the Negative Gamma Correction Command. */
+#define ILI9341_COLUMN_ADDRESS_SET_COMMAND                  (0x2A)    /**< @brief Byte value that the ILI9341 interprets as the Column Address Set Command. */
+#define ILI9341_PAGE_ADDRESS_SET_COMMAND                    (0x2B)    /**< @brief Byte value that the ILI9341 interprets as the Page Address Set Command. */
+#define ILI9341_MEMORY_WRITE_COMMAND                        (0x2C)    /**< @brief Byte value that the ILI9341 interprets as the Memory Write Command. */
+#define ILI9341_MEMORY_WRITE_CONTINUE_COMMAND               (0x3C)    /**< @brief Byte value that the ILI9341 interprets as the Memory Write Continue Command. */
+#define ILI9341_INTERFACE_CONTROL_COMMAND                   (0xF6)    /**< @brief Byte value that the ILI9341 interprets as the Interface Control Command. */
+#define ILI9341_NOP_COMMAND                                 (0x00)    /**< @brief Byte value that the ILI9341 interprets as the No Operation Command. */
 #define ILI9341_COMMAND_SIZE                                (1)       /**< @brief Size in bytes that a single ILI9341 Command has. */
-#define ILI9341_SINGLE_DATA_SIZE                            (1)       /**< @brief Size in bytes that a single ILI9341 Data has. */
-#define ILI9341_VCOM_CONTROL_1_DATA_SIZE                    (2)       /**< @brief Size in bytes of the ILI9341 Device's VCOM Control 1 command. */
-#define ILI9341_DISPLAY_FUNCTION_CONTROL_DATA_SIZE          (2)       /**< @brief Size in bytes of the ILI9341 Device's Display Function Control command. */
+#define ILI9341_MADCTL_INIT_VALUE                           (0x48)    /**< @brief Memory Access Control Data value with which the ILI9341 Device is initialized, which stands for MX = 1 and BGR = 1 with all the other fields of @ref ILI9341_MADCTL_def_t and @ref ILI9341_MADCTL_MCU_WRITE_READ_DIRECTION_def_t set to zero. */
+#define ILI9341_PIXEL_FORMAT_16BPP_VALUE                    (0x55)    /**< @brief Pixel Format Data value that stands for 16 bits per pixel in both the DBI and DPI fields of @ref ILI9341_PIXEL_FORMAT_def_t . */
+#define ILI9341_PIXEL_FORMAT_18BPP_VALUE                    (0x66)    /**< @brief Pixel Format Data value that stands for 18 bits per pixel in both the DBI and DPI fields of @ref ILI9341_PIXEL_FORMAT_def_t . */
+#if ILI9341_FIXED_BPP == 18
+#define ILI9341_PIXEL_FORMAT_INIT_VALUE                     ILI9341_PIXEL_FORMAT_18BPP_VALUE    /**< @brief Pixel Format Data value with which the ILI9341 Devices are initialized. */
+#define ILI9341_BPP_TYPE(p_handle)                          ((void) (p_handle), ILI9341_BPP_18) /**< @brief Bits Per Pixel (BPP) type of the ILI9341 Device of the given ILI9341 Device Handle, which is a constant whenever @ref ILI9341_FIXED_BPP is not 0. */
+#elif ILI9341_FIXED_BPP == 16
+#define ILI9341_PIXEL_FORMAT_INIT_VALUE                     ILI9341_PIXEL_FORMAT_16BPP_VALUE    /**< @brief Pixel Format Data value with which the ILI9341 Devices are initialized. */
+#define ILI9341_BPP_TYPE(p_handle)                          ((void) (p_handle), ILI9341_BPP_16) /**< @brief Bits Per Pixel (BPP) type of the ILI9341 Device of the given ILI9341 Device Handle, which is a constant whenever @ref ILI9341_FIXED_BPP is not 0. */
+#else
+#define ILI9341_PIXEL_FORMAT_INIT_VALUE                     ILI9341_PIXEL_FORMAT_16BPP_VALUE    /**< @brief Pixel Format Data value with which the ILI9341 Devices are initialized. */
+#define ILI9341_BPP_TYPE(p_handle)                          ((p_handle)->bpp_type)              /**< @brief Bits Per Pixel (BPP) type of the ILI9341 Device of the given ILI9341 Device Handle, which is a constant whenever @ref ILI9341_FIXED_BPP is not 0. */
+#endif
+#define ILI9341_INTERFACE_CONTROL_DATA_SIZE                 (3)       /**< @brief Size in bytes of the Data of the ILI9341 Interface Control Command. */
+#define ILI9341_INTERFACE_CONTROL_1ST_VALUE                 (0x01)    /**< @brief First Data value of the ILI9341 Interface Control Command, which stands for its default values (i.e., WEMODE = 1, so that the Memory Write wraps around whenever more pixels than the ones of the Address Window are sent, and no EOR with the MADCTL bits). */
+#define ILI9341_INTERFACE_CONTROL_EPF_POS                   (4)       /**< @brief Bit position of the EPF field in the second Data value of the ILI9341 Interface Control Command. */
+#define ILI9341_INTERFACE_CONTROL_ENDIAN_POS                (5)       /**< @brief Bit position of the ENDIAN bit in the third Data value of the ILI9341 Interface Control Command. */
+#define ILI9341_SEQUENCE_DELAY_FLAG                         (0x80)    /**< @brief Flag that, whenever it is set in the Data size byte of an entry of an ILI9341 Command Sequence, indicates that a delay byte follows the Data bytes of that entry. */
+#define ILI9341_SEQUENCE_END                                (ILI9341_NOP_COMMAND)    /**< @brief Command value that marks the end of an ILI9341 Command Sequence (therefore, the NOP Command cannot be used inside an ILI9341 Command Sequence). */
+#define ILI9341_ADDRESS_SET_DATA_SIZE                       (4)       /**< @brief Size in bytes of the Data of both the ILI9341 Device's Column Address Set and Page Address Set commands. */
+#define ILI9341_16BPP_PIXEL_SIZE                            (2)       /**< @brief Size in bytes that a single pixel has whenever the ILI9341 Device is configured with 16 bits per pixel. */
+#define ILI9341_18BPP_PIXEL_SIZE                            (3)       /**< @brief Size in bytes that a single pixel has whenever the ILI9341 Device is configured with 18 bits per pixel. */
+#define ILI9341_18BPP_COLOR_MASK                            (0xFC)    /**< @brief Mask of the 6 bits that hold a color in each of the 3 bytes of an 18 bits per pixel pixel. */
+#define ILI9341_16BPP_LINE_SIZE                             (ILI9341_SCREEN_WIDTH * ILI9341_16BPP_PIXEL_SIZE)    /**< @brief Size in bytes of a whole row of pixels in 16 bits per pixel. */
+#define ILI9341_18BPP_LINE_SIZE                             (ILI9341_SCREEN_WIDTH * ILI9341_18BPP_PIXEL_SIZE)    /**< @brief Size in bytes of a whole row of pixels in 18 bits per pixel. */
+#define ILI9341_DMA_MAX_TRANSFER_SIZE                       (0xFFFF)  /**< @brief Maximum number of SPI data frames that can be sent with a single call to \c HAL_SPI_Transmit_DMA (i.e., the size of the DMA data counter). */
+#define ILI9341_TX_INLINE_DATA_SIZE                         (4)       /**< @brief Maximum size in bytes of the data that can be copied inside a single @ref ILI9341_tx_segment_def_t structure (i.e., when using @ref ILI9341_TX_BUFFER_INLINE ). */
+
+/**@brief	ILI9341 SPI Transfer Roles definitions.
+ *
+ * @details These definitions stand for the way in which the ILI9341 Device is to interpret the bytes of a given
+ *          segment of the SPI Transfer Queue, which is what determines the state of its D/C pin and the size of the SPI
+ *          data frames while sending them.
+ */
+typedef enum
+{
+    ILI9341_TX_ROLE_COMMAND     = 0,    //!< The bytes of the segment are an ILI9341 Command (i.e., D/C pin in Low state).
+    ILI9341_TX_ROLE_DATA        = 1,    //!< The bytes of the segment are an ILI9341 Data (i.e., D/C pin in High state).
+    ILI9341_TX_ROLE_DATA_16BIT  = 2     //!< The bytes of the segment are an ILI9341 Data made of \c uint16_t values in the native byte order of the MCU/MPU, which are sent in 16 bit SPI frames (i.e., D/C pin in High state and the Most Significant Byte of each value first).
+} ILI9341_TX_ROLE_t;
 
-static SPI_HandleTypeDef *p_hspi;                                       /**< @brief Pointer to the SPI Handle Structure of the DMA-SPI that will be used in this @ref ili9341 to write/read data to/from the ILI9341 3.2" TFT LCD Module. @details This pointer's value is defined in the @ref init_ili9341_module function. */
-static ILI9341_peripherals_def_t *p_ili9341_peripherals;                /**< @brief Pointer to the ILI9341 3.2" TFT LCD Device's Peripherals Definition Structure that will be used in this @ref ili9341 to control the Peripherals towards which the terminals of the ILI9341 device are connected to. @details This pointer's value is defined in the @ref init_ili9341_module function. */
-static ILI9341_BPP_t ili9341_bpp_type;                                  /**< @brief ILI9341 Bits Per Pixel (BPP) Type with which the @ref ili9341 will be currently responding whenever processing ILI9341 RGB pixel colors. */
-static ILI9341_Status (*p_ili9341_fill_screen)(ILI9341_COLOR color);    /**< @brief Pointer to the function that fills the screen with a single/plain color with the right Bits Per Pixel (BPP) Color Order. */
+/**@brief	ILI9341 SPI Transfer Buffer Ownership definitions.
+ *
+ * @details These definitions stand for who owns the buffer of a given segment of the SPI Transfer Queue and,
+ *          therefore, for how long its caller has to keep that buffer valid and unmodified.
+ */
+typedef enum
+{
+    ILI9341_TX_BUFFER_INLINE   = 0,    //!< The bytes are copied inside the segment itself (up to @ref ILI9341_TX_INLINE_DATA_SIZE bytes), so that the caller's buffer (e.g., a stack variable) can be reused right away.
+    ILI9341_TX_BUFFER_BORROWED = 1,    //!< The caller must keep the buffer valid and unmodified until the SPI Transfer Queue is idle (e.g., constant data located in Flash Memory).
+    ILI9341_TX_BUFFER_RELEASED = 2,    //!< Same as @ref ILI9341_TX_BUFFER_BORROWED , but the @ref ili9341 will also write a zero into the flag given by the caller as soon as the buffer is no longer in use by the DMA.
+    ILI9341_TX_BUFFER_COUNTED  = 3     //!< Same as @ref ILI9341_TX_BUFFER_BORROWED , but the @ref ili9341 will also increment the counter given by the caller once the segment is queued and decrement it as soon as the buffer is no longer in use by the DMA, so that the same buffer can be queued by several segments at the same time.
+} ILI9341_TX_BUFFER_OWNERSHIP_t;
+
+/**@brief	ILI9341 SPI Transfer Queue Segment parameters structure.
+ *
+ * @details This contains all the fields required to describe a single DMA-SPI transfer towards the ILI9341 Device.
+ */
+typedef struct
+{
+    ILI9341_handle_t *p_handle;                             //!< Pointer to the ILI9341 Device Handle of the ILI9341 Device towards which the segment is to be sent.
+    const uint8_t *p_buffer;                                //!< Pointer to the bytes to be sent in the segment whenever its ownership is not @ref ILI9341_TX_BUFFER_INLINE .
+    volatile uint8_t *p_is_buffer_in_use;                   //!< Pointer to the flag that will be cleared, or to the counter that will be decremented, once the segment has been sent whenever its ownership is @ref ILI9341_TX_BUFFER_RELEASED or @ref ILI9341_TX_BUFFER_COUNTED respectively.
+    uint32_t size;                                          //!< Size in bytes of the segment, which is sent in chunks of up to @ref ILI9341_DMA_MAX_TRANSFER_SIZE SPI data frames.
+    uint8_t inline_data[ILI9341_TX_INLINE_DATA_SIZE];       //!< Copy of the bytes to be sent in the segment whenever its ownership is @ref ILI9341_TX_BUFFER_INLINE , which is placed right after a 32 bit field so that it can also be sent in 16 bit SPI data frames.
+    uint16_t repeat_count;                                  //!< Number of times that the buffer of the segment is still pending to be sent (i.e., whenever it is greater than 1, the same buffer will be sent again once its DMA transfer completes).
+    uint8_t role;                                           //!< @ref ILI9341_TX_ROLE_t value of the segment.
+    uint8_t ownership;                                      //!< @ref ILI9341_TX_BUFFER_OWNERSHIP_t value of the segment.
+    uint8_t is_cs_released;                                 //!< Whether the CS pin is to be released (i.e., Set to High State) once the segment has been sent (1) or not (0).
+} ILI9341_tx_segment_def_t;
+
+/**@brief	ILI9341 SPI Bus Definition structure.
+ *
+ * @details This contains all the fields required to share a single DMA-SPI peripheral among all the ILI9341 Devices
+ *          that are connected to it, where each of them is selected by its own CS pin.
+ */
+struct ILI9341_bus_def
+{
+    SPI_HandleTypeDef *p_hspi;                                      //!< Pointer to the SPI Handle Structure of the DMA-SPI of the SPI Bus, or NULL if the SPI Bus is not in use.
+    ILI9341_handle_t *p_cs_owner;                                   //!< Pointer to the ILI9341 Device Handle whose CS pin is currently enabled, or NULL if all the CS pins of the SPI Bus are disabled.
+    ILI9341_tx_segment_def_t tx_queue[ILI9341_TX_QUEUE_LENGTH];     //!< SPI Transfer Queue of the SPI Bus, which is drained by @ref ili9341_spi_tx_cplt_callback .
+    volatile uint8_t tx_queue_head;                                 //!< Index of the @ref tx_queue at which the next segment will be queued.
+    volatile uint8_t tx_queue_tail;                                 //!< Index of the @ref tx_queue of the segment that is currently being sent (or that will be sent next).
+    volatile uint8_t tx_queue_count;                                //!< Number of segments in the @ref tx_queue that have not been completely sent yet.
+    uint32_t tx_offset;                                             //!< Number of bytes of the buffer of the segment at the @ref tx_queue_tail that have already been sent in its current repetition.
+    uint32_t tx_chunk_size;                                         //!< Number of bytes of the DMA-SPI transfer that is currently taking place.
+    uint8_t is_16bit_frame_mode;                                    //!< Whether the SPI peripheral is currently configured with 16 bit data frames (1) or with 8 bit data frames (0).
+};
+
+static ILI9341_bus_def_t ili9341_buses[ILI9341_MAX_SPI_BUSES];     /**< @brief SPI Buses that can be used by the ILI9341 Device Handles of the @ref ili9341 . @details Each of them is assigned to a certain SPI peripheral by the first call to @ref init_ili9341_module that uses it. */
 
 /**@brief	ILI9341 3.2" TFT LCD Device's GVDD Level values types definitions.
  *
@@ -140,21 +233,77 @@ typedef struct __attribute__ ((__packed__))
     uint8_t d7:1;     //!< This bit should always be set to zero.
 } ILI9341_PIXEL_FORMAT_def_t;
 
+/**@brief	ILI9341 Command Sequence that is sent to the ILI9341 Device by @ref init_ili9341_module , after having
+ *          applied a Hardware Reset, in order to initialize it.
+ *
+ * @details This is a Flash-resident table that is interpreted by @ref ili9341_send_command_sequence , where each entry
+ *          holds an ILI9341 Command, its number of Data bytes (optionally with the @ref ILI9341_SEQUENCE_DELAY_FLAG set),
+ *          its Data bytes and, if requested, a delay in milliseconds to be applied after that command. Therefore, adding,
+ *          removing or modifying a step of the ILI9341 initialization process only requires to edit this table.
+ *
+ * @note    The Power Control 2, Frame Rate Control and Gamma values used here are the same ones used by the
+ *          <a href=https://github.com/eziya/STM32_HAL_ILI9341>driver library from eziya</a>, which the ILI9341 board
+ *          seems to work fine with.
+ */
+static const uint8_t ili9341_init_sequence[] =
+{
+    /* Software Reset (the datasheet states to wait 5ms after it). */
+    ILI9341_SOFTWARE_RESET_COMMAND, 0 | ILI9341_SEQUENCE_DELAY_FLAG, 5,
+    /* Power Control 1 to have its GVDD Level set to 4.6V. */
+    ILI9341_POWER_CONTROL_1_COMMAND, 1, ILI9341_GVDD_4V6,
+    /* Power Control 2 to set the factor used in the step-up circuits. */
+    ILI9341_POWER_CONTROL_2_COMMAND, 1, 0x10,
+    /* VCOM Control 1 to have its VCOMH and VCOML voltages set to 4.25V and -1.5V respectively. */
+    ILI9341_VCOM_CONTROL_1_COMMAND, 2, ILI9341_VCOMH_4V25, ILI9341_VCOML_minus_1V5,
+    /* VCOM Control 2 so that VMH and VML have an offset of -58 and -58 respectively. */
+    ILI9341_VCOM_CONTROL_2_COMMAND, 1, ILI9341_VMF_minus_58,
+    /* Memory Access Control (Read Display MADCTL's B5 is left at 0, meaning that the maximum column and row in the frame memory where the ILI9341's MCU can access will be 240 and 320 respectively). */
+    ILI9341_MEMORY_ACCESS_CONTROL_COMMAND, 1, ILI9341_MADCTL_INIT_VALUE,
+    /* Pixel Format set to 16 bits per pixel (i.e., 65k color mode), unless the 18 bits per pixel were fixed at compile time. */
+    ILI9341_PIXEL_FORMAT_COMMAND, 1, ILI9341_PIXEL_FORMAT_INIT_VALUE,
+    /* Interface Control with the pixel byte order and the 65k to 262k color expansion requested at compile time. */
+    ILI9341_INTERFACE_CONTROL_COMMAND, ILI9341_INTERFACE_CONTROL_DATA_SIZE, ILI9341_INTERFACE_CONTROL_1ST_VALUE,
+    (ILI9341_INTERFACE_EPF << ILI9341_INTERFACE_CONTROL_EPF_POS), (ILI9341_INTERFACE_ENDIAN << ILI9341_INTERFACE_CONTROL_ENDIAN_POS),
+    /* Frame Rate Control with a division ratio of fosc and a frame rate of 79Hz. */
+    ILI9341_FRAME_RATE_CONTROL_NORMAL_MODE_COMMAND, 2, 0x00, 0x18,
+    /* Display Function Control with all its default values, but with the "Source output on non-display area" changed from AGND and AGND to V63 and V0 respectively and its "VCOM output on non-display area" from AGND and AGND to VCOML and VCOMH respectively. */
+    ILI9341_DISPLAY_FUNCTION_CONTROL_COMMAND, 3, 0x08, 0x82, 0x27,
+    /* Gamma Curve 1 (G2.2). */
+    ILI9341_GAMMA_SET_COMMAND, 1, 0x01,
+    /* Positive Gamma Correction. */
+    ILI9341_POSITIVE_GAMMA_CORRECTION_COMMAND, 15, 0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1, 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+    /* Negative Gamma Correction. */
+    ILI9341_NEGATIVE_GAMMA_CORRECTION_COMMAND, 15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+    /* Exit Sleep Mode (the datasheet states to wait 5ms after it before sending another command). */
+    ILI9341_SLEEP_OUT_COMMAND, 0 | ILI9341_SEQUENCE_DELAY_FLAG, 5,
+    /* Turn the Display On. */
+    ILI9341_DISPLAY_ON_COMMAND, 0,
+    ILI9341_SEQUENCE_END
+};
+
 /**@brief	Sets the State of the CS pin of the ILI9341 3.2" TFT LCD Device to Reset (i.e., To Low State) so that our
  *          MCU/MPU enables SPI communication with it.
  *
+ * @note    Whenever @ref ILI9341_GPIO_FAST_PATH is enabled, this and the other functions that toggle the CS and D/C
+ *          pins do so with a single store into the BSRR register of their GPIO port, which is the main per-command
+ *          overhead whenever many small primitives are drawn.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    November 05, 2024.
  */
-static void enable_cs_pin(void);
+static void enable_cs_pin(ILI9341_handle_t *p_handle);
 
 /**@brief	Sets the State of the CS pin of the ILI9341 3.2" TFT LCD Device to Set (i.e., To High State) so that our
  *          MCU/MPU disables SPI communication with it.
  *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    November 05, 2024.
  */
-static void disable_cs_pin(void);
+static void disable_cs_pin(ILI9341_handle_t *p_handle);
 
 /**@brief	Applies a hardware reset in the ILI9341 3.2" TFT LCD Device.
  *
@@ -163,182 +312,333 @@ static void disable_cs_pin(void);
  * @note    It is necessary to wait 120msec after executing this function before sending an ILI9341 "Sleep Out" Command,
  *          according to the ILI6341 Datasheet.
  *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    November 05, 2024.
  */
-static void ili9341_hardware_reset(void);
+static void ili9341_hardware_reset(ILI9341_handle_t *p_handle);
 
-/**@brief   Requests and applies a Software Reset to the ILI9341 TFT LCD Device.
+/**@brief   Sends a whole ILI9341 Command Sequence to the ILI9341 Device, such as the @ref ili9341_init_sequence .
+ *
+ * @details This function works as a streaming interpreter of the ILI9341 Command Sequence given in its \p p_sequence
+ *          param, where each of its entries is laid out in the following manner:
+ *          1. A first byte containing the ILI9341 Command.
+ *          2. A second byte containing the number of Data bytes (i.e., arguments) of that command, which may also have
+ *             the @ref ILI9341_SEQUENCE_DELAY_FLAG set.
+ *          3. The Data bytes of that command, if any.
+ *          4. A last byte containing a delay in milliseconds, only if the @ref ILI9341_SEQUENCE_DELAY_FLAG was set.
  *
- * @note   A 5ms delay is applied at the end of this function.
+ *          The sequence ends whenever an entry starts with the @ref ILI9341_SEQUENCE_END value.
  *
- * @retval  ILI9341_EC_OK if the Software Reset request was made successfully to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_NR if there was no SPI response after sending the Software Reset requested to the ILI9341 TFT LCD Device.
+ * @details Both the Commands and their Data are sent by DMA directly from the \p p_sequence param (i.e., without
+ *          copying them into stack variables) and the CS pin is kept enabled throughout the whole sequence, so that
+ *          only a single CS assertion and the minimum number of DMA transfers (i.e., one per Command and one per group
+ *          of Data bytes) are required.
+ *
+ * @note    This function will halt until the whole sequence has been sent to the ILI9341 Device.
+ *
+ * @param[in] p_handle      Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param[in] p_sequence    Pointer to the ILI9341 Command Sequence to be sent, which must remain valid until this
+ *                          function returns (e.g., a \c const array located in Flash Memory).
+ *
+ * @retval  ILI9341_EC_OK if the whole ILI9341 Command Sequence was sent successfully to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the ILI9341 Command Sequence.
  * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+static ILI9341_Status ili9341_send_command_sequence(ILI9341_handle_t *p_handle, const uint8_t *p_sequence);
+
+/**@brief	Signals to the ILI9341 3.2" TFT LCD Device that the incoming SPI data will stand for an ILI9341 Data Type
+ *          value.
+ *
+ * @note    This is achieved by setting and maintaining the D/C ILI9341 pin to a High state.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    November 05, 2024.
  */
-static ILI9341_Status ili9341_software_reset(void);
+static void set_dc_pin_to_data_mode(ILI9341_handle_t *p_handle);
 
-/**@brief   Configures the ILI9341 Power Control to have a certain/desired value for the GVDD Level.
+/**@brief	Signals to the ILI9341 3.2" TFT LCD Device that the incoming SPI data will stand for an ILI9341 Command Type
+ *          value.
  *
- * @param gvdd_level    Data Value that the ILI9341 will interpret as a certain configuration for the GVDD Level.
+ * @note    This is achieved by setting and maintaining the D/C ILI9341 pin to a Low state.
  *
- * @retval  ILI9341_EC_OK if the Power Control 1 configuration request was made successfully to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_NR if there was no SPI response after sending the Power Control 1 requested to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 06, 2024.
+ * @date    November 05, 2024.
  */
-static ILI9341_Status ili9341_configure_power_control_1(ILI9341_GVDD_t gvdd_level);
+static void set_dc_pin_to_command_mode(ILI9341_handle_t *p_handle);
 
-/**@brief   Configures the ILI9341 VCOM Control 1 to have a certain/desired Voltage for both the VCOMH and VCOML.
+/**@brief	Queues a desired Command or Data to be sent to the ILI9341 Device over the designated DMA-SPI that this
+ *          module has been configured with.
  *
- * @param vcomh_voltage Data Value that the ILI9341 will interpret as a certain configuration for the VCOMH Voltage.
- * @param vcoml_voltage Data Value that the ILI9341 will interpret as a certain configuration for the VCOML Voltage.
+ * @details This function will place the requested bytes as a new segment at the end of the SPI Transfer Queue and will
+ *          return right away, without waiting for them to be sent. In case that the DMA-SPI is idle, this function
+ *          will also start the DMA transfer of that segment. Otherwise, the segment will be sent later by
+ *          @ref ili9341_spi_tx_cplt_callback once all the previously queued segments have been sent.
  *
- * @retval  ILI9341_EC_OK if the VCOM Control 1 configuration request was made successfully to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_NR if there was no SPI response after sending the VCOM Control 1 requested to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ * @details Since a single DMA transfer cannot send more than @ref ILI9341_DMA_MAX_TRANSFER_SIZE SPI data frames, larger
+ *          segments (e.g., a whole frame of 153'600 bytes in 16 bits per pixel) are sent as several consecutive DMA
+ *          transfers, each of them being chained from @ref ili9341_spi_tx_cplt_callback without releasing the CS
+ *          pin and without toggling the D/C pin again.
+ *
+ * @note    The CS pin will be enabled whenever a segment starts to be sent and it will be kept enabled until
+ *          @ref ili9341_release_cs is called.
+ * @note    <b style="color:red">WARNING:</b> In case that the SPI Transfer Queue is full, then this function will
+ *          first halt until there is room for the new segment in it.
+ *
+ * @param[in] p_handle              Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param role                      @ref ILI9341_TX_ROLE_t value that tells whether the bytes to send are a Command or a
+ *                                  Data and in which SPI data frame size they have to be sent.
+ * @param[in] buffer                Pointer to the Memory Address containing the data that is desired to be sent to the
+ *                                  ILI9341 Device.
+ * @param size                      Size in bytes to send to the ILI9341 Device.
+ * @param ownership                 @ref ILI9341_TX_BUFFER_OWNERSHIP_t value that tells for how long the \p buffer param
+ *                                  has to remain valid.
+ * @param[out] p_is_buffer_in_use   Pointer to the flag or counter that tracks whether \p buffer is still in use by the
+ *                                  DMA whenever \p ownership equals @ref ILI9341_TX_BUFFER_RELEASED or
+ *                                  @ref ILI9341_TX_BUFFER_COUNTED . Otherwise, this param is ignored and may be NULL.
+ *
+ * @retval  ILI9341_EC_OK if requesting to send the desired data over the DMA-SPI peripheral was successful.
+ * @retval  ILI9341_EC_NR if there was no SPI response after sending the requested data over the SPI peripheral.
+ * @retval  ILI9341_EC_ERR if \p size is zero, if \p size is greater than @ref ILI9341_TX_INLINE_DATA_SIZE whenever
+ *          \p ownership equals @ref ILI9341_TX_BUFFER_INLINE , if \p size is odd whenever \p role equals
+ *          @ref ILI9341_TX_ROLE_DATA_16BIT or if a previously queued segment failed to be sent.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 07, 2024.
+ * @date    November 05, 2024.
  */
-static ILI9341_Status ili9341_configure_vcom_control_1(ILI9341_VCOMH_t vcomh_voltage, ILI9341_VCOML_t vcoml_voltage);
+static ILI9341_Status ili9341_dma_spi_tx(ILI9341_handle_t *p_handle, ILI9341_TX_ROLE_t role, const uint8_t *buffer, uint32_t size,
+                                         ILI9341_TX_BUFFER_OWNERSHIP_t ownership, volatile uint8_t *p_is_buffer_in_use);
 
-/**@brief   Configures the ILI9341 VCOM Control 2 to have a certain/desired offset for both the VCOMH and VCOML of the
- *          ILI9341 Device.
+/**@brief	Queues a desired Data to be sent repeatedly to the ILI9341 Device over the designated DMA-SPI that this
+ *          module has been configured with.
  *
- * @param vmf_offset    Data Value that the ILI9341 will interpret as a certain configuration for the VMF Offset.
+ * @details This function works just like @ref ili9341_dma_spi_tx , but the whole \p buffer param will be sent
+ *          \p repeat_count times in a row by @ref ili9341_spi_tx_cplt_callback , which is useful for streaming large
+ *          amounts of repetitive data (e.g., a single/plain color) from a small buffer.
  *
- * @retval  ILI9341_EC_OK if the VCOM Control 2 configuration request was made successfully to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_NR if there was no SPI response after sending the VCOM Control 2 requested to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ * @param[in] p_handle              Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param role                      Either @ref ILI9341_TX_ROLE_DATA or @ref ILI9341_TX_ROLE_DATA_16BIT .
+ * @param[in] buffer                Pointer to the Memory Address containing the data that is desired to be sent to the
+ *                                  ILI9341 Device.
+ * @param size                      Size in bytes of \p buffer .
+ * @param repeat_count              Number of times that \p buffer is to be sent.
+ * @param ownership                 @ref ILI9341_TX_BUFFER_OWNERSHIP_t value that tells for how long the \p buffer param
+ *                                  has to be kept valid, which must not be @ref ILI9341_TX_BUFFER_INLINE .
+ * @param[out] p_is_buffer_in_use   Pointer to the flag or counter that tracks whether \p buffer is still in use by the
+ *                                  DMA whenever \p ownership equals @ref ILI9341_TX_BUFFER_RELEASED or
+ *                                  @ref ILI9341_TX_BUFFER_COUNTED . Otherwise, this param is ignored.
  *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 07, 2024.
+ * @retval  ILI9341_EC_OK if requesting to send the desired data over the DMA-SPI peripheral was successful.
+ * @retval  ILI9341_EC_NR if there was no SPI response after sending the requested data over the SPI peripheral.
+ * @retval  ILI9341_EC_ERR if either \p size or \p repeat_count are zero, if \p size is odd whenever \p role equals
+ *          @ref ILI9341_TX_ROLE_DATA_16BIT or if a previously queued segment failed to be sent.
  */
-static ILI9341_Status ili9341_configure_vcom_control_2(ILI9341_VMF_t vmf_offset);
+static ILI9341_Status ili9341_dma_spi_tx_repeated(ILI9341_handle_t *p_handle, ILI9341_TX_ROLE_t role, const uint8_t *buffer,
+                                                  uint32_t size, uint16_t repeat_count, ILI9341_TX_BUFFER_OWNERSHIP_t ownership,
+                                                  volatile uint8_t *p_is_buffer_in_use);
 
-/**@brief   Configures the ILI9341 Memory Access Control to define the desired read/write scanning of frame memory.
+/**@brief	Reserves the segment located at the head of the SPI Transfer Queue so that the caller can fill it.
  *
- * @note    For more details on the parameters that are configured by the Memory Access Control command, please see
- *          @ref ILI9341_MADCTL_def_t .
+ * @details The reserved segment is given with a \c repeat_count of 1 and without requesting to release the CS pin,
+ *          and it will not be visible to @ref ili9341_spi_tx_cplt_callback until @ref ili9341_commit_tx_segment is
+ *          called.
  *
- * @retval  ILI9341_EC_OK if the Memory Access Control configuration request was made successfully to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_NR if there was no SPI response after sending the Memory Access Control requested to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ * @note    <b style="color:red">WARNING:</b> In case that the SPI Transfer Queue is full, then this function will
+ *          first halt until there is room for the new segment in it.
  *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 07, 2024.
+ * @param[in] p_handle      Pointer to the ILI9341 Device Handle of the ILI9341 Device towards which the segment is to
+ *                          be sent.
+ * @param[out] pp_segment   Pointer to the pointer that will be updated to point to the reserved segment.
+ *
+ * @retval  ILI9341_EC_OK if the segment was reserved successfully.
+ * @retval  ILI9341_EC_NR, ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if a previously queued segment
+ *          failed to be sent, in which case no segment is reserved.
  */
-static ILI9341_Status ili9341_configure_memory_access_control(void);
+static ILI9341_Status ili9341_reserve_tx_segment(ILI9341_handle_t *p_handle, ILI9341_tx_segment_def_t **pp_segment);
 
-/**@brief   Configures the ILI9341 Pixel Format to set the desired pixel format for the RGB image data used by the
- *          interface.
+/**@brief	Appends the segment previously reserved with @ref ili9341_reserve_tx_segment to the SPI Transfer Queue and
+ *          starts its DMA transfer right away in case that the SPI Transfer Queue was idle.
  *
- * @details This function has fixed setting the Pixel Format to 16 bits per pixel.
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
  *
- * @note    For more details on the parameters that are configured by the Pixel Format command, please see
- *          @ref ILI9341_PIXEL_FORMAT_def_t .
+ * @retval  ILI9341_EC_OK if the segment was queued successfully.
+ * @retval  ILI9341_EC_NR, ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something went wrong with the
+ *          SPI.
+ */
+static ILI9341_Status ili9341_commit_tx_segment(ILI9341_handle_t *p_handle);
+
+/**@brief	Requests to release the CS pin of an ILI9341 Device (i.e., To set it to High State) as soon as its last
+ *          segment currently in the SPI Transfer Queue has been sent, or right away if it has none.
  *
- * @retval  ILI9341_EC_OK if the Pixel Format configuration request was made successfully to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_NR if there was no SPI response after sending the Pixel Format requested to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ */
+static void ili9341_release_cs(ILI9341_handle_t *p_handle);
+
+/**@brief	Starts the DMA-SPI transfer of the segment located at the tail of the SPI Transfer Queue.
  *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 07, 2024.
+ * @details This function sets the D/C pin according to the role of that segment and enables the CS pin of its
+ *          ILI9341 Device before requesting its DMA-SPI transfer. In case that the CS pin of another ILI9341 Device of
+ *          the same SPI Bus was still enabled, then it is disabled first so that only one ILI9341 Device listens to
+ *          the SPI Bus at any given time.
+ *
+ * @note    This function must only be called either with interrupts disabled or from within
+ *          @ref ili9341_spi_tx_cplt_callback , and only when the SPI Transfer Queue is not empty.
+ * @note    In case that the DMA-SPI transfer could not be started, then this function will latch its corresponding
+ *          Exception Code and it will abort all the segments that are in the SPI Transfer Queue.
+ *
+ * @param[in] p_bus     Pointer to the SPI Bus whose SPI Transfer Queue is to be used.
  */
-static ILI9341_Status ili9341_configure_pixel_format(void);
+static void ili9341_start_tx_segment(ILI9341_bus_def_t *p_bus);
 
-/**@brief   Configures the ILI9341 Display Function Control with all its default values, but by only changing the
- *          source/VCOM's "Source output on non-display area" from AGND and AGND to V63 and V0 respectively and
- *          its "VCOM output on non-display area" from AGND and AGND to VCOML and VCOMH respectively.
+/**@brief	Configures the SPI peripheral of an SPI Bus, together with its DMA, to send either 8 bit or 16 bit data
+ *          frames.
  *
- * @note    For more details on the parameters that are configured by the Pixel Format command, please see the ILI9341
- *          datasheet.
+ * @details This is done by writing the data frame size field of the SPI peripheral (i.e., the DFF bit of its CR1
+ *          register or, in the STM32 series that have it, the DS field of its CR2 register) while it is disabled and by
+ *          re-initializing its transmit DMA with byte or half-word data alignments. Since this is only required
+ *          whenever the data frame size changes, it is only done between a Command and a segment of
+ *          @ref ILI9341_TX_ROLE_DATA_16BIT role.
  *
- * @retval  ILI9341_EC_OK if the Display Function Control configuration request was made successfully to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_NR if there was no SPI response after sending the Display Function Control requested to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ * @note    This function must only be called whenever no DMA-SPI transfer is taking place in the SPI Bus.
  *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 07, 2024.
+ * @param[in] p_bus             Pointer to the SPI Bus whose SPI peripheral is to be configured.
+ * @param is_16bit_frame_mode   Whether 16 bit data frames (1) or 8 bit data frames (0) are desired.
  */
-static ILI9341_Status ili9341_configure_display_function_control(void);
+static void ili9341_set_spi_frame_mode(ILI9341_bus_def_t *p_bus, uint8_t is_16bit_frame_mode);
 
-/**@brief   Sends requests to ILI9341 for exiting sleep mode.
+/**@brief	Queues the given pixels to be written into the current Address Window of the ILI9341 Device, after a Memory
+ *          Write Continue command in case that another command was sent after the last written pixel.
  *
- * @note    This function calls a 5ms delay at the end since, as stated in the ILI9341 datasheet, it is the time
- *          required after the ILI9341 Device exits sleep mode so that another command can be send to it.
- * @note    It is necessary to wait 120msec after executing this function before sending an ILI9341 "Sleep Out" Command,
- *          according to the ILI6341 Datasheet.
+ * @param[in] p_handle              Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param role                      Either @ref ILI9341_TX_ROLE_DATA or @ref ILI9341_TX_ROLE_DATA_16BIT .
+ * @param[in] pixels                Pointer to the pixels to be written.
+ * @param size                      Size in bytes of \p pixels .
+ * @param[out] p_is_buffer_in_use   Pointer to a flag that this function will set and that will be cleared once
+ *                                  \p pixels is no longer in use by the DMA, or NULL if the caller will instead keep
+ *                                  \p pixels valid until @ref ili9341_wait_until_idle returns.
  *
- * @retval  ILI9341_EC_OK if the Sleep Out request was made successfully to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_NR if there was no SPI response after sending the Sleep Out requested to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ * @retval  ILI9341_EC_OK if writing the pixels was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR if \p size is zero or if something else went wrong with the SPI.
+ */
+static ILI9341_Status ili9341_queue_pixels(ILI9341_handle_t *p_handle, ILI9341_TX_ROLE_t role, const uint8_t *pixels,
+                                           uint32_t size, volatile uint8_t *p_is_buffer_in_use);
+
+/**@brief	Starts the DMA-SPI transfer of the next chunk of the segment located at the tail of the SPI Transfer Queue,
+ *          which starts at its @ref ILI9341_bus_def::tx_offset and is up to @ref ILI9341_DMA_MAX_TRANSFER_SIZE SPI
+ *          data frames long.
  *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 07, 2024.
+ * @details This function does not modify the CS and D/C pins, so that the chunks of a segment and its repetitions are
+ *          sent back to back.
+ *
+ * @note    This function must only be called either with interrupts disabled or from within
+ *          @ref ili9341_spi_tx_cplt_callback , and only when the SPI Transfer Queue is not empty.
+ * @note    In case that the DMA-SPI transfer could not be started, then this function will latch its corresponding
+ *          Exception Code and it will abort all the segments that are in the SPI Transfer Queue.
+ *
+ * @param[in] p_bus     Pointer to the SPI Bus whose SPI Transfer Queue is to be used.
  */
-static ILI9341_Status ili9341_exit_sleep_mode(void);
+static void ili9341_start_tx_chunk(ILI9341_bus_def_t *p_bus);
 
-/**@brief   Sends requests to ILI9341 for turning its Display On.
+/**@brief	Aborts all the segments that are in the SPI Transfer Queue of an SPI Bus, releases all their buffers and
+ *          the CS pin and latches a certain Exception Code into the ILI9341 Device Handle of each of those segments
+ *          to be reported by @ref ili9341_wait_until_idle .
  *
- * @note    Whenever the ILI9341 Display is turned Off, its Display will still emit light as usual, with a white
- *          background, and the only difference is that no images will be shown until the display is turned On.
+ * @details Since the shadow copies of the Address Window and of the Memory Write state are updated when their
+ *          segments are queued, rather than when they are sent, they are also invalidated for each of those ILI9341
+ *          Device Handles. Otherwise, the next @ref ili9341_set_window with the same Address Window would skip the
+ *          Column Address Set and Page Address Set that the ILI9341 Device never received.
  *
- * @retval  ILI9341_EC_OK if the Display ON request was made successfully to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_NR if there was no SPI response after sending the Display ON requested to the ILI9341 TFT LCD Device.
- * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ * @note    This function must only be called either with interrupts disabled or from within an interrupt.
  *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 07, 2024.
+ * @param[in] p_bus     Pointer to the SPI Bus whose SPI Transfer Queue is to be used.
+ * @param status    @ref ILI9341_Status Exception Code that is desired to be latched, unless another one has already
+ *                  been latched before.
  */
-static ILI9341_Status ili9341_turn_display_on(void);
+static void ili9341_abort_tx_queue(ILI9341_bus_def_t *p_bus, ILI9341_Status status);
 
-/**@brief	Signals to the ILI9341 3.2" TFT LCD Device that the incoming SPI data will stand for an ILI9341 Data Type
- *          value.
+/**@brief	Queues an ILI9341 Address Set Command (i.e., either the Column Address Set or the Page Address Set Command)
+ *          together with its Data.
  *
- * @note    This is achieved by setting and maintaining the D/C ILI9341 pin to a High state.
+ * @param[in] p_handle      Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param ili9341_command   Either @ref ILI9341_COLUMN_ADDRESS_SET_COMMAND or @ref ILI9341_PAGE_ADDRESS_SET_COMMAND .
+ * @param start             Start address (i.e., column or row) to be sent.
+ * @param end               End address (i.e., column or row) to be sent.
  *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 05, 2024.
+ * @retval  ILI9341_EC_OK if queuing the ILI9341 Address Set Command was successful.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
  */
-static void set_dc_pin_to_data_mode(void);
+static ILI9341_Status ili9341_send_address_set(ILI9341_handle_t *p_handle, uint8_t ili9341_command, uint16_t start, uint16_t end);
 
-/**@brief	Signals to the ILI9341 3.2" TFT LCD Device that the incoming SPI data will stand for an ILI9341 Command Type
- *          value.
+#if ILI9341_FIXED_BPP != 18
+/**@brief   Fills an area of the screen of the ILI9341 Display with a single/plain color given in the 16 bits per
+ *          pixel Bit Color Order.
  *
- * @note    This is achieved by setting and maintaining the D/C ILI9341 pin to a Low state.
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x0            Left-most column of the area, which must already be within the screen.
+ * @param y0            Top-most row of the area, which must already be within the screen.
+ * @param x1            Right-most column of the area, which must already be within the screen.
+ * @param y1            Bottom-most row of the area, which must already be within the screen.
+ * @param color         Color with which the area is to be filled, where only its
+ *                      @ref ILI9341_COLOR::bpp_16 field is used.
  *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 05, 2024.
+ * @retval  ILI9341_EC_OK if filling the area was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ */
+static ILI9341_Status ili9341_fill_area_16bpp(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ILI9341_COLOR color);
+#endif
+
+#if ILI9341_FIXED_BPP != 16
+/**@brief   Fills an area of the screen of the ILI9341 Display with a single/plain color given in the 18 bits per
+ *          pixel Bit Color Order.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param x0            Left-most column of the area, which must already be within the screen.
+ * @param y0            Top-most row of the area, which must already be within the screen.
+ * @param x1            Right-most column of the area, which must already be within the screen.
+ * @param y1            Bottom-most row of the area, which must already be within the screen.
+ * @param color         Color with which the area is to be filled, where only its
+ *                      @ref ILI9341_COLOR::bpp_18 field is used.
+ *
+ * @retval  ILI9341_EC_OK if filling the area was successfully requested to the ILI9341 TFT LCD Device.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
  */
-static void set_dc_pin_to_command_mode(void);
+static ILI9341_Status ili9341_fill_area_18bpp(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ILI9341_COLOR color);
+#endif
 
-// TODO: Pending to determine if the size argument of the following function really requires to be 2 bytes in size.
-/**@brief	Sends a desired data to the ILI9341 Device over the designated DMA-SPI that this module has been configured
- *          with.
+/**@brief   Queues the pixels of the line buffer of an ILI9341 Device Handle as many times as needed to write the
+ *          requested number of pixels into the current Address Window of the ILI9341 Device.
  *
- * @note    <b style="color:red">WARNING:</b> In case there is still some data pending to be send via the DMA-SPI
- *          designated to this module, then this function will first halt until that data has been completely send. Only
- *          afterwards will it make the DMA-SPI request of sending the data requested whenever calling this function.
+ * @details Since the ILI9341 Device wraps its Memory Write to the next row of the Address Window by itself, the
+ *          requested pixels do not have to be sent row by row. Instead, the line buffer is sent whole as many times as
+ *          it fits into the requested number of pixels and then, if needed, a last segment with the remaining pixels
+ *          is sent. This way, thin areas such as vertical lines also cost at most 2 segments instead of one DMA
+ *          transfer per row.
  *
- * @param[in] buffer    Pointer to the Memory Address containing the data that is desired to be sent to the ILI9341
- *                      Device.
- * @param size          Size in bytes to send to the ILI9341 Device.
+ * @note    The line buffer must have already been filled with the color to be sent. Each of the queued segments is
+ *          counted in @ref ILI9341_handle::line_buffer_users until it has been sent, so that further fills with that
+ *          same color can be queued right away while any other color has to wait for the line buffer to be free.
  *
- * @retval              ILI9341_EC_OK if requesting to send the desired data over the DMA-SPI peripheral was successful.
- * @retval				ILI9341_EC_NR if there was no SPI response after sending the requested data over the SPI peripheral.
- * @retval				ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
+ * @param[in] p_handle      Pointer to the ILI9341 Device Handle of the ILI9341 Device.
+ * @param role              Role with which the pixels of the line buffer are to be sent.
+ * @param p_line_buffer     Pointer to the field of the line buffer that holds the pixels to be sent.
+ * @param pixel_size        Size in bytes of each of the pixels of the line buffer.
+ * @param pixel_count       Number of pixels to be written into the ILI9341 Device.
  *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    November 05, 2024.
+ * @retval  ILI9341_EC_OK if queuing the pixels was successful.
+ * @retval  ILI9341_EC_NR if there was no SPI response while sending the requested data.
+ * @retval  ILI9341_EC_ERR or other @ref ILI9341_Status Exception codes if something else went wrong with the SPI.
  */
-static ILI9341_Status ili9341_dma_spi_tx(uint8_t *buffer, uint16_t size);
+static ILI9341_Status ili9341_stream_line_buffer(ILI9341_handle_t *p_handle, ILI9341_TX_ROLE_t role, const uint8_t *p_line_buffer,
+                                                 uint8_t pixel_size, uint32_t pixel_count);
 
 /**@brief	Gets the corresponding @ref ILI9341_Status value depending on the given @ref HAL_StatusTypeDef value.
  *
@@ -356,399 +656,1023 @@ static ILI9341_Status ili9341_dma_spi_tx(uint8_t *buffer, uint16_t size);
  */
 static ILI9341_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status);
 
-ILI9341_Status init_ili9341_module(SPI_HandleTypeDef *hspi, ILI9341_peripherals_def_t *peripherals)
+ILI9341_Status init_ili9341_module(ILI9341_handle_t *p_handle, SPI_HandleTypeDef *hspi, ILI9341_peripherals_def_t *peripherals)
 {
-    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
-    ILI9341_Status ret;
+    /** <b>Local \c ILI9341_bus_def_t pointer p_bus:</b> Points to the SPI Bus that will be used by the ILI9341 Device. */
+    ILI9341_bus_def_t *p_bus = NULL;
 
-    /* Persist the pointer to the specific SPI that is desired for the ILI9341 3.2" TFT LCD module to use. */
-    p_hspi = hspi;
+    /* Attach the ILI9341 Device Handle to the SPI Bus of the requested SPI, or to an unused SPI Bus if there is none yet. */
+    for (uint8_t i = 0; i < ILI9341_MAX_SPI_BUSES; i++)
+    {
+        if (ili9341_buses[i].p_hspi == hspi)
+        {
+            p_bus = &ili9341_buses[i];
+            break;
+        }
+        if ((p_bus == NULL) && (ili9341_buses[i].p_hspi == NULL))
+        {
+            p_bus = &ili9341_buses[i];
+        }
+    }
+    if (p_bus == NULL)
+    {
+        return ILI9341_EC_ERR; // There are already @ref ILI9341_MAX_SPI_BUSES different SPI peripherals in use.
+    }
+    if (p_bus->p_hspi == NULL)
+    {
+        /* Start with an empty SPI Transfer Queue. */
+        p_bus->tx_queue_head = 0;
+        p_bus->tx_queue_tail = 0;
+        p_bus->tx_queue_count = 0;
+        p_bus->p_cs_owner = NULL;
+        p_bus->p_hspi = hspi;
+        ili9341_set_spi_frame_mode(p_bus, 0); // The ILI9341 Commands are always sent in 8 bit SPI data frames.
+    }
+    p_handle->p_bus = p_bus;
 
     /* Persist the pointer to the ILI9341 3.2" TFT LCD Device's Peripherals Definition Structure. */
-    p_ili9341_peripherals = peripherals;
+    p_handle->p_peripherals = peripherals;
+#if ILI9341_GPIO_FAST_PATH
+    /* Precompute the BSRR register values that toggle the CS and D/C pins, where its lower half sets the pins and its upper half resets them. */
+    p_handle->p_cs_bsrr = &peripherals->CS.GPIO_Port->BSRR;
+    p_handle->p_dc_bsrr = &peripherals->DC.GPIO_Port->BSRR;
+    p_handle->cs_enable_mask = ((uint32_t) peripherals->CS.GPIO_Pin) << 16;
+    p_handle->cs_disable_mask = peripherals->CS.GPIO_Pin;
+    p_handle->dc_data_mask = peripherals->DC.GPIO_Pin;
+    p_handle->dc_command_mask = ((uint32_t) peripherals->DC.GPIO_Pin) << 16;
+#endif
+
+    /* Start without any segment of the ILI9341 Device in the SPI Transfer Queue. */
+    p_handle->pending_tx_segments = 0;
+    p_handle->tx_status = ILI9341_EC_OK;
+    p_handle->line_buffer_users = 0;
+    p_handle->is_line_buffer_valid = 0;
+
+    /* Invalidate the Shadow Registers since the ILI9341 Device is about to be reset. */
+    p_handle->window_shadow.is_column_valid = 0;
+    p_handle->window_shadow.is_page_valid = 0;
+    p_handle->is_memory_write_open = 0;
+    p_handle->endian = ILI9341_INTERFACE_ENDIAN; // These are the values with which the Interface Control will be configured by the @ref ili9341_init_sequence .
+    p_handle->epf = ILI9341_INTERFACE_EPF;
+    ili9341_reset_clip_rect(p_handle);
+
+#if ILI9341_FIXED_BPP == 0
+    /* Persist the Bits Per Pixel (BPP) Type with which the ILI9341 Device will be configured by the @ref ili9341_init_sequence . */
+    p_handle->p_fill_area = &ili9341_fill_area_16bpp;
+    p_handle->bpp_type = ILI9341_BPP_16;
+#endif
 
     /* Apply a Hardware Reset in the ILI9341 3.2" TFT LCD Device. */
-    disable_cs_pin(); // Make sure that the CS pin is disabled before starting the init process of the ILI9341 device.
-    ili9341_hardware_reset();
+    disable_cs_pin(p_handle); // Make sure that the CS pin is disabled before starting the init process of the ILI9341 device.
+    ili9341_hardware_reset(p_handle);
 
-    /* Apply a Software Reset in the ILI9341 3.2" TFT LCD Device. */
-    ret = ili9341_software_reset();
-    if (ret != ILI9341_EC_OK)
+    /* Send the whole ILI9341 initialization sequence (i.e., from the Software Reset up to turning the Display On). */
+    return ili9341_send_command_sequence(p_handle, ili9341_init_sequence);
+}
+
+static void ili9341_hardware_reset(ILI9341_handle_t *p_handle)
+{
+    /* Make sure that the Reset pin is in high state before starting to apply an ILI9341 hardware reset. */
+    HAL_GPIO_WritePin(p_handle->p_peripherals->RESET.GPIO_Port, p_handle->p_peripherals->RESET.GPIO_Pin, GPIO_PIN_SET);
+    HAL_Delay(1);
+
+    /* Apply an ILI9341 hardware reset. */
+    HAL_GPIO_WritePin(p_handle->p_peripherals->RESET.GPIO_Port, p_handle->p_peripherals->RESET.GPIO_Pin, GPIO_PIN_RESET);
+    HAL_Delay(1); // Datasheet states that anytime longer than 10us will be taken as a Hardware Reset.
+
+    /* Release Reset pin. */
+    HAL_GPIO_WritePin(p_handle->p_peripherals->RESET.GPIO_Port, p_handle->p_peripherals->RESET.GPIO_Pin, GPIO_PIN_SET);
+    HAL_Delay(5); // Datasheet states to wait 5ms after releasing ILI9341 RESET pin before sending commands.
+}
+
+static ILI9341_Status ili9341_send_command_sequence(ILI9341_handle_t *p_handle, const uint8_t *p_sequence)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret = ILI9341_EC_OK;
+    /** <b>Local \c uint8_t variable data_size:</b> Holds the number of Data bytes of the ILI9341 Command that is currently being interpreted. */
+    uint8_t data_size;
+
+    while (p_sequence[0] != ILI9341_SEQUENCE_END)
     {
-        return ret;
+        /* Queue the ILI9341 Command. */
+        ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_COMMAND, p_sequence, ILI9341_COMMAND_SIZE, ILI9341_TX_BUFFER_BORROWED, NULL);
+        if (ret != ILI9341_EC_OK)
+        {
+            break;
+        }
+
+        /* Queue the Data of that ILI9341 Command, if any. */
+        data_size = p_sequence[1] & (~ILI9341_SEQUENCE_DELAY_FLAG);
+        if (data_size != 0)
+        {
+            ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_DATA, &p_sequence[2], data_size, ILI9341_TX_BUFFER_BORROWED, NULL);
+            if (ret != ILI9341_EC_OK)
+            {
+                break;
+            }
+        }
+
+        /* Apply the delay requested after that ILI9341 Command, if any. */
+        if (p_sequence[1] & ILI9341_SEQUENCE_DELAY_FLAG)
+        {
+            ret = ili9341_wait_until_idle(p_handle); // The delay has to be counted from the moment in which the command has been completely sent.
+            if (ret != ILI9341_EC_OK)
+            {
+                break;
+            }
+            HAL_Delay(p_sequence[2 + data_size]);
+            p_sequence++;
+        }
+        p_sequence += 2 + data_size;
     }
+    ili9341_release_cs(p_handle);
 
-    /* Configure the ILI9341 Power Control 1 to have its GVDD Level set to 4.6V. */
-    ret = ili9341_configure_power_control_1(ILI9341_GVDD_4V6);
+    /* Wait until the whole ILI9341 Command Sequence has been sent, while also reporting any error latched meanwhile. */
     if (ret != ILI9341_EC_OK)
     {
+        ili9341_wait_until_idle(p_handle);
         return ret;
     }
+    return ili9341_wait_until_idle(p_handle);
+}
 
-    /* Configure the ILI9341 Power Control 2. */
-    // Default ILI9341 configuration will be left here.
+void ili9341_spi_tx_cplt_callback(SPI_HandleTypeDef *hspi)
+{
+    /** <b>Local \c ILI9341_bus_def_t pointer p_bus:</b> Points to the SPI Bus whose DMA-SPI transfer has just been completed. */
+    ILI9341_bus_def_t *p_bus = NULL;
+    /** <b>Local \c ILI9341_tx_segment_def_t pointer p_segment:</b> Points to the segment of the SPI Transfer Queue whose DMA-SPI transfer has just been completed. */
+    ILI9341_tx_segment_def_t *p_segment;
 
-    /* Configure the VCOM Control 1 to have its VCOMH and VCOML voltages set to 4.25V and -1.5V respectively.  */
-    ret = ili9341_configure_vcom_control_1(ILI9341_VCOMH_4V25, ILI9341_VCOML_minus_1V5);
-    if (ret != ILI9341_EC_OK)
+    for (uint8_t i = 0; i < ILI9341_MAX_SPI_BUSES; i++)
     {
-        return ret;
+        if (ili9341_buses[i].p_hspi == hspi)
+        {
+            p_bus = &ili9341_buses[i];
+            break;
+        }
     }
-
-    /* Configure the VCOM Control 2 so that VMH and VML have an offset of -58 and -58 respectively. */
-    ret = ili9341_configure_vcom_control_2(ILI9341_VMF_minus_58);
-    if (ret != ILI9341_EC_OK)
+    if ((p_bus == NULL) || (hspi == NULL) || (p_bus->tx_queue_count == 0))
     {
-        return ret;
+        return; // The completed transfer does not belong to the @ref ili9341 .
     }
 
-    /* Configure the Memory Access Control. */
-    ret = ili9341_configure_memory_access_control();
-    if (ret != ILI9341_EC_OK)
+    /* Send the next chunk of the segment whose DMA-SPI transfer has just been completed, if any. */
+    p_segment = &p_bus->tx_queue[p_bus->tx_queue_tail];
+    p_bus->tx_offset += p_bus->tx_chunk_size;
+    if (p_bus->tx_offset < p_segment->size)
     {
-        return ret;
+        ili9341_start_tx_chunk(p_bus);
+        return;
     }
 
-    /* Configure the Pixel Format. */
-    ret = ili9341_configure_pixel_format();
-    if (ret != ILI9341_EC_OK)
+    /* Send the buffer of the segment that has just been sent once again if it was requested to be repeated. */
+    if (p_segment->repeat_count > 1)
     {
-        return ret;
+        p_segment->repeat_count--;
+        p_bus->tx_offset = 0;
+        ili9341_start_tx_chunk(p_bus);
+        return;
     }
 
-    /* Configure the Frame Rate Control. */
-    // Default ILI9341 configuration will be left here.
+    /* Release the buffer and, if requested, the CS pin of the segment that has just been sent. */
+    if (p_segment->ownership == ILI9341_TX_BUFFER_RELEASED)
+    {
+        *(p_segment->p_is_buffer_in_use) = 0;
+    }
+    else if (p_segment->ownership == ILI9341_TX_BUFFER_COUNTED)
+    {
+        (*(p_segment->p_is_buffer_in_use))--;
+    }
+    if (p_segment->is_cs_released)
+    {
+        disable_cs_pin(p_segment->p_handle);
+        p_bus->p_cs_owner = NULL;
+    }
+    p_segment->p_handle->pending_tx_segments--;
 
-    /* Configure Read Display MADCTL. */
-    // Default ILI9341 configuration will be left here (meaning that MADCTL's B5=0 or, i.e., that the maximum column and row in the frame memory where the ILI9341's MCU can access will be 240 and 320 respectively).
+    /* Remove that segment from the SPI Transfer Queue and start sending the next one, if any. */
+    p_bus->tx_queue_tail = (p_bus->tx_queue_tail + 1) % ILI9341_TX_QUEUE_LENGTH;
+    p_bus->tx_queue_count--;
+    if (p_bus->tx_queue_count != 0)
+    {
+        ili9341_start_tx_segment(p_bus);
+    }
+}
 
-    /* Configure the Display Function Control. */
-    ret = ili9341_configure_display_function_control();
-    if (ret != ILI9341_EC_OK)
+void ili9341_spi_error_callback(SPI_HandleTypeDef *hspi)
+{
+    for (uint8_t i = 0; i < ILI9341_MAX_SPI_BUSES; i++)
     {
-        return ret;
+        if ((hspi != NULL) && (ili9341_buses[i].p_hspi == hspi))
+        {
+            ili9341_abort_tx_queue(&ili9341_buses[i], ILI9341_EC_ERR);
+            return;
+        }
     }
+    // The error does not belong to the @ref ili9341 .
+}
 
-    /* Configure the desired Gamma Curve for the ILI9341 Display. */
-    // Default ILI9341 configuration will be left here.
+uint8_t ili9341_is_busy(ILI9341_handle_t *p_handle)
+{
+    return (p_handle->pending_tx_segments != 0);
+}
 
-    /* Configure Positive Gamma Correction. */
-    // Default ILI9341 configuration will be left here.
+ILI9341_Status ili9341_wait_until_idle(ILI9341_handle_t *p_handle)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret;
 
-    /* Configure Negative Gamma Correction. */
-    // Default ILI9341 configuration will be left here.
+    while (p_handle->pending_tx_segments != 0); // Wait until all the segments of the ILI9341 Device have been sent by @ref ili9341_spi_tx_cplt_callback .
 
-    /* Make ILI9341 exit Sleep Mode. */
-    ret = ili9341_exit_sleep_mode();
-    if (ret != ILI9341_EC_OK)
+    /* Report and clear the first error that was latched while sending the segments of the ILI9341 Device (if any). */
+    ret = p_handle->tx_status;
+    p_handle->tx_status = ILI9341_EC_OK;
+
+    return ret;
+}
+
+#if ILI9341_FIXED_BPP != 0
+ILI9341_Status set_ili9341_bpp_type(ILI9341_handle_t *p_handle, ILI9341_BPP_t bpp)
+{
+    if ((bpp != ILI9341_BPP_16) && (bpp != ILI9341_BPP_18))
     {
-        return ret;
+        return ILI9341_EC_ERR; // The requested BPP type is not recognized. Therefore, send Error Exception Code.
     }
+    return (bpp == ILI9341_BPP_TYPE(p_handle)) ? ILI9341_EC_OK : ILI9341_EC_NA;
+}
+#else
+ILI9341_Status set_ili9341_bpp_type(ILI9341_handle_t *p_handle, ILI9341_BPP_t bpp)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret;
+    /** <b>Local \c uint8_t variable ili9341_command:</b> Holds the ILI9341 Command that will be sent to it via the SPI-DMA peripheral. */
+    uint8_t ili9341_command = ILI9341_PIXEL_FORMAT_COMMAND;
+    /** <b>Local \c uint8_t variable ili9341_data_value:</b> Holds the Pixel Format Data value that will be sent to the ILI9341 Device via the SPI-DMA peripheral. */
+    uint8_t ili9341_data_value;
+    /** <b>Local \c ILI9341_Status function pointer p_fill_area:</b> Points to the function that fills an area of the screen in the requested Bits Per Pixel (BPP) type. */
+    ILI9341_Status (*p_fill_area)(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ILI9341_COLOR color);
 
-    /* Turn ILI9341 Display On. */
-    ret = ili9341_turn_display_on();
-    if (ret != ILI9341_EC_OK)
+    switch (bpp)
     {
-        return ret;
+        case ILI9341_BPP_16:
+            ili9341_data_value = ILI9341_PIXEL_FORMAT_16BPP_VALUE;
+            p_fill_area = &ili9341_fill_area_16bpp;
+            break;
+        case ILI9341_BPP_18:
+            ili9341_data_value = ILI9341_PIXEL_FORMAT_18BPP_VALUE;
+            p_fill_area = &ili9341_fill_area_18bpp;
+            break;
+        default:
+            return ILI9341_EC_ERR; // The requested BPP type is not recognized. Therefore, send Error Exception Code.
+    }
+    if (bpp == p_handle->bpp_type)
+    {
+        return ILI9341_EC_OK; // The ILI9341 Device already has the requested Pixel Format.
     }
 
-    return ILI9341_EC_OK;
+    /* Send the Pixel Format Set and, once queued, update the fill screen function pointer and the Bits Per Pixel (BPP) Type of the ILI9341 Device Handle. */
+    ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_COMMAND, &ili9341_command, ILI9341_COMMAND_SIZE, ILI9341_TX_BUFFER_INLINE, NULL);
+    if (ret == ILI9341_EC_OK)
+    {
+        ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_DATA, &ili9341_data_value, sizeof(ili9341_data_value), ILI9341_TX_BUFFER_INLINE, NULL);
+    }
+    ili9341_release_cs(p_handle);
+    if (ret == ILI9341_EC_OK)
+    {
+        p_handle->p_fill_area = p_fill_area;
+        p_handle->bpp_type = bpp;
+        p_handle->is_line_buffer_valid = 0; // The line buffer holds its color in the Bit Color Order of the previous Bits Per Pixel (BPP) type.
+    }
+
+    return ret;
 }
+#endif
 
-static void ili9341_hardware_reset(void)
+ILI9341_BPP_t get_ili9341_bpp_type(ILI9341_handle_t *p_handle)
 {
-    /* Make sure that the Reset pin is in high state before starting to apply an ILI9341 hardware reset. */
-    HAL_GPIO_WritePin(p_ili9341_peripherals->RESET.GPIO_Port, p_ili9341_peripherals->RESET.GPIO_Pin, GPIO_PIN_SET);
-    HAL_Delay(1);
-
-    /* Apply an ILI9341 hardware reset. */
-    HAL_GPIO_WritePin(p_ili9341_peripherals->RESET.GPIO_Port, p_ili9341_peripherals->RESET.GPIO_Pin, GPIO_PIN_RESET);
-    HAL_Delay(1); // Datasheet states that anytime longer than 10us will be taken as a Hardware Reset.
-
-    /* Release Reset pin. */
-    HAL_GPIO_WritePin(p_ili9341_peripherals->RESET.GPIO_Port, p_ili9341_peripherals->RESET.GPIO_Pin, GPIO_PIN_SET);
-    HAL_Delay(5); // Datasheet states to wait 5ms after releasing ILI9341 RESET pin before sending commands.
+    return ILI9341_BPP_TYPE(p_handle);
 }
 
-static ILI9341_Status ili9341_software_reset(void)
+ILI9341_Status ili9341_set_window(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
     /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
     ILI9341_Status ret;
+    /** <b>Local \c ILI9341_window_shadow_def_t pointer p_shadow:</b> Points to the Address Window Shadow Registers of the ILI9341 Device. */
+    ILI9341_window_shadow_def_t *p_shadow = &p_handle->window_shadow;
     /** <b>Local \c uint8_t variable ili9341_command:</b> Holds the ILI9341 Command that will be sent to it via the SPI-DMA peripheral. */
-    uint8_t ili9341_command = ILI9341_SOFTWARE_RESET_COMMAND;
+    uint8_t ili9341_command = ILI9341_MEMORY_WRITE_COMMAND;
+
+    if ((x0 > x1) || (y0 > y1) || (x1 >= ILI9341_SCREEN_WIDTH) || (y1 >= ILI9341_SCREEN_HEIGHT))
+    {
+        return ILI9341_EC_NA;
+    }
+
+    /* Send the Column Address Set only if the columns of the Address Window have changed. */
+    if ((!p_shadow->is_column_valid) || (p_shadow->x0 != x0) || (p_shadow->x1 != x1))
+    {
+        p_shadow->is_column_valid = 0; // Stays invalid in case that queuing the command fails.
+        ret = ili9341_send_address_set(p_handle, ILI9341_COLUMN_ADDRESS_SET_COMMAND, x0, x1);
+        if (ret != ILI9341_EC_OK)
+        {
+            ili9341_release_cs(p_handle);
+            return ret;
+        }
+        p_shadow->x0 = x0;
+        p_shadow->x1 = x1;
+        p_shadow->is_column_valid = 1;
+    }
+
+    /* Send the Page Address Set only if the rows of the Address Window have changed. */
+    if ((!p_shadow->is_page_valid) || (p_shadow->y0 != y0) || (p_shadow->y1 != y1))
+    {
+        p_shadow->is_page_valid = 0; // Stays invalid in case that queuing the command fails.
+        ret = ili9341_send_address_set(p_handle, ILI9341_PAGE_ADDRESS_SET_COMMAND, y0, y1);
+        if (ret != ILI9341_EC_OK)
+        {
+            ili9341_release_cs(p_handle);
+            return ret;
+        }
+        p_shadow->y0 = y0;
+        p_shadow->y1 = y1;
+        p_shadow->is_page_valid = 1;
+    }
 
-    set_dc_pin_to_command_mode();
-    enable_cs_pin();
-    ret = ili9341_dma_spi_tx(&ili9341_command, ILI9341_COMMAND_SIZE);
-    disable_cs_pin();
-    HAL_Delay(5); // Datasheet states to wait 5ms after sending an ILI9341 Software Reset Command.
+    /* Start a Memory Write so that the next pixels are written from the top-left corner of the Address Window. */
+    ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_COMMAND, &ili9341_command, ILI9341_COMMAND_SIZE, ILI9341_TX_BUFFER_INLINE, NULL);
+    ili9341_release_cs(p_handle);
 
     return ret;
 }
 
-static ILI9341_Status ili9341_configure_power_control_1(ILI9341_GVDD_t gvdd_level)
+ILI9341_Status ili9341_write_pixels(ILI9341_handle_t *p_handle, const uint8_t *pixels, uint32_t size, volatile uint8_t *p_is_buffer_in_use)
+{
+    return ili9341_queue_pixels(p_handle, ILI9341_TX_ROLE_DATA, pixels, size, p_is_buffer_in_use);
+}
+
+ILI9341_Status ili9341_write_pixels_16bpp(ILI9341_handle_t *p_handle, const uint16_t *pixels, uint32_t count, volatile uint8_t *p_is_buffer_in_use)
+{
+    if (ILI9341_BPP_TYPE(p_handle) != ILI9341_BPP_16)
+    {
+        return ILI9341_EC_NA;
+    }
+    return ili9341_queue_pixels(p_handle, ILI9341_TX_ROLE_DATA_16BIT, (const uint8_t *) pixels, count * ILI9341_16BPP_PIXEL_SIZE, p_is_buffer_in_use);
+}
+
+ILI9341_Status ili9341_set_interface_control(ILI9341_handle_t *p_handle, ILI9341_ENDIAN_t endian, ILI9341_EPF_t epf)
 {
     /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
     ILI9341_Status ret;
-    /** <b>Local \c uint8_t variable ili9341_command_or_data_value:</b> Holds either a Command or a Data that will be sent to the ILI9341 Device via the SPI-DMA peripheral. */
-    uint8_t ili9341_command_or_data_value = ILI9341_POWER_CONTROL_1_COMMAND;
+    /** <b>Local \c uint8_t variable ili9341_command:</b> Holds the ILI9341 Command that will be sent to it via the SPI-DMA peripheral. */
+    uint8_t ili9341_command = ILI9341_INTERFACE_CONTROL_COMMAND;
+    /** <b>Local \c uint8_t 3-bytes array variable ili9341_data_value:</b> Holds the Data of the Interface Control that will be sent to the ILI9341 Device via the SPI-DMA peripheral. */
+    uint8_t ili9341_data_value[ILI9341_INTERFACE_CONTROL_DATA_SIZE] = {ILI9341_INTERFACE_CONTROL_1ST_VALUE, (uint8_t) (epf << ILI9341_INTERFACE_CONTROL_EPF_POS), (uint8_t) (endian << ILI9341_INTERFACE_CONTROL_ENDIAN_POS)};
 
-    set_dc_pin_to_command_mode();
-    enable_cs_pin();
-    ret = ili9341_dma_spi_tx(&ili9341_command_or_data_value, ILI9341_COMMAND_SIZE);
-    if (ret != ILI9341_EC_OK)
+    if ((endian != ILI9341_ENDIAN_BIG) || (epf > ILI9341_EPF_GREEN_LSB))
     {
-        disable_cs_pin();
-        return ret;
+        return ILI9341_EC_ERR; // The ILI9341 Device does not honour @ref ILI9341_ENDIAN_LITTLE through its serial interface.
+    }
+    if ((p_handle->endian == endian) && (p_handle->epf == epf))
+    {
+        return ILI9341_EC_OK; // The ILI9341 Device already has the requested Interface Control.
     }
 
-    set_dc_pin_to_data_mode();
-    ili9341_command_or_data_value = (uint8_t) gvdd_level;
-    ret = ili9341_dma_spi_tx(&ili9341_command_or_data_value, ILI9341_SINGLE_DATA_SIZE);
-    disable_cs_pin();
+    ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_COMMAND, &ili9341_command, ILI9341_COMMAND_SIZE, ILI9341_TX_BUFFER_INLINE, NULL);
+    if (ret == ILI9341_EC_OK)
+    {
+        ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_DATA, ili9341_data_value, ILI9341_INTERFACE_CONTROL_DATA_SIZE, ILI9341_TX_BUFFER_INLINE, NULL);
+    }
+    ili9341_release_cs(p_handle);
+    if (ret == ILI9341_EC_OK)
+    {
+        p_handle->endian = (uint8_t) endian;
+        p_handle->epf = (uint8_t) epf;
+    }
 
     return ret;
 }
 
-static ILI9341_Status ili9341_configure_vcom_control_1(ILI9341_VCOMH_t vcomh_voltage, ILI9341_VCOML_t vcoml_voltage)
+static ILI9341_Status ili9341_queue_pixels(ILI9341_handle_t *p_handle, ILI9341_TX_ROLE_t role, const uint8_t *pixels,
+                                           uint32_t size, volatile uint8_t *p_is_buffer_in_use)
 {
     /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
     ILI9341_Status ret;
     /** <b>Local \c uint8_t variable ili9341_command:</b> Holds the ILI9341 Command that will be sent to it via the SPI-DMA peripheral. */
-    uint8_t ili9341_command = ILI9341_VCOM_CONTROL_1_COMMAND;
+    uint8_t ili9341_command = ILI9341_MEMORY_WRITE_CONTINUE_COMMAND;
 
-    set_dc_pin_to_command_mode();
-    enable_cs_pin();
-    ret = ili9341_dma_spi_tx(&ili9341_command, ILI9341_COMMAND_SIZE);
-    if (ret != ILI9341_EC_OK)
+    /* Resume the Memory Write in case that another command was sent to the ILI9341 Device after the last written pixel. */
+    if (!p_handle->is_memory_write_open)
     {
-        disable_cs_pin();
-        return ret;
+        ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_COMMAND, &ili9341_command, ILI9341_COMMAND_SIZE, ILI9341_TX_BUFFER_INLINE, NULL);
+        if (ret != ILI9341_EC_OK)
+        {
+            ili9341_release_cs(p_handle);
+            return ret;
+        }
     }
 
-    set_dc_pin_to_data_mode();
-    /** <b>Local \c uint8_t 2-bytes array variable ili9341_data_value:</b> Holds both the VCOMH, in the first byte, and VCOML Voltages, in the second byte, with which it is desired to configure the VCOM Control 1 of the ILI9341 Device and that will be sent to it via the SPI-DMA peripheral. */
-    uint8_t ili9341_data_value[ILI9341_VCOM_CONTROL_1_DATA_SIZE] = {(uint8_t) vcomh_voltage, (uint8_t) vcoml_voltage};
-    ret = ili9341_dma_spi_tx(ili9341_data_value, ILI9341_VCOM_CONTROL_1_DATA_SIZE);
-    disable_cs_pin();
+    /* Queue the pixels. */
+    if (p_is_buffer_in_use == NULL)
+    {
+        ret = ili9341_dma_spi_tx(p_handle, role, pixels, size, ILI9341_TX_BUFFER_BORROWED, NULL);
+    }
+    else
+    {
+        *p_is_buffer_in_use = 1;
+        ret = ili9341_dma_spi_tx(p_handle, role, pixels, size, ILI9341_TX_BUFFER_RELEASED, p_is_buffer_in_use);
+        if (ret != ILI9341_EC_OK)
+        {
+            *p_is_buffer_in_use = 0;
+        }
+    }
+    ili9341_release_cs(p_handle);
 
     return ret;
 }
 
-static ILI9341_Status ili9341_configure_vcom_control_2(ILI9341_VMF_t vmf_offset)
+ILI9341_Status ili9341_fill_screen(ILI9341_handle_t *p_handle, ILI9341_COLOR color)
+{
+    return ili9341_fill_rect(p_handle, 0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT, color);
+}
+
+ILI9341_Status ili9341_fill_rect(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height, ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_clip_rect_def_t pointer p_clip:</b> Points to the Clip Rectangle of the ILI9341 Device. */
+    const ILI9341_clip_rect_def_t *p_clip = &p_handle->clip_rect;
+    /** <b>Local \c int32_t variable x0:</b> Left-most column of the requested rectangle after being clipped to the Clip Rectangle. */
+    int32_t x0 = (x < p_clip->x0) ? p_clip->x0 : x;
+    /** <b>Local \c int32_t variable y0:</b> Top-most row of the requested rectangle after being clipped to the Clip Rectangle. */
+    int32_t y0 = (y < p_clip->y0) ? p_clip->y0 : y;
+    /** <b>Local \c int32_t variable x1:</b> Right-most column of the requested rectangle after being clipped to the Clip Rectangle. */
+    int32_t x1 = (int32_t) x + width - 1;
+    /** <b>Local \c int32_t variable y1:</b> Bottom-most row of the requested rectangle after being clipped to the Clip Rectangle. */
+    int32_t y1 = (int32_t) y + height - 1;
+
+    /* Clip the requested rectangle to the Clip Rectangle and reject it, before any SPI traffic, if nothing of it is left. */
+    if (x1 > p_clip->x1)
+    {
+        x1 = p_clip->x1;
+    }
+    if (y1 > p_clip->y1)
+    {
+        y1 = p_clip->y1;
+    }
+    if ((width == 0) || (height == 0) || (x0 > x1) || (y0 > y1))
+    {
+        return ILI9341_EC_NA;
+    }
+
+#if ILI9341_FIXED_BPP == 16
+    return ili9341_fill_area_16bpp(p_handle, (uint16_t) x0, (uint16_t) y0, (uint16_t) x1, (uint16_t) y1, color);
+#elif ILI9341_FIXED_BPP == 18
+    return ili9341_fill_area_18bpp(p_handle, (uint16_t) x0, (uint16_t) y0, (uint16_t) x1, (uint16_t) y1, color);
+#else
+    return (*p_handle->p_fill_area)(p_handle, (uint16_t) x0, (uint16_t) y0, (uint16_t) x1, (uint16_t) y1, color);
+#endif
+}
+
+ILI9341_Status ili9341_draw_hline(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, ILI9341_COLOR color)
+{
+    return ili9341_fill_rect(p_handle, x, y, width, 1, color);
+}
+
+ILI9341_Status ili9341_draw_vline(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t height, ILI9341_COLOR color)
+{
+    return ili9341_fill_rect(p_handle, x, y, 1, height, color);
+}
+
+ILI9341_Status ili9341_draw_pixel(ILI9341_handle_t *p_handle, int16_t x, int16_t y, ILI9341_COLOR color)
 {
     /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
     ILI9341_Status ret;
-    /** <b>Local \c uint8_t variable ili9341_command_or_data_value:</b> Holds either a Command or a Data that will be sent to the ILI9341 Device via the SPI-DMA peripheral. */
-    uint8_t ili9341_command_or_data_value = ILI9341_VCOM_CONTROL_2_COMMAND;
+    /** <b>Local \c uint8_t 3-bytes array variable pixel:</b> Holds the requested color expanded into the 3 bytes with which an 18 bits per pixel pixel is sent to the ILI9341 Device. */
+    uint8_t pixel[ILI9341_18BPP_PIXEL_SIZE];
+
+    if ((x < p_handle->clip_rect.x0) || (y < p_handle->clip_rect.y0) || (x > p_handle->clip_rect.x1) || (y > p_handle->clip_rect.y1))
+    {
+        return ILI9341_EC_NA;
+    }
 
-    set_dc_pin_to_command_mode();
-    enable_cs_pin();
-    ret = ili9341_dma_spi_tx(&ili9341_command_or_data_value, ILI9341_COMMAND_SIZE);
+    /* Set the Address Window to the requested pixel and queue its color inside the SPI Transfer Queue itself. */
+    ret = ili9341_set_window(p_handle, (uint16_t) x, (uint16_t) y, (uint16_t) x, (uint16_t) y);
     if (ret != ILI9341_EC_OK)
     {
-        disable_cs_pin();
         return ret;
     }
-
-    set_dc_pin_to_data_mode();
-    ili9341_command_or_data_value = (uint8_t) vmf_offset;
-    ret = ili9341_dma_spi_tx(&ili9341_command_or_data_value, ILI9341_SINGLE_DATA_SIZE);
-    disable_cs_pin();
+    if (ILI9341_BPP_TYPE(p_handle) == ILI9341_BPP_16)
+    {
+        ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_DATA_16BIT, (const uint8_t *) &color.bpp_16, ILI9341_16BPP_PIXEL_SIZE,
+                                 ILI9341_TX_BUFFER_INLINE, NULL);
+    }
+    else
+    {
+        pixel[0] = (uint8_t) (color.bpp_18 >> 16) & ILI9341_18BPP_COLOR_MASK;
+        pixel[1] = (uint8_t) (color.bpp_18 >> 8) & ILI9341_18BPP_COLOR_MASK;
+        pixel[2] = (uint8_t) color.bpp_18 & ILI9341_18BPP_COLOR_MASK;
+        ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_DATA, pixel, ILI9341_18BPP_PIXEL_SIZE, ILI9341_TX_BUFFER_INLINE, NULL);
+    }
+    ili9341_release_cs(p_handle);
 
     return ret;
 }
 
-static ILI9341_Status ili9341_configure_memory_access_control(void)
+ILI9341_Status ili9341_set_clip_rect(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+    /** <b>Local \c int32_t variable x1:</b> Right-most column of the requested rectangle. */
+    int32_t x1 = (int32_t) x + width - 1;
+    /** <b>Local \c int32_t variable y1:</b> Bottom-most row of the requested rectangle. */
+    int32_t y1 = (int32_t) y + height - 1;
+
+    if ((width == 0) || (height == 0) || (x1 < 0) || (y1 < 0) || (x >= ILI9341_SCREEN_WIDTH) || (y >= ILI9341_SCREEN_HEIGHT))
+    {
+        return ILI9341_EC_NA;
+    }
+    p_handle->clip_rect.x0 = (x < 0) ? 0 : (uint16_t) x;
+    p_handle->clip_rect.y0 = (y < 0) ? 0 : (uint16_t) y;
+    p_handle->clip_rect.x1 = (x1 >= ILI9341_SCREEN_WIDTH) ? (ILI9341_SCREEN_WIDTH - 1) : (uint16_t) x1;
+    p_handle->clip_rect.y1 = (y1 >= ILI9341_SCREEN_HEIGHT) ? (ILI9341_SCREEN_HEIGHT - 1) : (uint16_t) y1;
+
+    return ILI9341_EC_OK;
+}
+
+void ili9341_reset_clip_rect(ILI9341_handle_t *p_handle)
+{
+    p_handle->clip_rect.x0 = 0;
+    p_handle->clip_rect.y0 = 0;
+    p_handle->clip_rect.x1 = ILI9341_SCREEN_WIDTH - 1;
+    p_handle->clip_rect.y1 = ILI9341_SCREEN_HEIGHT - 1;
+}
+
+ILI9341_Status ili9341_blit(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t *pixels,
+                            uint16_t stride)
 {
     /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
     ILI9341_Status ret;
-    /** <b>Local \c uint8_t variable ili9341_command:</b> Holds the ILI9341 Command that will be sent to it via the SPI-DMA peripheral. */
-    uint8_t ili9341_command = ILI9341_MEMORY_ACCESS_CONTROL_COMMAND;
+    /** <b>Local \c ILI9341_clip_rect_def_t pointer p_clip:</b> Points to the Clip Rectangle of the ILI9341 Device. */
+    const ILI9341_clip_rect_def_t *p_clip = &p_handle->clip_rect;
+    /** <b>Local \c int32_t variable x0:</b> Left-most column of the bitmap after being clipped to the Clip Rectangle. */
+    int32_t x0 = (x < p_clip->x0) ? p_clip->x0 : x;
+    /** <b>Local \c int32_t variable y0:</b> Top-most row of the bitmap after being clipped to the Clip Rectangle. */
+    int32_t y0 = (y < p_clip->y0) ? p_clip->y0 : y;
+    /** <b>Local \c int32_t variable x1:</b> Right-most column of the bitmap after being clipped to the Clip Rectangle. */
+    int32_t x1 = (int32_t) x + width - 1;
+    /** <b>Local \c int32_t variable y1:</b> Bottom-most row of the bitmap after being clipped to the Clip Rectangle. */
+    int32_t y1 = (int32_t) y + height - 1;
+    /** <b>Local \c uint32_t variable row_size:</b> Size in bytes of the visible part of each row of the bitmap. */
+    uint32_t row_size;
+
+    if ((pixels == NULL) || (stride < width))
+    {
+        return ILI9341_EC_ERR;
+    }
+    if (ILI9341_BPP_TYPE(p_handle) != ILI9341_BPP_16)
+    {
+        return ILI9341_EC_NA;
+    }
+
+    /* Clip the bitmap to the Clip Rectangle and reject it, before any SPI traffic, if nothing of it is left. */
+    x1 = (x1 > p_clip->x1) ? p_clip->x1 : x1;
+    y1 = (y1 > p_clip->y1) ? p_clip->y1 : y1;
+    if ((width == 0) || (height == 0) || (x0 > x1) || (y0 > y1))
+    {
+        return ILI9341_EC_NA;
+    }
+    pixels += (uint32_t) (y0 - y) * stride + (uint32_t) (x0 - x); // First visible pixel of the bitmap.
+    row_size = (uint32_t) (x1 - x0 + 1) * ILI9341_16BPP_PIXEL_SIZE;
 
-    set_dc_pin_to_command_mode();
-    enable_cs_pin();
-    ret = ili9341_dma_spi_tx(&ili9341_command, ILI9341_COMMAND_SIZE);
+    ret = ili9341_set_window(p_handle, (uint16_t) x0, (uint16_t) y0, (uint16_t) x1, (uint16_t) y1);
     if (ret != ILI9341_EC_OK)
     {
-        disable_cs_pin();
         return ret;
     }
 
-    set_dc_pin_to_data_mode();
-    /** <b>Local \c ILI9341_MADCTL_def_t variable ili9341_data_value:</b> Holds the configuration desired for the Memory Access Control Data, which is to be sent to the ILI9341 Device via the SPI-DMA peripheral. */
-    ILI9341_MADCTL_def_t ili9341_data_value = {0};
-    ili9341_data_value.mh = 0;
-    ili9341_data_value.bgr = 1;
-    ili9341_data_value.ml = 0;
-    ILI9341_MADCTL_MCU_WRITE_READ_DIRECTION_def_t wr_rd_dir = {0};
-    wr_rd_dir.mv = 0;
-    wr_rd_dir.mx = 1;
-    wr_rd_dir.my = 0;
-    ili9341_data_value.wr_rd_dir = *((uint8_t *) &wr_rd_dir);
-    ret = ili9341_dma_spi_tx(((uint8_t *) &ili9341_data_value), ILI9341_SINGLE_DATA_SIZE);
-    disable_cs_pin();
+    /* Send the visible rows straight from the bitmap, either as a single segment whenever they lie back to back in memory or as one segment per row. */
+    if ((x1 - x0 + 1 == stride) || (y0 == y1))
+    {
+        ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_DATA_16BIT, (const uint8_t *) pixels, row_size * (uint32_t) (y1 - y0 + 1), ILI9341_TX_BUFFER_BORROWED, NULL);
+    }
+    else
+    {
+        for (int32_t row = y0; (row <= y1) && (ret == ILI9341_EC_OK); row++, pixels += stride)
+        {
+            ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_DATA_16BIT, (const uint8_t *) pixels, row_size, ILI9341_TX_BUFFER_BORROWED, NULL);
+        }
+    }
+    ili9341_release_cs(p_handle);
 
     return ret;
 }
 
-// TODO: Pending to give versatility to this function so that it can allow its implementer to choose in between having 16-bits per pixel and 18-bits per pixel in order so that the color Union made in this library makes more sense.
-static ILI9341_Status ili9341_configure_pixel_format(void)
+#if ILI9341_FIXED_BPP != 16
+static ILI9341_Status ili9341_fill_area_18bpp(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ILI9341_COLOR color)
 {
     /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
     ILI9341_Status ret;
-    /** <b>Local \c uint8_t variable ili9341_command:</b> Holds the ILI9341 Command that will be sent to it via the SPI-DMA peripheral. */
-    uint8_t ili9341_command = ILI9341_PIXEL_FORMAT_COMMAND;
+    /** <b>Local \c uint32_t variable pixel_count:</b> Number of pixels of the requested area. */
+    uint32_t pixel_count = (uint32_t) (x1 - x0 + 1) * (y1 - y0 + 1);
+
+    /* Unless the line buffer already holds the requested color, wait until it is no longer in use by a previous fill and then expand the requested color into it. */
+    if ((!p_handle->is_line_buffer_valid) || (p_handle->line_buffer_color != color.bpp_18))
+    {
+        while (p_handle->line_buffer_users != 0);
+        for (uint16_t i = 0; i < ILI9341_18BPP_LINE_SIZE; i += ILI9341_18BPP_PIXEL_SIZE)
+        {
+            p_handle->line_buffer.bpp_18[i] = (uint8_t) (color.bpp_18 >> 16) & ILI9341_18BPP_COLOR_MASK;
+            p_handle->line_buffer.bpp_18[i + 1] = (uint8_t) (color.bpp_18 >> 8) & ILI9341_18BPP_COLOR_MASK;
+            p_handle->line_buffer.bpp_18[i + 2] = (uint8_t) color.bpp_18 & ILI9341_18BPP_COLOR_MASK;
+        }
+        p_handle->line_buffer_color = color.bpp_18;
+        p_handle->is_line_buffer_valid = 1;
+    }
+
+    /* Set the Address Window to the requested area and stream the line buffer into it. */
+    ret = ili9341_set_window(p_handle, x0, y0, x1, y1);
+    if (ret != ILI9341_EC_OK)
+    {
+        return ret;
+    }
+    return ili9341_stream_line_buffer(p_handle, ILI9341_TX_ROLE_DATA, p_handle->line_buffer.bpp_18, ILI9341_18BPP_PIXEL_SIZE, pixel_count);
+}
+#endif
+
+#if ILI9341_FIXED_BPP != 18
+static ILI9341_Status ili9341_fill_area_16bpp(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ILI9341_COLOR color)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret;
+    /** <b>Local \c uint32_t variable pixel_count:</b> Number of pixels of the requested area. */
+    uint32_t pixel_count = (uint32_t) (x1 - x0 + 1) * (y1 - y0 + 1);
 
-    /* Update the @ref p_ili9341_fill_screen pointer and update @ref ili9341_bpp_type (for now, this is fixed to 16bpp; switch-case with 18bpp configuration is pending to be made). */
-    p_ili9341_fill_screen = &ili9341_fill_screen_16bpp;
-    ili9341_bpp_type = ILI9341_BPP_16;
+    /* Unless the line buffer already holds the requested color, wait until it is no longer in use by a previous fill and then fill it with the requested color. */
+    if ((!p_handle->is_line_buffer_valid) || (p_handle->line_buffer_color != color.bpp_16))
+    {
+        while (p_handle->line_buffer_users != 0);
+        for (uint16_t i = 0; i < ILI9341_SCREEN_WIDTH; i++)
+        {
+            p_handle->line_buffer.bpp_16[i] = color.bpp_16; // Sent in 16 bit SPI data frames, which shift out the Most Significant Byte first as the ILI9341 Device expects.
+        }
+        p_handle->line_buffer_color = color.bpp_16;
+        p_handle->is_line_buffer_valid = 1;
+    }
 
-    /* Configure the ILI9341 Pixel Format with the desired Bits Per Pixel (BPP). */
-    set_dc_pin_to_command_mode();
-    enable_cs_pin();
-    ret = ili9341_dma_spi_tx(&ili9341_command, ILI9341_COMMAND_SIZE);
+    /* Set the Address Window to the requested area and stream the line buffer into it. */
+    ret = ili9341_set_window(p_handle, x0, y0, x1, y1);
     if (ret != ILI9341_EC_OK)
     {
-        disable_cs_pin();
         return ret;
     }
+    return ili9341_stream_line_buffer(p_handle, ILI9341_TX_ROLE_DATA_16BIT, (const uint8_t *) p_handle->line_buffer.bpp_16,
+                                      ILI9341_16BPP_PIXEL_SIZE, pixel_count);
+}
+#endif
+
+static ILI9341_Status ili9341_stream_line_buffer(ILI9341_handle_t *p_handle, ILI9341_TX_ROLE_t role, const uint8_t *p_line_buffer,
+                                                 uint8_t pixel_size, uint32_t pixel_count)
+{
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret = ILI9341_EC_OK;
+    /** <b>Local \c uint16_t variable repeat_count:</b> Number of times that the whole line buffer fits into the requested number of pixels. */
+    uint16_t repeat_count = (uint16_t) (pixel_count / ILI9341_SCREEN_WIDTH);
+    /** <b>Local \c uint16_t variable remaining_pixels:</b> Number of pixels that are left after sending the whole line buffer \c repeat_count times. */
+    uint16_t remaining_pixels = (uint16_t) (pixel_count % ILI9341_SCREEN_WIDTH);
 
-    set_dc_pin_to_data_mode();
-    /** <b>Local \c ILI9341_PIXEL_FORMAT_def_t variable ili9341_data_value:</b> Holds the configuration desired for the Pixel Format Data, which is to be sent to the ILI9341 Device via the SPI-DMA peripheral. */
-    ILI9341_PIXEL_FORMAT_def_t ili9341_data_value = {0};
-    ili9341_data_value.dbi = 0x05;
-    ili9341_data_value.dpi = 0x05;
-    ret = ili9341_dma_spi_tx(((uint8_t *) &ili9341_data_value), ILI9341_SINGLE_DATA_SIZE);
-    disable_cs_pin();
+    if (repeat_count != 0)
+    {
+        ret = ili9341_dma_spi_tx_repeated(p_handle, role, p_line_buffer, (uint32_t) ILI9341_SCREEN_WIDTH * pixel_size, repeat_count,
+                                          ILI9341_TX_BUFFER_COUNTED, &p_handle->line_buffer_users);
+    }
+    if ((ret == ILI9341_EC_OK) && (remaining_pixels != 0))
+    {
+        ret = ili9341_dma_spi_tx(p_handle, role, p_line_buffer, (uint32_t) remaining_pixels * pixel_size, ILI9341_TX_BUFFER_COUNTED,
+                                 &p_handle->line_buffer_users);
+    }
+    ili9341_release_cs(p_handle);
 
     return ret;
 }
 
-static ILI9341_Status ili9341_configure_display_function_control(void)
+static ILI9341_Status ili9341_send_address_set(ILI9341_handle_t *p_handle, uint8_t ili9341_command, uint16_t start, uint16_t end)
 {
     /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
     ILI9341_Status ret;
-    /** <b>Local \c uint8_t variable ili9341_command:</b> Holds the ILI9341 Command that will be sent to it via the SPI-DMA peripheral. */
-    uint8_t ili9341_command = ILI9341_DISPLAY_FUNCTION_CONTROL_COMMAND;
+    /** <b>Local \c uint8_t 4-bytes array variable ili9341_data_value:</b> Holds the start and end addresses, each with its Most Significant Byte first, that will be sent to the ILI9341 Device via the SPI-DMA peripheral. */
+    uint8_t ili9341_data_value[ILI9341_ADDRESS_SET_DATA_SIZE] = {(uint8_t) (start >> 8), (uint8_t) start, (uint8_t) (end >> 8), (uint8_t) end};
 
-    set_dc_pin_to_command_mode();
-    enable_cs_pin();
-    ret = ili9341_dma_spi_tx(&ili9341_command, ILI9341_COMMAND_SIZE);
+    ret = ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_COMMAND, &ili9341_command, ILI9341_COMMAND_SIZE, ILI9341_TX_BUFFER_INLINE, NULL);
     if (ret != ILI9341_EC_OK)
     {
-        disable_cs_pin();
         return ret;
     }
+    return ili9341_dma_spi_tx(p_handle, ILI9341_TX_ROLE_DATA, ili9341_data_value, ILI9341_ADDRESS_SET_DATA_SIZE, ILI9341_TX_BUFFER_INLINE, NULL);
+}
 
-    set_dc_pin_to_data_mode();
-    /** <b>Local \c ILI9341_PIXEL_FORMAT_def_t variable ili9341_data_value:</b> Holds the configuration desired for the Pixel Format Data, which is to be sent to the ILI9341 Device via the SPI-DMA peripheral. */
-    uint8_t ili9341_data_value[ILI9341_DISPLAY_FUNCTION_CONTROL_DATA_SIZE];
-    // TODO: For now, these following 3 bytes are going to be set in a fixed manner by following what it is stated in the ILI9341 datasheet. However, It is still pending to make proper enums and/or structs so that all the inner fields are properly documented and can be customized in a friendly manner.
-    ili9341_data_value[0] = 0x08;
-    ili9341_data_value[1] = 0x82;
-    ili9341_data_value[2] = 0x27;
-    ret = ili9341_dma_spi_tx(ili9341_data_value, ILI9341_DISPLAY_FUNCTION_CONTROL_DATA_SIZE);
-    disable_cs_pin();
+// ##### LAST TODO UP TO HERE ##### //
 
-    return ret;
+#if ILI9341_GPIO_FAST_PATH
+static void enable_cs_pin(ILI9341_handle_t *p_handle)
+{
+    *(p_handle->p_cs_bsrr) = p_handle->cs_enable_mask;
+}
+
+static void disable_cs_pin(ILI9341_handle_t *p_handle)
+{
+    *(p_handle->p_cs_bsrr) = p_handle->cs_disable_mask;
+}
+
+static void set_dc_pin_to_data_mode(ILI9341_handle_t *p_handle)
+{
+    *(p_handle->p_dc_bsrr) = p_handle->dc_data_mask;
+}
+
+static void set_dc_pin_to_command_mode(ILI9341_handle_t *p_handle)
+{
+    *(p_handle->p_dc_bsrr) = p_handle->dc_command_mask;
+}
+#else
+static void enable_cs_pin(ILI9341_handle_t *p_handle)
+{
+    HAL_GPIO_WritePin(p_handle->p_peripherals->CS.GPIO_Port, p_handle->p_peripherals->CS.GPIO_Pin, GPIO_PIN_RESET);
+}
+
+static void disable_cs_pin(ILI9341_handle_t *p_handle)
+{
+    HAL_GPIO_WritePin(p_handle->p_peripherals->CS.GPIO_Port, p_handle->p_peripherals->CS.GPIO_Pin, GPIO_PIN_SET);
+}
+
+static void set_dc_pin_to_data_mode(ILI9341_handle_t *p_handle)
+{
+    HAL_GPIO_WritePin(p_handle->p_peripherals->DC.GPIO_Port, p_handle->p_peripherals->DC.GPIO_Pin, GPIO_PIN_SET);
 }
 
-// TODO: Pending to add the "enter to sleep mode" function.
-static ILI9341_Status ili9341_exit_sleep_mode(void)
+static void set_dc_pin_to_command_mode(ILI9341_handle_t *p_handle)
+{
+    HAL_GPIO_WritePin(p_handle->p_peripherals->DC.GPIO_Port, p_handle->p_peripherals->DC.GPIO_Pin, GPIO_PIN_RESET);
+}
+#endif
+
+static ILI9341_Status ili9341_dma_spi_tx(ILI9341_handle_t *p_handle, ILI9341_TX_ROLE_t role, const uint8_t *buffer, uint32_t size,
+                                         ILI9341_TX_BUFFER_OWNERSHIP_t ownership, volatile uint8_t *p_is_buffer_in_use)
 {
     /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
     ILI9341_Status ret;
-    /** <b>Local \c uint8_t variable ili9341_command:</b> Holds the ILI9341 Command that will be sent to it via the SPI-DMA peripheral. */
-    uint8_t ili9341_command = ILI9341_SLEEP_OUT_COMMAND;
+    /** <b>Local \c ILI9341_tx_segment_def_t pointer p_segment:</b> Points to the segment of the SPI Transfer Queue into which the requested data will be queued. */
+    ILI9341_tx_segment_def_t *p_segment;
 
-    set_dc_pin_to_command_mode();
-    enable_cs_pin();
-    ret = ili9341_dma_spi_tx(&ili9341_command, ILI9341_COMMAND_SIZE);
-    disable_cs_pin();
-    HAL_Delay(5);
+    if ((size == 0) || ((ownership == ILI9341_TX_BUFFER_INLINE) && (size > ILI9341_TX_INLINE_DATA_SIZE))
+        || ((role == ILI9341_TX_ROLE_DATA_16BIT) && (size % ILI9341_16BPP_PIXEL_SIZE != 0)))
+    {
+        return ILI9341_EC_ERR;
+    }
+    ret = ili9341_reserve_tx_segment(p_handle, &p_segment);
+    if (ret != ILI9341_EC_OK)
+    {
+        return ret;
+    }
 
-    return ret;
+    /* Keep track of whether the pixels queued next will be written right after the last written pixel. */
+    if (role == ILI9341_TX_ROLE_COMMAND)
+    {
+        p_handle->is_memory_write_open = ((buffer[0] == ILI9341_MEMORY_WRITE_COMMAND) || (buffer[0] == ILI9341_MEMORY_WRITE_CONTINUE_COMMAND));
+    }
+
+    /* Fill the reserved segment with the requested data. */
+    p_segment->role = (uint8_t) role;
+    p_segment->size = size;
+    p_segment->ownership = (uint8_t) ownership;
+    p_segment->p_is_buffer_in_use = p_is_buffer_in_use;
+    if (ownership == ILI9341_TX_BUFFER_INLINE)
+    {
+        for (uint8_t i = 0; (i < size) && (i < ILI9341_TX_INLINE_DATA_SIZE); i++) // Bounded by both, even though \p size was already checked, so that the compiler can also tell that it never overflows.
+        {
+            p_segment->inline_data[i] = buffer[i];
+        }
+        p_segment->p_buffer = p_segment->inline_data;
+    }
+    else
+    {
+        p_segment->p_buffer = buffer;
+    }
+
+    return ili9341_commit_tx_segment(p_handle);
 }
 
-// TODO: Pending to add the  "turn display off" function.
-static ILI9341_Status ili9341_turn_display_on(void)
+static ILI9341_Status ili9341_dma_spi_tx_repeated(ILI9341_handle_t *p_handle, ILI9341_TX_ROLE_t role, const uint8_t *buffer,
+                                                  uint32_t size, uint16_t repeat_count, ILI9341_TX_BUFFER_OWNERSHIP_t ownership,
+                                                  volatile uint8_t *p_is_buffer_in_use)
 {
     /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
     ILI9341_Status ret;
-    /** <b>Local \c uint8_t variable ili9341_command:</b> Holds the ILI9341 Command that will be sent to it via the SPI-DMA peripheral. */
-    uint8_t ili9341_command = ILI9341_DISPLAY_ON_COMMAND;
+    /** <b>Local \c ILI9341_tx_segment_def_t pointer p_segment:</b> Points to the segment of the SPI Transfer Queue into which the requested data will be queued. */
+    ILI9341_tx_segment_def_t *p_segment;
 
-    set_dc_pin_to_command_mode();
-    enable_cs_pin();
-    ret = ili9341_dma_spi_tx(&ili9341_command, ILI9341_COMMAND_SIZE);
-    disable_cs_pin();
+    if ((size == 0) || (repeat_count == 0) || (ownership == ILI9341_TX_BUFFER_INLINE)
+        || ((role == ILI9341_TX_ROLE_DATA_16BIT) && (size % ILI9341_16BPP_PIXEL_SIZE != 0)))
+    {
+        return ILI9341_EC_ERR;
+    }
+    ret = ili9341_reserve_tx_segment(p_handle, &p_segment);
+    if (ret != ILI9341_EC_OK)
+    {
+        return ret;
+    }
 
-    return ret;
+    /* Fill the reserved segment with the requested data. */
+    p_segment->role = (uint8_t) role;
+    p_segment->size = size;
+    p_segment->repeat_count = repeat_count;
+    p_segment->ownership = (uint8_t) ownership;
+    p_segment->p_is_buffer_in_use = p_is_buffer_in_use;
+    p_segment->p_buffer = buffer;
+
+    return ili9341_commit_tx_segment(p_handle);
 }
 
-// TODO: Pending to pass the following "public" functions to the header file and to document them.
-ILI9341_Status set_ili9341_bpp_type(ILI9341_BPP_t bpp)
+static ILI9341_Status ili9341_reserve_tx_segment(ILI9341_handle_t *p_handle, ILI9341_tx_segment_def_t **pp_segment)
 {
-    /* Update the @ref p_ili9341_fill_screen pointer and update @ref ili9341_bpp_type . */
-    switch (bpp)
+    /** <b>Local \c ILI9341_bus_def_t pointer p_bus:</b> Points to the SPI Bus of the ILI9341 Device. */
+    ILI9341_bus_def_t *p_bus = p_handle->p_bus;
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds a single read of the volatile @ref ILI9341_handle::tx_status , since @ref ili9341_spi_error_callback may change it between two reads. */
+    ILI9341_Status ret = p_handle->tx_status;
+
+    if (ret != ILI9341_EC_OK)
     {
-        case ILI9341_BPP_16:
-            p_ili9341_fill_screen = &ili9341_fill_screen_16bpp;
-            break;
-        case ILI9341_BPP_18:
-            p_ili9341_fill_screen = &ili9341_fill_screen_18bpp;
-            break;
-        default:
-            return ILI9341_EC_ERR; // The requested BPP type is not recognized. Therefore, send Error Exception Code.
+        return ret; // A previously queued segment failed to be sent, so do not queue anything else until the error is reported by @ref ili9341_wait_until_idle .
     }
-    ili9341_bpp_type = bpp;
+
+    while (p_bus->tx_queue_count >= ILI9341_TX_QUEUE_LENGTH); // Wait until there is room in the SPI Transfer Queue for the new segment.
+
+    /* Give the segment at the head of the SPI Transfer Queue (this is safe since it is not visible to @ref ili9341_spi_tx_cplt_callback yet). */
+    *pp_segment = &p_bus->tx_queue[p_bus->tx_queue_head];
+    (*pp_segment)->p_handle = p_handle;
+    (*pp_segment)->repeat_count = 1;
+    (*pp_segment)->is_cs_released = 0;
 
     return ILI9341_EC_OK;
 }
 
-ILI9341_Status ili9341_fill_screen(ILI9341_COLOR color)
+static ILI9341_Status ili9341_commit_tx_segment(ILI9341_handle_t *p_handle)
 {
-    // TODO: Write set_address function here.
-    return (*p_ili9341_fill_screen)(color);
+    /** <b>Local \c ILI9341_bus_def_t pointer p_bus:</b> Points to the SPI Bus of the ILI9341 Device. */
+    ILI9341_bus_def_t *p_bus = p_handle->p_bus;
+    /** <b>Local \c uint32_t variable primask:</b> Holds the state of the interrupts before entering the critical section of this function. */
+    uint32_t primask = __get_PRIMASK();
+
+    /* Publish the new segment and start its DMA-SPI transfer right away in case that the SPI Transfer Queue was idle. */
+    __disable_irq();
+    if (p_bus->tx_queue[p_bus->tx_queue_head].ownership == ILI9341_TX_BUFFER_COUNTED)
+    {
+        (*(p_bus->tx_queue[p_bus->tx_queue_head].p_is_buffer_in_use))++;
+    }
+    p_bus->tx_queue_head = (p_bus->tx_queue_head + 1) % ILI9341_TX_QUEUE_LENGTH;
+    p_bus->tx_queue_count++;
+    p_handle->pending_tx_segments++;
+    if (p_bus->tx_queue_count == 1)
+    {
+        ili9341_start_tx_segment(p_bus);
+    }
+    __set_PRIMASK(primask);
+
+    return p_handle->tx_status;
 }
 
-static ILI9341_Status ili9341_fill_screen_18bpp(ILI9341_COLOR color)
+static void ili9341_release_cs(ILI9341_handle_t *p_handle)
 {
-    // Write code here.
+    /** <b>Local \c ILI9341_bus_def_t pointer p_bus:</b> Points to the SPI Bus of the ILI9341 Device. */
+    ILI9341_bus_def_t *p_bus = p_handle->p_bus;
+    /** <b>Local \c uint8_t variable index:</b> Index of the SPI Transfer Queue of the segment that is currently being inspected. */
+    uint8_t index;
+    /** <b>Local \c uint32_t variable primask:</b> Holds the state of the interrupts before entering the critical section of this function. */
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (p_handle->pending_tx_segments == 0)
+    {
+        /* None of the segments of the ILI9341 Device are queued, so its CS pin can only be enabled if it was the last one to use the SPI Bus. */
+        if (p_bus->p_cs_owner == p_handle)
+        {
+            disable_cs_pin(p_handle);
+            p_bus->p_cs_owner = NULL;
+        }
+    }
+    else
+    {
+        /* Request to release the CS pin once the last queued segment of the ILI9341 Device has been sent. */
+        index = p_bus->tx_queue_head;
+        do
+        {
+            index = (index + ILI9341_TX_QUEUE_LENGTH - 1) % ILI9341_TX_QUEUE_LENGTH;
+        } while (p_bus->tx_queue[index].p_handle != p_handle);
+        p_bus->tx_queue[index].is_cs_released = 1;
+    }
+    __set_PRIMASK(primask);
 }
 
-static ILI9341_Status ili9341_fill_screen_16bpp(ILI9341_COLOR color)
+static void ili9341_start_tx_segment(ILI9341_bus_def_t *p_bus)
 {
-    // TODO: Write the function for coloring the bg of the ILI9341 TFT LCD Display.
-}
+    /** <b>Local \c ILI9341_tx_segment_def_t pointer p_segment:</b> Points to the segment of the SPI Transfer Queue that will be sent. */
+    ILI9341_tx_segment_def_t *p_segment = &p_bus->tx_queue[p_bus->tx_queue_tail];
 
-// ##### LAST TODO UP TO HERE ##### //
+    /* Hand the SPI Bus over to the ILI9341 Device of the segment in case that another one was still selected. */
+    if (p_bus->p_cs_owner != p_segment->p_handle)
+    {
+        if (p_bus->p_cs_owner != NULL)
+        {
+            disable_cs_pin(p_bus->p_cs_owner);
+        }
+        p_bus->p_cs_owner = p_segment->p_handle;
+    }
 
-static void enable_cs_pin(void)
-{
-    HAL_GPIO_WritePin(p_ili9341_peripherals->CS.GPIO_Port, p_ili9341_peripherals->CS.GPIO_Pin, GPIO_PIN_RESET);
+    if (p_segment->role == ILI9341_TX_ROLE_COMMAND)
+    {
+        set_dc_pin_to_command_mode(p_segment->p_handle);
+    }
+    else
+    {
+        set_dc_pin_to_data_mode(p_segment->p_handle);
+    }
+    if (p_bus->is_16bit_frame_mode != (p_segment->role == ILI9341_TX_ROLE_DATA_16BIT))
+    {
+        ili9341_set_spi_frame_mode(p_bus, (p_segment->role == ILI9341_TX_ROLE_DATA_16BIT));
+    }
+    enable_cs_pin(p_segment->p_handle);
+    p_bus->tx_offset = 0;
+    ili9341_start_tx_chunk(p_bus);
 }
 
-static void disable_cs_pin(void)
+static void ili9341_start_tx_chunk(ILI9341_bus_def_t *p_bus)
 {
-    HAL_GPIO_WritePin(p_ili9341_peripherals->CS.GPIO_Port, p_ili9341_peripherals->CS.GPIO_Pin, GPIO_PIN_SET);
-}
+    /** <b>Local \c ILI9341_tx_segment_def_t pointer p_segment:</b> Points to the segment of the SPI Transfer Queue whose next chunk will be sent. */
+    ILI9341_tx_segment_def_t *p_segment = &p_bus->tx_queue[p_bus->tx_queue_tail];
+    /** <b>Local \c uint32_t variable remaining_size:</b> Number of bytes of the segment that are still pending to be sent in its current repetition. */
+    uint32_t remaining_size = p_segment->size - p_bus->tx_offset;
 
-static void set_dc_pin_to_data_mode(void)
-{
-    HAL_GPIO_WritePin(p_ili9341_peripherals->DC.GPIO_Port, p_ili9341_peripherals->DC.GPIO_Pin, GPIO_PIN_SET);
+    /** <b>Local \c uint8_t variable frame_size:</b> Size in bytes of each of the SPI data frames with which the segment is sent. */
+    uint8_t frame_size = (p_bus->is_16bit_frame_mode) ? 2 : 1;
+    /** <b>Local \c ILI9341_Status variable ret:</b> Holds the Return value of a @ref ILI9341_Status function type. */
+    ILI9341_Status ret;
+
+    p_bus->tx_chunk_size = (remaining_size > (uint32_t) ILI9341_DMA_MAX_TRANSFER_SIZE * frame_size) ? (uint32_t) ILI9341_DMA_MAX_TRANSFER_SIZE * frame_size : remaining_size;
+    ret = HAL_ret_handler(HAL_SPI_Transmit_DMA(p_bus->p_hspi, (uint8_t *) &p_segment->p_buffer[p_bus->tx_offset], (uint16_t) (p_bus->tx_chunk_size / frame_size)));
+    if (ret != ILI9341_EC_OK)
+    {
+        ili9341_abort_tx_queue(p_bus, ret);
+    }
 }
 
-static void set_dc_pin_to_command_mode(void)
+static void ili9341_set_spi_frame_mode(ILI9341_bus_def_t *p_bus, uint8_t is_16bit_frame_mode)
 {
-    HAL_GPIO_WritePin(p_ili9341_peripherals->DC.GPIO_Port, p_ili9341_peripherals->DC.GPIO_Pin, GPIO_PIN_RESET);
+    /** <b>Local \c SPI_HandleTypeDef pointer p_hspi:</b> Points to the SPI Handle Structure of the SPI Bus. */
+    SPI_HandleTypeDef *p_hspi = p_bus->p_hspi;
+
+    /* Change the data frame size of the SPI peripheral, which can only be done while it is disabled (it is enabled again by \c HAL_SPI_Transmit_DMA ). */
+    __HAL_SPI_DISABLE(p_hspi);
+    p_hspi->Init.DataSize = (is_16bit_frame_mode) ? SPI_DATASIZE_16BIT : SPI_DATASIZE_8BIT;
+#if defined(SPI_CR2_DS)
+    MODIFY_REG(p_hspi->Instance->CR2, SPI_CR2_DS, p_hspi->Init.DataSize);
+#else
+    MODIFY_REG(p_hspi->Instance->CR1, SPI_CR1_DFF, p_hspi->Init.DataSize);
+#endif
+
+    /* Make the DMA move a whole SPI data frame per request. */
+    p_hspi->hdmatx->Init.PeriphDataAlignment = (is_16bit_frame_mode) ? DMA_PDATAALIGN_HALFWORD : DMA_PDATAALIGN_BYTE;
+    p_hspi->hdmatx->Init.MemDataAlignment = (is_16bit_frame_mode) ? DMA_MDATAALIGN_HALFWORD : DMA_MDATAALIGN_BYTE;
+    HAL_DMA_Init(p_hspi->hdmatx);
+
+    p_bus->is_16bit_frame_mode = is_16bit_frame_mode;
 }
 
-static ILI9341_Status ili9341_dma_spi_tx(uint8_t *buffer, uint16_t size)
+static void ili9341_abort_tx_queue(ILI9341_bus_def_t *p_bus, ILI9341_Status status)
 {
-    while(!__HAL_SPI_GET_FLAG(HSPI_INSTANCE, SPI_FLAG_TXE)); // Wait if there is still an ongoing DMA-SPI transaction giving place.
-    return HAL_ret_handler(HAL_SPI_Transmit_DMA(p_hspi, buffer, size));
+    /** <b>Local \c ILI9341_tx_segment_def_t pointer p_segment:</b> Points to the segment of the SPI Transfer Queue that is currently being aborted. */
+    ILI9341_tx_segment_def_t *p_segment;
+
+    /* Release the buffers of all the segments that will no longer be sent and latch the given Exception Code into their ILI9341 Device Handles, unless an earlier one is still pending to be reported. */
+    while (p_bus->tx_queue_count != 0)
+    {
+        p_segment = &p_bus->tx_queue[p_bus->tx_queue_tail];
+        if (p_segment->ownership == ILI9341_TX_BUFFER_RELEASED)
+        {
+            *(p_segment->p_is_buffer_in_use) = 0;
+        }
+        else if (p_segment->ownership == ILI9341_TX_BUFFER_COUNTED)
+        {
+            (*(p_segment->p_is_buffer_in_use))--;
+        }
+        if (p_segment->p_handle->tx_status == ILI9341_EC_OK)
+        {
+            p_segment->p_handle->tx_status = status;
+        }
+        p_segment->p_handle->window_shadow.is_column_valid = 0;
+        p_segment->p_handle->window_shadow.is_page_valid = 0;
+        p_segment->p_handle->is_memory_write_open = 0;
+        p_segment->p_handle->pending_tx_segments--;
+        p_bus->tx_queue_tail = (p_bus->tx_queue_tail + 1) % ILI9341_TX_QUEUE_LENGTH;
+        p_bus->tx_queue_count--;
+    }
+    if (p_bus->p_cs_owner != NULL)
+    {
+        disable_cs_pin(p_bus->p_cs_owner);
+        p_bus->p_cs_owner = NULL;
+    }
 }
 
 static ILI9341_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
@@ -0,0 +1,80 @@
+/**@file
+ * @brief	Measures the time that @ref ili9341_fill_screen takes to clear the whole screen on a simulated 36 MHz SPI
+ *          bus, against the theoretical limit of that bus, both in 16 and in 18 bits per pixel.
+ *
+ * @details The theoretical limit is the time that only the pixels of the 240x320 screen take on the bus, so the
+ *          measured time also includes the Commands, the Address Window and the per-transfer overhead of the DMA.
+ *          Since both Bits Per Pixel types stream a pre-filled line buffer, 18 bits per pixel must only cost the 50%
+ *          of extra bytes on the bus and not any extra CPU time of the caller.
+ */
+
+#include "ili9341_test.h"
+
+#define BENCH_SPI_CLOCK_HZ          (36000000U)     /**< @brief Clock of the simulated SPI bus. */
+#define BENCH_MIN_EFFICIENCY        (0.95)          /**< @brief Minimum fraction of the theoretical limit that a clear must reach. */
+#define BENCH_ROUNDS                (4)             /**< @brief Number of clears that are timed. */
+
+/**@brief   Clears the screen @ref BENCH_ROUNDS times, reports it and gets the modeled time on the bus of a single
+ *          clear.
+ */
+static double bench_clear(const char *name, uint32_t bytes_per_pixel, ILI9341_COLOR color, uint32_t expected_rgb666)
+{
+    ILI9341_handle_t *p_lcd = &test_lcd[0];
+    const ili9341_panel_model_t *p_panel = &test_panel[0];
+    uint64_t pixel_bytes = (uint64_t) ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT * bytes_per_pixel;
+    double theoretical_ms = pixel_bytes * 8.0 * 1e3 / BENCH_SPI_CLOCK_HZ;
+    uint64_t wall_ns = 0;
+    uint64_t cpu_ns = 0;
+    host_hal_stats_t stats;
+
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        test_sync(p_lcd);
+        uint64_t start_ns = host_time_ns();
+        uint64_t start_cpu_ns = host_thread_cpu_time_ns();
+        TEST_CHECK_EQ(ili9341_fill_screen(p_lcd, color), ILI9341_EC_OK);
+        cpu_ns += host_thread_cpu_time_ns() - start_cpu_ns;
+        TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+        wall_ns += host_time_ns() - start_ns;
+    }
+    host_hal_get_stats(&stats);
+
+    double bus_ms = stats.bus_time_ns / 1e6;
+    double efficiency = theoretical_ms / bus_ms;
+    printf("%-14s %7lu bytes (%lu over the pixels) in %4lu transfers: %6.2f ms on the bus vs %6.2f ms theoretical (%.1f%%), %6.2f ms wall-clock paced, %6.1f us of caller CPU time\n",
+           name, (unsigned long) stats.bytes, (unsigned long) (stats.bytes - pixel_bytes), (unsigned long) stats.transfers, bus_ms,
+           theoretical_ms, 100.0 * efficiency, wall_ns / 1e6 / BENCH_ROUNDS, cpu_ns / 1e3 / BENCH_ROUNDS);
+    TEST_CHECK(efficiency >= BENCH_MIN_EFFICIENCY);
+    TEST_CHECK_EQ(p_panel->stats.pixels, ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT);
+    TEST_CHECK_EQ(p_panel->stats.overflow_pixels, 0);
+    uint32_t mismatches = 0;
+    for (int y = 0; y < ILI9341_SCREEN_HEIGHT; y++)
+    {
+        for (int x = 0; x < ILI9341_SCREEN_WIDTH; x++)
+        {
+            mismatches += ili9341_panel_model_get_pixel(p_panel, x, y) != expected_rgb666;
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+    return bus_ms;
+}
+
+int main(void)
+{
+    host_hal_config_t config = {BENCH_SPI_CLOCK_HZ, 2000U, 1};
+    test_begin(&config, 1);
+
+    ILI9341_COLOR color;
+    color.bpp_16 = 0xF81F;
+    double bus_16bpp_ms = bench_clear("16bpp clear", 2, color, test_rgb565_to_rgb666(color.bpp_16));
+
+    TEST_CHECK_EQ(set_ili9341_bpp_type(&test_lcd[0], ILI9341_BPP_18), ILI9341_EC_OK);
+    color.bpp_18 = (0x3FUL << 18) | (0x2AUL << 10) | (0x15UL << 2);
+    double bus_18bpp_ms = bench_clear("18bpp clear", 3, color, test_bpp18_to_rgb666(color.bpp_18));
+
+    double ratio = bus_18bpp_ms / bus_16bpp_ms;
+    printf("18bpp / 16bpp clear time on the bus: %.3f (1.5 is the ratio of their pixel bytes)\n", ratio);
+    TEST_CHECK((ratio > 1.45) && (ratio < 1.55));
+
+    return test_end("bench_fill_screen");
+}
@@ -0,0 +1,191 @@
+/**@file
+ * @brief	Measures how long @ref ili9341_draw_string takes to render a 108x16 label when the color ramp of its pair of
+ *          colors is cached and when it has to be computed again, for fonts of 1, 2 and 4 bits per pixel.
+ *
+ * @details This benchmark is only linked with the @ref ili9341_fonts , while the functions of the @ref ili9341 that
+ *          it calls are stubbed out below, so that each strip buffer is taken back as soon as it is queued and only the
+ *          rendering is timed. The ramp misses cycle through one more pair of colors than
+ *          @ref ILI9341_FONTS_RAMP_CACHE_SIZE , so that the ramp that is needed is always the one that was just
+ *          replaced. The stubs also hash every pixel that they are given, which must be the same whether the ramp was
+ *          cached or not.
+ */
+
+#include "ili9341_fonts.h"
+#include "ili9341_test.h"
+#include <stdlib.h> // This library contains the functions: rand and srand.
+#include <string.h> // This library contains the functions: memset.
+
+#define BENCH_SPI_CLOCK_HZ      (36000000U)     /**< @brief Clock of the SPI bus against which the rendering time is compared. */
+#define BENCH_ROUNDS            (20000)         /**< @brief Number of times that the label is drawn per measurement. */
+#define BENCH_STRING            "Temp: 23.5 C"  /**< @brief Label that is drawn, which is 108x16 pixels with the fonts of this benchmark. */
+#define BENCH_PAIRS             (ILI9341_FONTS_RAMP_CACHE_SIZE + 1)  /**< @brief Number of pairs of colors that the ramp misses cycle through. */
+#define FONT_FIRST              (32)            /**< @brief First character of the fonts of this benchmark. */
+#define FONT_LAST               (126)           /**< @brief Last character of the fonts of this benchmark. */
+#define FONT_GLYPHS             (FONT_LAST - FONT_FIRST + 1)    /**< @brief Number of glyphs of each font of this benchmark. */
+
+static ILI9341_BPP_t panel_bpp = ILI9341_BPP_16;
+static uint32_t hash;
+static unsigned long pixels_sent;
+static unsigned long checks;
+static unsigned long failures;
+
+ILI9341_BPP_t get_ili9341_bpp_type(ILI9341_handle_t *p_handle)
+{
+    (void) p_handle;
+    return panel_bpp;
+}
+
+ILI9341_Status ili9341_set_window(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    (void) p_handle;
+    (void) x0;
+    (void) y0;
+    (void) x1;
+    (void) y1;
+    return ILI9341_EC_OK;
+}
+
+ILI9341_Status ili9341_write_pixels_16bpp(ILI9341_handle_t *p_handle, const uint16_t *pixels, uint32_t count, volatile uint8_t *p_is_buffer_in_use)
+{
+    (void) p_handle;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        hash = (hash ^ pixels[i]) * 16777619U;
+    }
+    pixels_sent += count;
+    if (p_is_buffer_in_use != NULL)
+    {
+        *p_is_buffer_in_use = 0;
+    }
+    return ILI9341_EC_OK;
+}
+
+ILI9341_Status ili9341_write_pixels(ILI9341_handle_t *p_handle, const uint8_t *pixels, uint32_t size, volatile uint8_t *p_is_buffer_in_use)
+{
+    (void) p_handle;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ pixels[i]) * 16777619U;
+    }
+    pixels_sent += size / 3;
+    if (p_is_buffer_in_use != NULL)
+    {
+        *p_is_buffer_in_use = 0;
+    }
+    return ILI9341_EC_OK;
+}
+
+/* This benchmark does not start the virtual ILI9341 Device, so it keeps its own count of the checks. */
+void test_check_eq(long long actual, long long expected, const char *expression, const char *file, int line)
+{
+    checks++;
+    if (actual != expected)
+    {
+        failures++;
+        printf("%s:%d: check failed: %s is %lld, expected %lld\n", file, line, expression, actual, expected);
+    }
+}
+
+/**@brief   Makes a font of random glyphs of 7x12 pixels with the given depth, which advance 9 pixels each.
+ */
+static void make_font(ILI9341_font_t *p_font, ILI9341_glyph_t *p_glyphs, uint8_t *p_bitmaps, uint8_t bpp)
+{
+    uint32_t bytes = (7U * 12U * bpp + 7) / 8;
+    for (int i = 0; i < FONT_GLYPHS; i++)
+    {
+        p_glyphs[i].bitmap_offset = (uint16_t) (i * bytes);
+        p_glyphs[i].width = 7;
+        p_glyphs[i].height = 12;
+        p_glyphs[i].x_advance = 9;
+        p_glyphs[i].x_offset = 1;
+        p_glyphs[i].y_offset = -12;
+        for (uint32_t b = 0; b < bytes; b++)
+        {
+            p_bitmaps[i * bytes + b] = (uint8_t) rand();
+        }
+    }
+    memset(p_font, 0, sizeof(*p_font));
+    p_font->p_bitmaps = p_bitmaps;
+    p_font->p_glyphs = p_glyphs;
+    p_font->first = FONT_FIRST;
+    p_font->last = FONT_LAST;
+    p_font->ascent = 13;
+    p_font->descent = 3;
+    p_font->bpp = bpp;
+}
+
+/**@brief   Draws the label @ref BENCH_ROUNDS times, either always with the first pair of colors or cycling through all of
+ *          them, and gets the time that each label took.
+ *
+ * @return  Nanoseconds per label.
+ */
+static double time_labels(ILI9341_handle_t *p_handle, const ILI9341_font_t *p_font, const ILI9341_COLOR *p_inks, ILI9341_COLOR background,
+                          int is_miss)
+{
+    pixels_sent = 0;
+    uint64_t start_ns = host_time_ns();
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        TEST_CHECK_EQ(ili9341_draw_string(p_handle, 0, 0, p_font, BENCH_STRING, p_inks[is_miss ? (round % BENCH_PAIRS) : 0], background), ILI9341_EC_OK);
+    }
+    double ns = (double) (host_time_ns() - start_ns) / BENCH_ROUNDS;
+    TEST_CHECK_EQ(pixels_sent, (unsigned long) ili9341_get_string_width(p_font, BENCH_STRING) * (p_font->ascent + p_font->descent) * BENCH_ROUNDS);
+    return ns;
+}
+
+/**@brief   Gets the hash of the pixels of a single label drawn with the given pair of colors.
+ */
+static uint32_t hash_label(ILI9341_handle_t *p_handle, const ILI9341_font_t *p_font, ILI9341_COLOR ink, ILI9341_COLOR background)
+{
+    hash = 2166136261U;
+    TEST_CHECK_EQ(ili9341_draw_string(p_handle, 0, 0, p_font, BENCH_STRING, ink, background), ILI9341_EC_OK);
+    return hash;
+}
+
+int main(void)
+{
+    static ILI9341_handle_t lcd;
+    static ILI9341_glyph_t glyphs[FONT_GLYPHS];
+    static uint8_t bitmaps[FONT_GLYPHS * 42];
+    const ILI9341_BPP_t bpps[2] = {ILI9341_BPP_16, ILI9341_BPP_18};
+    ILI9341_font_t font;
+    ILI9341_COLOR inks[BENCH_PAIRS];
+    ILI9341_COLOR background;
+
+    lcd.clip_rect.x1 = ILI9341_SCREEN_WIDTH - 1;
+    lcd.clip_rect.y1 = ILI9341_SCREEN_HEIGHT - 1;
+    srand(24);
+    for (int b = 0; b < 2; b++)
+    {
+        panel_bpp = bpps[b];
+        for (int p = 0; p < BENCH_PAIRS; p++)
+        {
+            inks[p].bpp_18 = (panel_bpp == ILI9341_BPP_16) ? (uint32_t) (0xFFE0 - 0x0841 * p) : (uint32_t) (0xFCFC00 - 0x040404 * p);
+        }
+        background.bpp_18 = (panel_bpp == ILI9341_BPP_16) ? 0x0010U : 0x000080U;
+        for (uint8_t bpp = 1; bpp <= 4; bpp *= 2)
+        {
+            make_font(&font, glyphs, bitmaps, bpp);
+            int width = ili9341_get_string_width(&font, BENCH_STRING);
+            int height = font.ascent + font.descent;
+
+            /* The same pixels come out of a ramp that was just computed and of the cached one. */
+            for (int p = 1; p < BENCH_PAIRS; p++)
+            {
+                hash_label(&lcd, &font, inks[p], background);
+            }
+            uint32_t miss_hash = hash_label(&lcd, &font, inks[0], background);
+            TEST_CHECK_EQ(hash_label(&lcd, &font, inks[0], background), miss_hash);
+
+            double hit_ns = time_labels(&lcd, &font, inks, background, 0);
+            double miss_ns = time_labels(&lcd, &font, inks, background, 1);
+            double wire_ms = (double) width * height * ((panel_bpp == ILI9341_BPP_16) ? 2 : 3) * 8 / BENCH_SPI_CLOCK_HZ * 1e3;
+            printf("%u bpp font, %s panel, %dx%d label: ramp hit %.2f us (%.1f ns/px), ramp miss %.2f us (%.1f ns/px), %.3f ms on the SPI wire\n",
+                   (unsigned) bpp, (panel_bpp == ILI9341_BPP_16) ? "16 bpp" : "18 bpp", width, height, hit_ns / 1e3, hit_ns / (width * height),
+                   miss_ns / 1e3, miss_ns / (width * height), wire_ms);
+        }
+    }
+
+    printf("bench_font_ramps: %lu checks, %lu failed\n", checks, failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+/**@file
+ * @brief	Measures how long @ref ili9341_draw_string takes to render a label with the fonts written by
+ *          "tools/ili9341_font_compiler.py" when their bitmaps are plain and when they are Run-Length Encoded (RLE).
+ *
+ * @details This benchmark is only linked with the @ref ili9341_fonts and the test fonts, while the functions of the
+ *          @ref ili9341 that it calls are stubbed out below, so that each strip buffer is taken back as soon as it is
+ *          queued and only the rendering is timed. The stubs also hash every pixel that they are given, which must be
+ *          the same with both encodings of each font.
+ */
+
+#include "ili9341_fonts.h"
+#include "ili9341_test.h"
+
+#define BENCH_ROUNDS        (20000)     /**< @brief Number of times that each label is drawn. */
+
+extern const ILI9341_font_t test_bdf_plain, test_bdf_rle;
+extern const ILI9341_font_t kern_ttf_1_plain, kern_ttf_1_rle, kern_ttf_2_plain, kern_ttf_2_rle, kern_ttf_4_plain, kern_ttf_4_rle;
+
+static uint32_t hash;
+static unsigned long pixels_sent;
+static unsigned long checks;
+static unsigned long failures;
+
+ILI9341_BPP_t get_ili9341_bpp_type(ILI9341_handle_t *p_handle)
+{
+    (void) p_handle;
+    return ILI9341_BPP_16;
+}
+
+ILI9341_Status ili9341_set_window(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    (void) p_handle;
+    (void) x0;
+    (void) y0;
+    (void) x1;
+    (void) y1;
+    return ILI9341_EC_OK;
+}
+
+ILI9341_Status ili9341_write_pixels_16bpp(ILI9341_handle_t *p_handle, const uint16_t *pixels, uint32_t count, volatile uint8_t *p_is_buffer_in_use)
+{
+    (void) p_handle;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        hash = (hash ^ pixels[i]) * 16777619U;
+    }
+    pixels_sent += count;
+    if (p_is_buffer_in_use != NULL)
+    {
+        *p_is_buffer_in_use = 0;
+    }
+    return ILI9341_EC_OK;
+}
+
+ILI9341_Status ili9341_write_pixels(ILI9341_handle_t *p_handle, const uint8_t *pixels, uint32_t size, volatile uint8_t *p_is_buffer_in_use)
+{
+    (void) p_handle;
+    (void) pixels;
+    (void) size;
+    (void) p_is_buffer_in_use;
+    return ILI9341_EC_ERR;
+}
+
+/* This benchmark does not start the virtual ILI9341 Device, so it keeps its own count of the checks. */
+void test_check_eq(long long actual, long long expected, const char *expression, const char *file, int line)
+{
+    checks++;
+    if (actual != expected)
+    {
+        failures++;
+        printf("%s:%d: check failed: %s is %lld, expected %lld\n", file, line, expression, actual, expected);
+    }
+}
+
+/**@brief   Draws a label @ref BENCH_ROUNDS times with the given font, getting the hash of its pixels.
+ *
+ * @return  Nanoseconds per label.
+ */
+static double time_label(ILI9341_handle_t *p_handle, const ILI9341_font_t *p_font, const char *p_string, uint32_t *p_hash)
+{
+    ILI9341_COLOR ink = {.bpp_16 = 0x0000};
+    ILI9341_COLOR background = {.bpp_16 = 0xFFFF};
+    uint32_t pixels = (uint32_t) ili9341_get_string_width(p_font, p_string) * (p_font->ascent + p_font->descent);
+
+    hash = 2166136261U;
+    TEST_CHECK_EQ(ili9341_draw_string(p_handle, 10, 10, p_font, p_string, ink, background), ILI9341_EC_OK);
+    *p_hash = hash;
+    pixels_sent = 0;
+    uint64_t start_ns = host_time_ns();
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        TEST_CHECK_EQ(ili9341_draw_string(p_handle, 10, 10, p_font, p_string, ink, background), ILI9341_EC_OK);
+    }
+    double ns = (double) (host_time_ns() - start_ns) / BENCH_ROUNDS;
+    TEST_CHECK_EQ(pixels_sent, (unsigned long) pixels * BENCH_ROUNDS);
+    return ns;
+}
+
+int main(void)
+{
+    static ILI9341_handle_t lcd;
+    const ILI9341_font_t *plain_fonts[4] = {&test_bdf_plain, &kern_ttf_1_plain, &kern_ttf_2_plain, &kern_ttf_4_plain};
+    const ILI9341_font_t *rle_fonts[4] = {&test_bdf_rle, &kern_ttf_1_rle, &kern_ttf_2_rle, &kern_ttf_4_rle};
+    const char *names[4] = {"test.bdf", "kern.ttf 1 bpp", "kern.ttf 2 bpp", "kern.ttf 4 bpp"};
+    const char *strings[4] = {"AB gABBA g\xC9", "AVATo. To. VAT", "AVATo. To. VAT", "AVATo. To. VAT"};
+
+    lcd.clip_rect.x1 = ILI9341_SCREEN_WIDTH - 1;
+    lcd.clip_rect.y1 = ILI9341_SCREEN_HEIGHT - 1;
+    for (int f = 0; f < 4; f++)
+    {
+        uint32_t plain_hash;
+        uint32_t rle_hash;
+        int width = ili9341_get_string_width(plain_fonts[f], strings[f]);
+        int height = plain_fonts[f]->ascent + plain_fonts[f]->descent;
+        double plain_ns = time_label(&lcd, plain_fonts[f], strings[f], &plain_hash);
+        double rle_ns = time_label(&lcd, rle_fonts[f], strings[f], &rle_hash);
+        TEST_CHECK_EQ(rle_hash, plain_hash);
+        printf("%-14s %3dx%-2d label: plain %.2f us (%.1f ns/px), RLE %.2f us (%.1f ns/px), %.2fx\n", names[f], width, height, plain_ns / 1e3,
+               plain_ns / (width * height), rle_ns / 1e3, rle_ns / (width * height), rle_ns / plain_ns);
+    }
+
+    printf("bench_font_rle: %lu checks, %lu failed\n", checks, failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+/**@file
+ * @brief	Measures how fast @ref ili9341_draw_jpeg decodes 320x240 JPEG images, whole and clipped to their centre,
+ *          against the rate at which a 36 MHz SPI bus sends the decoded pixels and their Address Windows.
+ *
+ * @details This benchmark is only linked with the @ref ili9341_jpeg , while the functions of the @ref ili9341 that it
+ *          calls are stubbed out below, so that each tile buffer is taken back as soon as it is queued and only the
+ *          decoding is timed. The stubs also write each tile into a framebuffer of 320x240 pixels through its Address
+ *          Window, which must then match the libjpeg reference of the image within the Clip Rectangle.
+ */
+
+#include "ili9341_jpeg.h"
+#include "ili9341_test.h"
+
+#define BENCH_SPI_CLOCK_HZ      (36000000U)     /**< @brief Clock of the SPI bus against which the decoding rate is compared. */
+#define BENCH_ROUNDS            (100)           /**< @brief Number of times that each image is decoded. */
+#define BENCH_WIDTH             (320)           /**< @brief Number of columns of the images and of the framebuffer. */
+#define BENCH_HEIGHT            (240)           /**< @brief Number of rows of the images and of the framebuffer. */
+#define BENCH_WINDOW_BYTES      (11)            /**< @brief Number of bytes of the ILI9341 Commands with which each Address Window is set. */
+#define JPEG_MAX_SIZE           (65536)         /**< @brief Largest size, in bytes, of the JPEG images of "fixtures/jpeg". */
+
+static uint16_t framebuffer[BENCH_WIDTH * BENCH_HEIGHT];
+static struct
+{
+    uint16_t x0, y0, x1, y1;    //!< Current Address Window.
+    uint32_t next;              //!< Index, within the Address Window, of the next pixel to be written.
+} window;
+static unsigned long windows;
+static unsigned long pixels_sent;
+static unsigned long checks;
+static unsigned long failures;
+
+ILI9341_BPP_t get_ili9341_bpp_type(ILI9341_handle_t *p_handle)
+{
+    (void) p_handle;
+    return ILI9341_BPP_16;
+}
+
+ILI9341_Status ili9341_set_window(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    (void) p_handle;
+    window.x0 = x0;
+    window.y0 = y0;
+    window.x1 = x1;
+    window.y1 = y1;
+    window.next = 0;
+    windows++;
+    return ILI9341_EC_OK;
+}
+
+ILI9341_Status ili9341_write_pixels_16bpp(ILI9341_handle_t *p_handle, const uint16_t *pixels, uint32_t count, volatile uint8_t *p_is_buffer_in_use)
+{
+    uint32_t width = (uint32_t) window.x1 - window.x0 + 1;
+    (void) p_handle;
+    for (uint32_t i = 0; i < count; i++, window.next++)
+    {
+        uint32_t x = window.x0 + window.next % width;
+        uint32_t y = window.y0 + window.next / width;
+        if ((x < BENCH_WIDTH) && (y < BENCH_HEIGHT))
+        {
+            framebuffer[y * BENCH_WIDTH + x] = pixels[i];
+        }
+    }
+    pixels_sent += count;
+    if (p_is_buffer_in_use != NULL)
+    {
+        *p_is_buffer_in_use = 0;
+    }
+    return ILI9341_EC_OK;
+}
+
+/* This benchmark does not start the virtual ILI9341 Device, so it keeps its own count of the checks. */
+void test_check_eq(long long actual, long long expected, const char *expression, const char *file, int line)
+{
+    checks++;
+    if (actual != expected)
+    {
+        failures++;
+        printf("%s:%d: check failed: %s is %lld, expected %lld\n", file, line, expression, actual, expected);
+    }
+}
+
+static uint32_t read_file(const char *name, const char *extension, uint8_t *p_data, uint32_t size)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.%s", ILI9341_JPEG_FIXTURES_DIR, name, extension);
+    FILE *p_file = fopen(path, "rb");
+    TEST_CHECK_EQ(p_file != NULL, 1);
+    if (p_file == NULL)
+    {
+        return 0;
+    }
+    uint32_t read = (uint32_t) fread(p_data, 1, size, p_file);
+    fclose(p_file);
+    return read;
+}
+
+static void bench_decode(const char *name, ILI9341_handle_t *p_handle, const int *p_clip)
+{
+    static uint8_t jpeg[JPEG_MAX_SIZE];
+    static uint8_t reference[2 * BENCH_WIDTH * BENCH_HEIGHT];
+    uint32_t size = read_file(name, "jpg", jpeg, JPEG_MAX_SIZE);
+    uint32_t visible = (uint32_t) (p_clip[2] - p_clip[0]) * (uint32_t) (p_clip[3] - p_clip[1]);
+    uint32_t mismatches = 0;
+    double wire_mb_per_s = BENCH_SPI_CLOCK_HZ / 8.0 / 1e6;
+
+    TEST_CHECK_EQ(read_file(name, "565", reference, sizeof(reference)), sizeof(reference));
+    p_handle->clip_rect.x0 = (uint16_t) p_clip[0];
+    p_handle->clip_rect.y0 = (uint16_t) p_clip[1];
+    p_handle->clip_rect.x1 = (uint16_t) (p_clip[2] - 1);
+    p_handle->clip_rect.y1 = (uint16_t) (p_clip[3] - 1);
+    memset(framebuffer, 0, sizeof(framebuffer));
+    windows = 0;
+    pixels_sent = 0;
+
+    uint64_t start_ns = host_time_ns();
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        TEST_CHECK_EQ(ili9341_draw_jpeg(p_handle, 0, 0, jpeg, size), ILI9341_EC_OK);
+    }
+    double seconds = (host_time_ns() - start_ns) / 1e9;
+
+    for (int y = p_clip[1]; y < p_clip[3]; y++)
+    {
+        for (int x = p_clip[0]; x < p_clip[2]; x++)
+        {
+            uint32_t i = (uint32_t) (y * BENCH_WIDTH + x);
+            mismatches += framebuffer[i] != (uint16_t) (reference[2 * i] | (reference[2 * i + 1] << 8));
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+    TEST_CHECK_EQ(pixels_sent, (unsigned long) visible * BENCH_ROUNDS);
+
+    double wire_bytes = (double) (2 * pixels_sent + BENCH_WINDOW_BYTES * windows) / BENCH_ROUNDS;
+    double wire_ms = wire_bytes / wire_mb_per_s / 1e3;
+    printf("%-6s %6lu bytes, %3dx%-3d visible: decoded in %.3f ms per frame vs %.2f ms on the SPI wire (%.0f bytes, %lu Address Windows), %.1fx the wire rate\n",
+           name, (unsigned long) size, p_clip[2] - p_clip[0], p_clip[3] - p_clip[1], seconds * 1e3 / BENCH_ROUNDS, wire_ms, wire_bytes,
+           windows / BENCH_ROUNDS, wire_ms / (seconds * 1e3 / BENCH_ROUNDS));
+}
+
+int main(void)
+{
+    static ILI9341_handle_t lcd;
+    const char *names[5] = {"p420", "p422", "p444", "gray", "q100"};
+    const int full[4] = {0, 0, BENCH_WIDTH, BENCH_HEIGHT};
+    const int centre[4] = {80, 60, 240, 180};
+
+    for (int i = 0; i < 5; i++)
+    {
+        bench_decode(names[i], &lcd, full);
+        bench_decode(names[i], &lcd, centre);
+    }
+
+    printf("bench_jpeg_decode: %lu checks, %lu failed\n", checks, failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+/**@file
+ * @brief	Compares sending a native RGB565 frame with @ref ili9341_write_pixels_16bpp (i.e., unswapped, in 16 bit SPI
+ *          data frames) against byte-swapping it first and sending it with @ref ili9341_write_pixels (i.e., in 8 bit
+ *          SPI data frames).
+ *
+ * @details Both ways must draw the very same frame and put the very same bytes on the bus, but the unswapped one
+ *          needs neither the CPU time of the byte swap nor a second frame-sized buffer, and the DMA moves half as many
+ *          frames. Since the ILI9341 Device does not honour @ref ILI9341_ENDIAN_LITTLE through its serial interface,
+ *          this also checks that @ref ili9341_set_interface_control rejects it without sending anything.
+ */
+
+#include "ili9341_test.h"
+
+#define FRAME_PIXELS        (ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT)  /**< @brief Number of pixels of a whole frame. */
+
+static uint16_t frame[FRAME_PIXELS];
+static uint8_t swapped[FRAME_PIXELS * 2];
+
+typedef struct
+{
+    uint64_t cpu_ns;
+    host_hal_stats_t stats;
+} bench_result_t;
+
+static void bench_unswapped(bench_result_t *p_result)
+{
+    ILI9341_handle_t *p_lcd = &test_lcd[0];
+    TEST_CHECK_EQ(ili9341_set_window(p_lcd, 0, 0, 0, 0), ILI9341_EC_OK); // So that the whole Address Window is sent again.
+    test_sync(p_lcd);
+    uint64_t start_ns = host_thread_cpu_time_ns();
+    TEST_CHECK_EQ(ili9341_set_window(p_lcd, 0, 0, ILI9341_SCREEN_WIDTH - 1, ILI9341_SCREEN_HEIGHT - 1), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_write_pixels_16bpp(p_lcd, frame, FRAME_PIXELS, NULL), ILI9341_EC_OK);
+    p_result->cpu_ns = host_thread_cpu_time_ns() - start_ns;
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    host_hal_get_stats(&p_result->stats);
+    TEST_CHECK_EQ(test_compare_frame_565(&test_panel[0], frame), 0);
+}
+
+static void bench_swapped(bench_result_t *p_result)
+{
+    ILI9341_handle_t *p_lcd = &test_lcd[0];
+    TEST_CHECK_EQ(ili9341_set_window(p_lcd, 0, 0, 0, 0), ILI9341_EC_OK); // So that the whole Address Window is sent again.
+    test_sync(p_lcd);
+    ili9341_panel_model_fill_gram(&test_panel[0], 0);
+    uint64_t start_ns = host_thread_cpu_time_ns();
+    for (uint32_t i = 0; i < FRAME_PIXELS; i++)
+    {
+        swapped[2 * i] = (uint8_t) (frame[i] >> 8);
+        swapped[2 * i + 1] = (uint8_t) frame[i];
+    }
+    TEST_CHECK_EQ(ili9341_set_window(p_lcd, 0, 0, ILI9341_SCREEN_WIDTH - 1, ILI9341_SCREEN_HEIGHT - 1), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_write_pixels(p_lcd, swapped, sizeof(swapped), NULL), ILI9341_EC_OK);
+    p_result->cpu_ns = host_thread_cpu_time_ns() - start_ns;
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    host_hal_get_stats(&p_result->stats);
+    TEST_CHECK_EQ(test_compare_frame_565(&test_panel[0], frame), 0);
+}
+
+static void print_result(const char *name, const bench_result_t *p_result)
+{
+    printf("%-40s %6lu bytes, %6lu DMA frames in %lu transfers, %6.2f ms on the bus, %7.1f us of caller CPU time\n", name,
+           (unsigned long) p_result->stats.bytes, (unsigned long) p_result->stats.frames, (unsigned long) p_result->stats.transfers,
+           p_result->stats.bus_time_ns / 1e6, p_result->cpu_ns / 1e3);
+}
+
+int main(void)
+{
+    test_begin(NULL, 1);
+    for (uint32_t i = 0; i < FRAME_PIXELS; i++)
+    {
+        frame[i] = (uint16_t) ((i * 2654435761U) >> 13);
+    }
+
+    /* The little-endian byte order is rejected, and nothing is sent for it. */
+    TEST_CHECK_EQ(ili9341_set_interface_control(&test_lcd[0], ILI9341_ENDIAN_LITTLE, ILI9341_EPF_MSB_COPY), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    TEST_CHECK_EQ(test_panel[0].stats.bytes, 0);
+    TEST_CHECK_EQ(test_panel[0].ifctl[2], 0x00);
+
+    bench_result_t unswapped;
+    bench_result_t swapped_result;
+    bench_unswapped(&unswapped);
+    bench_swapped(&swapped_result);
+    print_result("unswapped (write_pixels_16bpp)", &unswapped);
+    print_result("byte-swapped by the CPU (write_pixels)", &swapped_result);
+    TEST_CHECK_EQ(unswapped.stats.bytes, swapped_result.stats.bytes);
+    TEST_CHECK_EQ(2 * (unswapped.stats.frames - 11), swapped_result.stats.frames - 11); // Both send the same 11 bytes of Commands and Address Window in 8 bit frames.
+    TEST_CHECK(unswapped.stats.transfers < swapped_result.stats.transfers);
+
+    return test_end("bench_pixel_byte_order");
+}
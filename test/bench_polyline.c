@@ -0,0 +1,124 @@
+/**@file
+ * @brief	Measures the bytes that @ref ili9341_draw_polyline sends for a 1000-segment polyline, against drawing the
+ *          very same Bresenham lines one @ref ili9341_draw_pixel at a time.
+ *
+ * @details The polyline is a random walk of steps of up to 20 pixels in each axis that stays within the screen, so
+ *          most of its segments have runs of several pixels that share a single Address Window. Both ways of drawing
+ *          it must leave the same Frame Memory.
+ */
+
+#include "ili9341_graphics.h"
+#include "ili9341_test.h"
+#include <stdlib.h> // This library contains the functions: abs, rand and srand.
+
+#define BENCH_SEGMENTS      (1000)  /**< @brief Number of segments of the polyline. */
+#define BENCH_MAX_STEP      (20)    /**< @brief Largest change of each coordinate between consecutive points. */
+
+static ILI9341_point_t points[BENCH_SEGMENTS + 1];
+static uint16_t frame[ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT];
+
+/**@brief   Draws the given line with the textbook Bresenham algorithm, one @ref ili9341_draw_pixel per pixel.
+ */
+static void draw_line_per_pixel(ILI9341_handle_t *p_handle, int x0, int y0, int x1, int y1, ILI9341_COLOR color)
+{
+    int dx = abs(x1 - x0);
+    int dy = abs(y1 - y0);
+    int sx = (x1 >= x0) ? 1 : -1;
+    int sy = (y1 >= y0) ? 1 : -1;
+    int x = x0;
+    int y = y0;
+    int is_x_major = dx >= dy;
+    int d = is_x_major ? (2 * dy - dx) : (2 * dx - dy);
+    for (;;)
+    {
+        ili9341_draw_pixel(p_handle, (int16_t) x, (int16_t) y, color);
+        if ((x == x1) && (y == y1))
+        {
+            break;
+        }
+        if (is_x_major)
+        {
+            if (d > 0)
+            {
+                y += sy;
+                d -= 2 * dx;
+            }
+            d += 2 * dy;
+            x += sx;
+        }
+        else
+        {
+            if (d > 0)
+            {
+                x += sx;
+                d -= 2 * dy;
+            }
+            d += 2 * dx;
+            y += sy;
+        }
+    }
+}
+
+static int16_t clamp(int value, int max)
+{
+    return (int16_t) ((value < 0) ? 0 : ((value > max) ? max : value));
+}
+
+int main(void)
+{
+    ILI9341_handle_t *p_lcd = &test_lcd[0];
+    ILI9341_COLOR black = {0};
+    ILI9341_COLOR white;
+    white.bpp_16 = 0xFFFF;
+    host_hal_stats_t runs;
+    host_hal_stats_t per_pixel;
+    test_begin(NULL, 1);
+
+    srand(7);
+    points[0].x = ILI9341_SCREEN_WIDTH / 2;
+    points[0].y = ILI9341_SCREEN_HEIGHT / 2;
+    for (int i = 1; i <= BENCH_SEGMENTS; i++)
+    {
+        points[i].x = clamp(points[i - 1].x + rand() % (2 * BENCH_MAX_STEP + 1) - BENCH_MAX_STEP, ILI9341_SCREEN_WIDTH - 1);
+        points[i].y = clamp(points[i - 1].y + rand() % (2 * BENCH_MAX_STEP + 1) - BENCH_MAX_STEP, ILI9341_SCREEN_HEIGHT - 1);
+    }
+
+    /* The polyline, drawn as runs. */
+    TEST_CHECK_EQ(ili9341_fill_screen(p_lcd, black), ILI9341_EC_OK);
+    test_sync(p_lcd);
+    TEST_CHECK_EQ(ili9341_draw_polyline(p_lcd, points, BENCH_SEGMENTS + 1, white), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    host_hal_get_stats(&runs);
+    uint32_t runs_pixels = test_panel[0].stats.pixels;
+    for (int y = 0; y < ILI9341_SCREEN_HEIGHT; y++)
+    {
+        for (int x = 0; x < ILI9341_SCREEN_WIDTH; x++)
+        {
+            frame[y * ILI9341_SCREEN_WIDTH + x] = ili9341_panel_model_get_pixel_565(&test_panel[0], x, y);
+        }
+    }
+
+    /* The very same lines, drawn one pixel at a time. */
+    TEST_CHECK_EQ(ili9341_fill_screen(p_lcd, black), ILI9341_EC_OK);
+    test_sync(p_lcd);
+    for (int i = 1; i <= BENCH_SEGMENTS; i++)
+    {
+        draw_line_per_pixel(p_lcd, points[i - 1].x, points[i - 1].y, points[i].x, points[i].y, white);
+    }
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    host_hal_get_stats(&per_pixel);
+    uint32_t per_pixel_pixels = test_panel[0].stats.pixels;
+
+    printf("%d-segment polyline as runs:   %8lu bytes in %6lu transfers, %6lu pixels, %7.2f ms on the bus\n", BENCH_SEGMENTS,
+           (unsigned long) runs.bytes, (unsigned long) runs.transfers, (unsigned long) runs_pixels, runs.bus_time_ns / 1e6);
+    printf("%d-segment polyline per pixel: %8lu bytes in %6lu transfers, %6lu pixels, %7.2f ms on the bus\n", BENCH_SEGMENTS,
+           (unsigned long) per_pixel.bytes, (unsigned long) per_pixel.transfers, (unsigned long) per_pixel_pixels, per_pixel.bus_time_ns / 1e6);
+    printf("runs / per pixel: %.3f of the bytes\n", (double) runs.bytes / (double) per_pixel.bytes);
+    TEST_CHECK(runs.bytes < per_pixel.bytes);
+    TEST_CHECK(runs.transfers < per_pixel.transfers);
+    /* The pixels shared by consecutive segments are only sent once by the polyline. */
+    TEST_CHECK_EQ(per_pixel_pixels - runs_pixels, BENCH_SEGMENTS - 1);
+    TEST_CHECK_EQ(test_compare_frame_565(&test_panel[0], frame), 0);
+
+    return test_end("bench_polyline");
+}
@@ -0,0 +1,164 @@
+/**@file
+ * @brief	Measures how fast @ref ili9341_draw_qoi_image decodes full-screen QOI images, in 16 and 18 bits per pixel
+ *          and into both Bits Per Pixel (BPP) types of the ILI9341 Device, against the rate at which a 36 MHz SPI bus
+ *          sends the decoded pixels.
+ *
+ * @details This benchmark is only linked with the @ref ili9341_images module, while the functions of the @ref ili9341
+ *          that it calls are stubbed out below, so that each line buffer is taken back as soon as it is queued and only
+ *          the decoding is timed. Whenever the decoder is faster than the SPI bus, the decoding of each line buffer
+ *          fully overlaps with the transfer of the previous one. The stubs also checksum the decoded pixels, which
+ *          must match the ones of the source images.
+ */
+
+#include "ili9341_images.h"
+#include "ili9341_test.h"
+
+#define BENCH_SPI_CLOCK_HZ      (36000000U)     /**< @brief Clock of the SPI bus against which the decoding rate is compared. */
+#define BENCH_ROUNDS            (500)           /**< @brief Number of times that each image is decoded. */
+
+extern const ILI9341_qoi_image_t photo_ppm_qoi_16, photo_ppm_qoi_18, illustration_png_qoi_16, illustration_png_qoi_18;
+extern const test_source_image_t photo_ppm_source, illustration_png_source;
+
+static ILI9341_BPP_t panel_bpp;
+static uint32_t checksum;
+static unsigned long checks;
+static unsigned long failures;
+
+/**@brief   Converts a 0xAARRGGBB pixel of a @ref test_source_image_t into the color that the decoder sends for it,
+ *          once quantized into \p image_bpp by the encoder and converted into @ref panel_bpp , as either a 16 bits per
+ *          pixel color or a 0xRRGGBB value with the 6 bits of each channel in its highest bits.
+ */
+static uint32_t argb_to_output(uint32_t argb, ILI9341_BPP_t image_bpp)
+{
+    uint32_t red = (argb >> 18) & 0x3F;
+    uint32_t green = (argb >> 10) & 0x3F;
+    uint32_t blue = (argb >> 2) & 0x3F;
+    if (image_bpp == ILI9341_BPP_16)
+    {
+        red = (red & 0x3E) | (red >> 5);
+        blue = (blue & 0x3E) | (blue >> 5);
+    }
+    return (panel_bpp == ILI9341_BPP_16) ? (((red >> 1) << 11) | (green << 5) | (blue >> 1)) : ((red << 18) | (green << 10) | (blue << 2));
+}
+
+static void add_to_checksum(uint32_t pixel)
+{
+    checksum = (checksum ^ pixel) * 16777619U;
+}
+
+ILI9341_BPP_t get_ili9341_bpp_type(ILI9341_handle_t *p_handle)
+{
+    (void) p_handle;
+    return panel_bpp;
+}
+
+ILI9341_Status ili9341_set_window(ILI9341_handle_t *p_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    (void) p_handle;
+    (void) x0;
+    (void) y0;
+    (void) x1;
+    (void) y1;
+    return ILI9341_EC_OK;
+}
+
+ILI9341_Status ili9341_write_pixels_16bpp(ILI9341_handle_t *p_handle, const uint16_t *pixels, uint32_t count, volatile uint8_t *p_is_buffer_in_use)
+{
+    (void) p_handle;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        add_to_checksum(pixels[i]);
+    }
+    if (p_is_buffer_in_use != NULL)
+    {
+        *p_is_buffer_in_use = 0;
+    }
+    return ILI9341_EC_OK;
+}
+
+ILI9341_Status ili9341_write_pixels(ILI9341_handle_t *p_handle, const uint8_t *pixels, uint32_t size, volatile uint8_t *p_is_buffer_in_use)
+{
+    (void) p_handle;
+    for (uint32_t i = 0; i + 2 < size; i += 3)
+    {
+        add_to_checksum(((uint32_t) pixels[i] << 16) | ((uint32_t) pixels[i + 1] << 8) | pixels[i + 2]);
+    }
+    if (p_is_buffer_in_use != NULL)
+    {
+        *p_is_buffer_in_use = 0;
+    }
+    return ILI9341_EC_OK;
+}
+
+ILI9341_Status ili9341_blit(ILI9341_handle_t *p_handle, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t *pixels, uint16_t stride)
+{
+    (void) p_handle;
+    (void) x;
+    (void) y;
+    (void) width;
+    (void) height;
+    (void) pixels;
+    (void) stride;
+    return ILI9341_EC_OK;
+}
+
+/* This benchmark does not start the virtual ILI9341 Device, so it keeps its own count of the checks. */
+void test_check_eq(long long actual, long long expected, const char *expression, const char *file, int line)
+{
+    checks++;
+    if (actual != expected)
+    {
+        failures++;
+        printf("%s:%d: check failed: %s is %lld, expected %lld\n", file, line, expression, actual, expected);
+    }
+}
+
+static void bench_decode(const char *name, ILI9341_handle_t *p_handle, const ILI9341_qoi_image_t *p_image, const test_source_image_t *p_source, ILI9341_BPP_t bpp)
+{
+    uint32_t pixels = (uint32_t) p_image->width * p_image->height;
+    uint32_t raw_size = pixels * ((p_image->bpp_type == ILI9341_BPP_16) ? 2U : 3U);
+    double bytes_per_pixel = (bpp == ILI9341_BPP_16) ? 2.0 : 3.0;
+    double wire_mb_per_s = BENCH_SPI_CLOCK_HZ / 8.0 / 1e6;
+    uint32_t expected_checksum;
+
+    panel_bpp = bpp;
+    checksum = 2166136261U;
+    for (uint32_t i = 0; i < pixels; i++)
+    {
+        add_to_checksum(argb_to_output(p_source->p_argb[i], p_image->bpp_type));
+    }
+    expected_checksum = checksum;
+
+    uint64_t start_ns = host_time_ns();
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        checksum = 2166136261U;
+        TEST_CHECK_EQ(ili9341_draw_qoi_image(p_handle, 0, 0, p_image), ILI9341_EC_OK);
+    }
+    double seconds = (host_time_ns() - start_ns) / 1e9;
+    TEST_CHECK_EQ(checksum, expected_checksum);
+
+    double decoded_mb_per_s = bytes_per_pixel * pixels * BENCH_ROUNDS / seconds / 1e6;
+    printf("%-18s into %dbpp: %6lu bytes for %lu pixels (%.2f of the raw size): decoded at %8.1f MB/s (%.3f ms per frame) vs %.1f MB/s on the SPI wire (%.2f ms per frame), %.0fx the wire rate\n",
+           name, (bpp == ILI9341_BPP_16) ? 16 : 18, (unsigned long) p_image->size, (unsigned long) pixels, (double) p_image->size / raw_size,
+           decoded_mb_per_s, seconds * 1e3 / BENCH_ROUNDS, wire_mb_per_s, bytes_per_pixel * pixels / wire_mb_per_s / 1e3, decoded_mb_per_s / wire_mb_per_s);
+}
+
+int main(void)
+{
+    static ILI9341_handle_t lcd;
+    const ILI9341_BPP_t bpps[2] = {ILI9341_BPP_16, ILI9341_BPP_18};
+    lcd.clip_rect.x1 = ILI9341_SCREEN_WIDTH - 1;
+    lcd.clip_rect.y1 = ILI9341_SCREEN_HEIGHT - 1;
+
+    for (int b = 0; b < 2; b++)
+    {
+        bench_decode("photo 16bpp", &lcd, &photo_ppm_qoi_16, &photo_ppm_source, bpps[b]);
+        bench_decode("photo 18bpp", &lcd, &photo_ppm_qoi_18, &photo_ppm_source, bpps[b]);
+        bench_decode("illustration 16bpp", &lcd, &illustration_png_qoi_16, &illustration_png_source, bpps[b]);
+        bench_decode("illustration 18bpp", &lcd, &illustration_png_qoi_18, &illustration_png_source, bpps[b]);
+    }
+
+    printf("bench_qoi_decode: %lu checks, %lu failed\n", checks, failures);
+    return (failures == 0) ? 0 : 1;
+}
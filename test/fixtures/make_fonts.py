@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Generates the TrueType font with which the host tests check "tools/ili9341_font_compiler.py".
+
+The font holds the glyphs of "AVTo." and of the space, built from straight and quadratic outlines (i.e., a triangle
+with a hole, a rectangle union, a contour of only off-curve points and a square), and a "kern" table whose pairs are
+sorted by glyph index, as the TrueType specification requires. Since the glyph indexes are not in the order of the
+character codes, the compiler has to sort the pairs by character code itself:
+
+    python3 test/fixtures/make_fonts.py <output directory>
+
+Only the Python standard library is required.
+"""
+
+import struct
+import sys
+
+UNITS_PER_EM = 1000
+ASCENDER = 800
+DESCENDER = -200
+
+# Glyphs by glyph index, as (character code, advance width, contours), where each contour is a list of
+# (x, y, is_on_curve) points in font units. Glyph 0 is the empty .notdef glyph.
+GLYPHS = [
+    (None, 500, []),
+    (ord("V"), 640, [[(0, 700, True), (640, 700, True), (320, 0, True)]]),
+    (ord("A"), 640, [[(0, 0, True), (320, 700, True), (640, 0, True)],
+                     [(200, 120, True), (440, 120, True), (320, 420, True)]]),
+    (ord("T"), 600, [[(0, 700, True), (600, 700, True), (600, 600, True), (350, 600, True), (350, 0, True),
+                      (250, 0, True), (250, 600, True), (0, 600, True)]]),
+    (ord("o"), 540, [[(270, 500, False), (520, 250, False), (270, 0, False), (20, 250, False)],
+                     [(270, 390, True), (130, 250, False), (270, 110, True), (410, 250, False)]]),
+    (ord("."), 260, [[(80, 0, True), (80, 120, True), (200, 120, True), (200, 0, True)]]),
+    (ord(" "), 280, []),
+]
+
+# Kerning pairs as ((left, right) characters, adjustment in font units), where the ones that round to zero at the
+# sizes of the tests must be left out by the compiler.
+KERNING = [
+    (("A", "V"), -90), (("V", "A"), -90), (("A", "T"), -70), (("T", "A"), -70), (("T", "o"), -130),
+    (("V", "o"), -60), (("o", "."), -45), (("o", "o"), -4), (("T", "."), -110),
+]
+
+
+def search_fields(count, size):
+    """Returns the searchRange, entrySelector and rangeShift fields of a binary-searchable table of \"count\" items."""
+    power = 1
+    selector = 0
+    while power * 2 <= count:
+        power *= 2
+        selector += 1
+    return power * size, selector, count * size - power * size
+
+
+def make_glyph(contours):
+    if not contours:
+        return b""
+    points = [point for contour in contours for point in contour]
+    xs = [x for x, _, _ in points]
+    ys = [y for _, y, _ in points]
+    data = struct.pack(">hhhhh", len(contours), min(xs), min(ys), max(xs), max(ys))
+    end = -1
+    for contour in contours:
+        end += len(contour)
+        data += struct.pack(">H", end)
+    data += struct.pack(">H", 0)  # No instructions.
+    data += bytes(0x01 if on else 0x00 for _, _, on in points)  # Every coordinate is a 16-bit delta.
+    for axis in (0, 1):
+        previous = 0
+        for point in points:
+            data += struct.pack(">h", point[axis] - previous)
+            previous = point[axis]
+    return data + b"\0" * (len(data) % 2)
+
+
+def make_cmap():
+    mapping = sorted((code, index) for index, (code, _, _) in enumerate(GLYPHS) if code is not None)
+    segments = [(code, code, (index - code) & 0xFFFF) for code, index in mapping] + [(0xFFFF, 0xFFFF, 1)]
+    count = len(segments)
+    search_range, selector, shift = search_fields(count, 2)
+    body = struct.pack(">HHHH", count * 2, search_range, selector, shift)
+    body += b"".join(struct.pack(">H", end) for _, end, _ in segments) + struct.pack(">H", 0)
+    body += b"".join(struct.pack(">H", start) for start, _, _ in segments)
+    body += b"".join(struct.pack(">H", delta) for _, _, delta in segments)
+    body += b"".join(struct.pack(">H", 0) for _ in segments)
+    subtable = struct.pack(">HHH", 4, 6 + len(body), 0) + body
+    return struct.pack(">HHHHI", 0, 1, 3, 1, 12) + subtable
+
+
+def make_kern():
+    index = {chr(code): i for i, (code, _, _) in enumerate(GLYPHS) if code is not None}
+    pairs = sorted((index[left], index[right], value) for (left, right), value in KERNING)
+    search_range, selector, shift = search_fields(len(pairs), 6)
+    body = struct.pack(">HHHH", len(pairs), search_range, selector, shift)
+    body += b"".join(struct.pack(">HHh", left, right, value) for left, right, value in pairs)
+    return struct.pack(">HH", 0, 1) + struct.pack(">HHH", 0, 6 + len(body), 0x0001) + body
+
+
+def checksum(data):
+    data += b"\0" * (-len(data) % 4)
+    return sum(struct.unpack(">%dI" % (len(data) // 4), data)) & 0xFFFFFFFF
+
+
+def make_font():
+    glyphs = [make_glyph(contours) for _, _, contours in GLYPHS]
+    offsets = [0]
+    for glyph in glyphs:
+        offsets.append(offsets[-1] + len(glyph))
+    points = [point for _, _, contours in GLYPHS for contour in contours for point in contour]
+    bounds = (min(x for x, _, _ in points), min(y for _, y, _ in points), max(x for x, _, _ in points),
+              max(y for _, y, _ in points))
+    max_advance = max(advance for _, advance, _ in GLYPHS)
+    tables = {
+        "head": struct.pack(">IIIIHHQQhhhhHHhhh", 0x00010000, 0x00010000, 0, 0x5F0F3CF5, 0x000B, UNITS_PER_EM, 0, 0,
+                            *bounds, 0, 8, 2, 1, 0),
+        "hhea": struct.pack(">IhhhHhhhhhh8xhH", 0x00010000, ASCENDER, DESCENDER, 0, max_advance, 0, 0, bounds[2], 1, 0,
+                            0, 0, len(GLYPHS)),
+        "maxp": struct.pack(">IH", 0x00005000, len(GLYPHS)),
+        "hmtx": b"".join(struct.pack(">Hh", advance, 0) for _, advance, _ in GLYPHS),
+        "loca": b"".join(struct.pack(">I", offset) for offset in offsets),
+        "glyf": b"".join(glyphs),
+        "cmap": make_cmap(),
+        "kern": make_kern(),
+    }
+    tags = sorted(tables)
+    search_range, selector, shift = search_fields(len(tags), 16)
+    header = struct.pack(">IHHHH", 0x00010000, len(tags), search_range, selector, shift)
+    offset = len(header) + 16 * len(tags)
+    directory = b""
+    body = b""
+    for tag in tags:
+        data = tables[tag]
+        directory += struct.pack(">4sIII", tag.encode("latin-1"), checksum(data), offset + len(body), len(data))
+        body += data + b"\0" * (-len(data) % 4)
+    font = bytearray(header + directory + body)
+    head = offset + body.index(tables["head"])
+    font[head + 8:head + 12] = struct.pack(">I", (0xB1B0AFBA - checksum(bytes(font))) & 0xFFFFFFFF)
+    return bytes(font)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: make_fonts.py <output directory>")
+    with open(sys.argv[1] + "/kern.ttf", "wb") as out:
+        out.write(make_font())
+
+
+if __name__ == "__main__":
+    main()
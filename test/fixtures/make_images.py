@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""Generates the PNG and PPM images with which the host tests check "tools/ili9341_image_encoder.py".
+
+Every image is synthesized from a fixed seed and written into the requested directory, together with
+"test_images.c", which holds the RGBA pixels from which each image was written (see test_source_image_t in
+"host/ili9341_test.h"). Since those pixels never go through the decoders of the encoder, the tests can compare the
+Frame Memory drawn from the encoded images against the very pixels that went into them:
+
+    python3 test/fixtures/make_images.py <output directory>
+
+Only the Python standard library is required.
+"""
+
+import math
+import random
+import struct
+import sys
+import zlib
+
+
+def png_chunk(kind, body):
+    return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body) & 0xFFFFFFFF)
+
+
+def filter_rows(rows, bytes_per_pixel, rng):
+    """Applies a random PNG filter to each row, so that the decoder of the encoder has to undo all of them."""
+    out = bytearray()
+    previous = bytearray(len(rows[0]))
+    for row in rows:
+        kind = rng.randint(0, 4)
+        out.append(kind)
+        for i, value in enumerate(row):
+            a = row[i - bytes_per_pixel] if i >= bytes_per_pixel else 0
+            b = previous[i]
+            c = previous[i - bytes_per_pixel] if i >= bytes_per_pixel else 0
+            if kind == 0:
+                predictor = 0
+            elif kind == 1:
+                predictor = a
+            elif kind == 2:
+                predictor = b
+            elif kind == 3:
+                predictor = (a + b) >> 1
+            else:
+                estimate = a + b - c
+                pa, pb, pc = abs(estimate - a), abs(estimate - b), abs(estimate - c)
+                predictor = a if (pa <= pb and pa <= pc) else (b if pb <= pc else c)
+            out.append((value - predictor) & 0xFF)
+        previous = bytearray(row)
+    return bytes(out)
+
+
+def write_png(path, width, height, color_type, depth, rows, rng, extra_chunks=b""):
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    header = struct.pack(">IIBBBBB", width, height, depth, color_type, 0, 0, 0)
+    data = zlib.compress(filter_rows(rows, max(1, channels * depth // 8), rng))
+    with open(path, "wb") as out:
+        out.write(b"\x89PNG\r\n\x1a\n" + png_chunk(b"IHDR", header) + extra_chunks + png_chunk(b"IDAT", data) + png_chunk(b"IEND", b""))
+
+
+def write_ppm(path, width, height, pixels):
+    with open(path, "wb") as out:
+        out.write(b"P6\n# ILI9341 host test image\n%d %d\n255\n" % (width, height))
+        out.write(bytes(channel for pixel in pixels for channel in pixel[:3]))
+
+
+def make_sprite_images(directory, rng):
+    """Images of the sprite test: RGBA with an alpha mask, a PPM with a color key and a 4-bit palette with tRNS."""
+    images = {}
+    width, height = 37, 29
+
+    pixels = []
+    for y in range(height):
+        for x in range(width):
+            is_opaque = ((x - 18) ** 2 + (y - 14) ** 2 < 13 ** 2) or (5 < x < 12)
+            alpha = rng.choice((255, 200, 128)) if is_opaque else rng.choice((0, 64, 127))
+            pixels.append((rng.randint(0, 255), rng.randint(0, 255), rng.randint(0, 255), alpha))
+    rows = [bytes(c for p in pixels[y * width:(y + 1) * width] for c in p) for y in range(height)]
+    write_png(directory + "/rgba.png", width, height, 6, 8, rows, rng)
+    images["rgba_png"] = (width, height, pixels)
+
+    pixels = [(255, 0, 255, 255) if (x + y) % 5 == 0 else (x * 6, y * 8, 100, 255) for y in range(height) for x in range(width)]
+    write_ppm(directory + "/key.ppm", width, height, pixels)
+    images["key_ppm"] = (width, height, pixels)
+
+    palette = [(i * 16, 255 - i * 16, i * 8) for i in range(16)]
+    indexes = [[(x + y) % 16 for x in range(width)] for y in range(height)]
+    rows = [bytes((row[x] << 4) | (row[x + 1] if x + 1 < width else 0) for x in range(0, width, 2)) for row in indexes]
+    chunks = png_chunk(b"PLTE", bytes(c for p in palette for c in p)) + png_chunk(b"tRNS", bytes([0] + [255] * 15))
+    write_png(directory + "/pal4.png", width, height, 3, 4, rows, rng, chunks)
+    images["pal4_png"] = (width, height, [palette[i] + ((0,) if i == 0 else (255,)) for row in indexes for i in row])
+    return images
+
+
+def make_rle_images(directory, rng):
+    """Images of the RLE test and benchmark: a full-screen background of flat areas, gradients, bands and noise, a
+    full-screen image of pure noise (i.e., the worst case of the RLE format) and a small image of short runs."""
+    images = {}
+    width, height = 240, 320
+
+    def background(x, y):
+        if y < 80:
+            return (30, 60, 200)
+        if y < 200:
+            return (0, (y * 2) & 0xFF, x & 0xFF)
+        if 100 < x < 140:
+            return (rng.randint(0, 255), rng.randint(0, 255), rng.randint(0, 255))
+        return (200, (x // 16) * 16, 40)
+
+    pixels = [background(x, y) + (255,) for y in range(height) for x in range(width)]
+    write_ppm(directory + "/background.ppm", width, height, pixels)
+    images["background_ppm"] = (width, height, pixels)
+
+    pixels = [(rng.randint(0, 255), rng.randint(0, 255), rng.randint(0, 255), 255) for _ in range(width * height)]
+    write_ppm(directory + "/noise.ppm", width, height, pixels)
+    images["noise_ppm"] = (width, height, pixels)
+
+    width, height = 37, 23
+    pixels = [(rng.randint(0, 3) * 80, (x * 7) & 0xFF, 0, 255) for y in range(height) for x in range(width)]
+    write_ppm(directory + "/small.ppm", width, height, pixels)
+    images["small_ppm"] = (width, height, pixels)
+    return images
+
+
+def make_qoi_images(directory, rng):
+    """Images of the QOI test and benchmark: a full-screen photo-like image of smooth color fields with sensor-like
+    noise, a full-screen illustration of flat shapes and gradients, and a small image that mixes noise, gradients and
+    repeated pixels so that it uses every operation of the format."""
+    images = {}
+    width, height = 240, 320
+
+    pixels = []
+    for y in range(height):
+        for x in range(width):
+            red = 128 + 60 * math.sin(x / 37.0) + 40 * math.cos((x + y) / 53.0)
+            green = 128 + 70 * math.sin(y / 29.0 + x / 91.0)
+            blue = 110 + 80 * math.cos(math.hypot(x - 120, y - 160) / 40.0)
+            pixels.append(tuple(max(0, min(255, int(v + rng.gauss(0, 3)))) for v in (red, green, blue)) + (255,))
+    write_ppm(directory + "/photo.ppm", width, height, pixels)
+    images["photo_ppm"] = (width, height, pixels)
+
+    def illustration(x, y):
+        if (x - 120) ** 2 + (y - 110) ** 2 < 70 ** 2:
+            return (250, 200 - y // 4, 40)
+        if 30 < x < 210 and 200 < y < 290:
+            return (20, 120, 220) if (x // 30 + y // 30) % 2 else (240, 240, 240)
+        return (x // 2, 40, 80 + y // 4)
+
+    pixels = [illustration(x, y) + (255,) for y in range(height) for x in range(width)]
+    rows = [bytes(c for p in pixels[y * width:(y + 1) * width] for c in p[:3]) for y in range(height)]
+    write_png(directory + "/illustration.png", width, height, 2, 8, rows, rng)
+    images["illustration_png"] = (width, height, pixels)
+
+    width, height = 41, 27
+    pixels = []
+    for i in range(width * height):
+        k = rng.random()
+        if k < 0.3:
+            pixels.append((rng.randint(0, 255), rng.randint(0, 255), rng.randint(0, 255), 255))
+        elif k < 0.8:
+            pixels.append((i % 256, (i * 3) % 256, 40, 255))
+        else:
+            pixels.append((0x10, 0x20, 0x30, 255))
+    write_ppm(directory + "/mixed.ppm", width, height, pixels)
+    images["mixed_ppm"] = (width, height, pixels)
+    return images
+
+
+def write_sources(path, images):
+    with open(path, "w") as out:
+        out.write("/* Generated by test/fixtures/make_images.py: the RGBA pixels from which each test image was written. */\n\n")
+        out.write('#include "ili9341_test.h"\n')
+        for name, (width, height, pixels) in images.items():
+            values = ["0x%08X" % ((p[3] << 24) | (p[0] << 16) | (p[1] << 8) | p[2]) for p in pixels]
+            out.write("\nstatic const uint32_t %s_argb[%d] =\n{\n" % (name, len(values)))
+            for i in range(0, len(values), 8):
+                out.write("    " + ", ".join(values[i:i + 8]) + ",\n")
+            out.write("};\n\nconst test_source_image_t %s_source = {%d, %d, %s_argb};\n" % (name, width, height, name))
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: make_images.py <output directory>")
+    directory = sys.argv[1]
+    images = {}
+    images.update(make_sprite_images(directory, random.Random(1)))
+    images.update(make_rle_images(directory, random.Random(5)))
+    images.update(make_qoi_images(directory, random.Random(3)))
+    write_sources(directory + "/test_images.c", images)
+
+
+if __name__ == "__main__":
+    main()
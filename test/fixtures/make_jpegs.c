@@ -0,0 +1,178 @@
+/**@file
+ * @brief	Generates the JPEG images of "test/fixtures/jpeg", with which the host tests check the @ref ili9341_jpeg ,
+ *          together with the 16 bits per pixel reference into which libjpeg decodes each of them.
+ *
+ * @details Every image is synthesized from a fixed seed (i.e., a sine gradient with some noise, a checkerboard and a
+ *          red disc) and then encoded with the sampling factors, restart interval and quality of its entry in
+ *          @ref fixtures . The reference of each image that the @ref ili9341_jpeg supports is decoded with the same inverse DCT as the @ref ili9341_jpeg
+ *          (i.e., JDCT_ISLOW) and with its chroma upsampled by replication (i.e., without fancy upsampling), and is
+ *          written as one little-endian 16 bits per pixel pixel per pixel of the image into "<name>.565". The
+ *          generated files are kept in the repository, so this program is only needed to regenerate them:
+ *
+ *              cc -O2 -o make_jpegs test/fixtures/make_jpegs.c -ljpeg -lm && ./make_jpegs test/fixtures/jpeg
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <jpeglib.h> // This must come after stdio.h, since it uses FILE and size_t.
+
+/**@brief   Parameters with which each of the JPEG images is generated.
+ */
+static const struct
+{
+    const char *name;       //!< Name of the generated files, without their extension.
+    int width;              //!< Number of columns of the image.
+    int height;             //!< Number of rows of the image.
+    int h;                  //!< Horizontal sampling factor of the luma.
+    int v;                  //!< Vertical sampling factor of the luma.
+    int is_gray;            //!< Whether the image only has the luma component (1) or not (0).
+    int restart_interval;   //!< Number of MCUs between restart markers, or 0 for none.
+    int quality;            //!< Quality given to libjpeg, from 1 up to 100.
+    int is_progressive;     //!< Whether the image is progressive (1), which the ILI9341 JPEG module rejects, or not (0).
+} fixtures[] =
+{
+    {"p444", 320, 240, 1, 1, 0, 0, 85, 0},
+    {"p422", 320, 240, 2, 1, 0, 0, 85, 0},
+    {"p420", 320, 240, 2, 2, 0, 0, 85, 0},
+    {"gray", 320, 240, 1, 1, 1, 0, 85, 0},
+    {"q100", 320, 240, 2, 2, 0, 0, 100, 0},
+    {"odd12", 211, 99, 1, 2, 0, 3, 95, 0},
+    {"odd420", 203, 157, 2, 2, 0, 7, 60, 0},
+    {"prog", 320, 240, 2, 2, 0, 0, 85, 1},
+};
+
+static unsigned char clamp(double value)
+{
+    return (unsigned char) ((value < 0) ? 0 : ((value > 255) ? 255 : value));
+}
+
+static void write_reference(const char *directory, int f, unsigned char *p_jpeg, unsigned long size, unsigned char *p_row);
+
+static void make_fixture(const char *directory, int f)
+{
+    int width = fixtures[f].width;
+    int height = fixtures[f].height;
+    unsigned char *p_rgb = malloc((size_t) width * height * 3);
+    unsigned char *p_jpeg = NULL;
+    unsigned long size = 0;
+    char path[512];
+    FILE *p_file;
+
+    srand((unsigned) (width * 7 + height + fixtures[f].h * 3 + fixtures[f].v + fixtures[f].is_gray * 11 + fixtures[f].restart_interval));
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            double red = 128 + 100 * sin(x * 0.05) + 20 * ((rand() % 100) / 100.0 - 0.5);
+            double green = 128 + 100 * cos(y * 0.04 + x * 0.01);
+            double blue = ((x / 20 + y / 20) & 1) ? 230 : 30;
+            double dx = x - width / 2.0;
+            double dy = y - height / 2.0;
+            if (dx * dx + dy * dy < (height / 4.0) * (height / 4.0))
+            {
+                red = 250;
+                green = 40;
+                blue = 40;
+            }
+            unsigned char *p_pixel = p_rgb + (y * width + x) * 3;
+            p_pixel[0] = clamp(red);
+            p_pixel[1] = clamp(green);
+            p_pixel[2] = (unsigned char) blue;
+        }
+    }
+
+    struct jpeg_error_mgr error;
+    struct jpeg_compress_struct compress;
+    compress.err = jpeg_std_error(&error);
+    jpeg_create_compress(&compress);
+    jpeg_mem_dest(&compress, &p_jpeg, &size);
+    compress.image_width = (JDIMENSION) width;
+    compress.image_height = (JDIMENSION) height;
+    compress.input_components = 3;
+    compress.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&compress);
+    jpeg_set_quality(&compress, fixtures[f].quality, TRUE);
+    if (fixtures[f].is_gray)
+    {
+        jpeg_set_colorspace(&compress, JCS_GRAYSCALE);
+    }
+    else
+    {
+        compress.comp_info[0].h_samp_factor = fixtures[f].h;
+        compress.comp_info[0].v_samp_factor = fixtures[f].v;
+    }
+    compress.restart_interval = (unsigned) fixtures[f].restart_interval;
+    if (fixtures[f].is_progressive)
+    {
+        jpeg_simple_progression(&compress);
+    }
+    jpeg_start_compress(&compress, TRUE);
+    while (compress.next_scanline < compress.image_height)
+    {
+        JSAMPROW row = p_rgb + compress.next_scanline * width * 3;
+        jpeg_write_scanlines(&compress, &row, 1);
+    }
+    jpeg_finish_compress(&compress);
+    jpeg_destroy_compress(&compress);
+    snprintf(path, sizeof(path), "%s/%s.jpg", directory, fixtures[f].name);
+    p_file = fopen(path, "wb");
+    fwrite(p_jpeg, 1, size, p_file);
+    fclose(p_file);
+    printf("%s: %dx%d, %lu bytes\n", fixtures[f].name, width, height, size);
+
+    if (!fixtures[f].is_progressive)
+    {
+        write_reference(directory, f, p_jpeg, size, p_rgb);
+    }
+    free(p_jpeg);
+    free(p_rgb);
+}
+
+/**@brief   Decodes the given JPEG image with libjpeg into "<name>.565", using \p p_row to hold each decoded row.
+ */
+static void write_reference(const char *directory, int f, unsigned char *p_jpeg, unsigned long size, unsigned char *p_row)
+{
+    struct jpeg_error_mgr error;
+    struct jpeg_decompress_struct decompress;
+    char path[512];
+    FILE *p_file;
+    decompress.err = jpeg_std_error(&error);
+    jpeg_create_decompress(&decompress);
+    jpeg_mem_src(&decompress, p_jpeg, size);
+    jpeg_read_header(&decompress, TRUE);
+    decompress.out_color_space = JCS_RGB;
+    decompress.dct_method = JDCT_ISLOW;
+    decompress.do_fancy_upsampling = FALSE;
+    jpeg_start_decompress(&decompress);
+    snprintf(path, sizeof(path), "%s/%s.565", directory, fixtures[f].name);
+    p_file = fopen(path, "wb");
+    while (decompress.output_scanline < decompress.output_height)
+    {
+        JSAMPROW row = p_row;
+        jpeg_read_scanlines(&decompress, &row, 1);
+        for (int x = 0; x < fixtures[f].width; x++)
+        {
+            unsigned pixel = ((p_row[x * 3] & 0xF8U) << 8) | ((p_row[x * 3 + 1] & 0xFCU) << 3) | (p_row[x * 3 + 2] >> 3);
+            fputc((int) (pixel & 0xFF), p_file);
+            fputc((int) (pixel >> 8), p_file);
+        }
+    }
+    fclose(p_file);
+    jpeg_finish_decompress(&decompress);
+    jpeg_destroy_decompress(&decompress);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: make_jpegs <output directory>\n");
+        return 1;
+    }
+    for (int f = 0; f < (int) (sizeof(fixtures) / sizeof(fixtures[0])); f++)
+    {
+        make_fixture(argv[1], f);
+    }
+    return 0;
+}
@@ -0,0 +1,414 @@
+/** @addtogroup ili9341_panel_model
+ * @{
+ */
+
+#include "ili9341_panel_model.h"
+#include <string.h> // This library contains the functions: memcpy and memset.
+
+#define PANEL_MADCTL_MY         (0x80)  /**< @brief Row Address Order bit of the Memory Access Control register. */
+#define PANEL_MADCTL_MX         (0x40)  /**< @brief Column Address Order bit of the Memory Access Control register. */
+#define PANEL_MADCTL_MV         (0x20)  /**< @brief Row/Column Exchange bit of the Memory Access Control register. */
+#define PANEL_IFCTL_WEMODE      (0x01)  /**< @brief Memory Write Control bit of the first Interface Control register, which wraps the pixels that exceed the Address Window back to its start. */
+
+/**@brief   Applies the Hardware Reset values to the registers of the virtual ILI9341 Device, which leaves its Frame
+ *          Memory untouched.
+ */
+static void panel_reset_registers(ili9341_panel_model_t *p_panel)
+{
+    p_panel->madctl = 0x00;
+    p_panel->colmod = 0x66;
+    p_panel->ifctl[0] = 0x01;
+    p_panel->ifctl[1] = 0x00;
+    p_panel->ifctl[2] = 0x00;
+    p_panel->sc = 0;
+    p_panel->ec = ILI9341_PANEL_COLUMNS - 1;
+    p_panel->sp = 0;
+    p_panel->ep = ILI9341_PANEL_PAGES - 1;
+    p_panel->column = 0;
+    p_panel->page = 0;
+    p_panel->tfa = 0;
+    p_panel->vsa = ILI9341_PANEL_PAGES;
+    p_panel->bfa = 0;
+    p_panel->vsp = 0;
+    p_panel->is_scrolling = 0;
+    p_panel->is_overflowed = 0;
+    p_panel->command = -1;
+    p_panel->param_index = 0;
+    p_panel->pixel_byte_index = 0;
+}
+
+/**@brief   Maps the column and page of the current Memory Access Control into a physical position of the Frame
+ *          Memory.
+ *
+ * @return  1 if the position lies inside of the Frame Memory or 0 otherwise.
+ */
+static int panel_map(const ili9341_panel_model_t *p_panel, int x, int y, int *p_column, int *p_page)
+{
+    int column = x;
+    int page = y;
+    if (p_panel->madctl & PANEL_MADCTL_MV)
+    {
+        column = y;
+        page = x;
+    }
+    if ((column < 0) || (column >= ILI9341_PANEL_COLUMNS) || (page < 0) || (page >= ILI9341_PANEL_PAGES))
+    {
+        return 0;
+    }
+    if (p_panel->madctl & PANEL_MADCTL_MX)
+    {
+        column = ILI9341_PANEL_COLUMNS - 1 - column;
+    }
+    if (p_panel->madctl & PANEL_MADCTL_MY)
+    {
+        page = ILI9341_PANEL_PAGES - 1 - page;
+    }
+    *p_column = column;
+    *p_page = page;
+    return 1;
+}
+
+/**@brief   Expands a 5 bit Red or Blue component into 6 bits according to the EPF field of the Interface Control.
+ */
+static uint32_t panel_expand_5_to_6(const ili9341_panel_model_t *p_panel, uint32_t value, uint32_t green)
+{
+    switch ((p_panel->ifctl[1] >> 4) & 0x03)
+    {
+        case 0:
+            return (value << 1) | (value >> 4);
+        case 1:
+            return value << 1;
+        case 2:
+            return (value << 1) | 1U;
+        default:
+            return (value << 1) | (green & 1U);
+    }
+}
+
+/**@brief   Writes a pixel at the address counter and advances it within the Address Window.
+ */
+static void panel_write_pixel(ili9341_panel_model_t *p_panel, uint32_t rgb666)
+{
+    ili9341_panel_trace_entry_t *p_entry = (p_panel->trace_count > 0) ? &p_panel->trace[p_panel->trace_count - 1] : NULL;
+    if ((p_entry != NULL) && (p_panel->trace_dropped == 0))
+    {
+        p_entry->pixels++;
+    }
+    if ((p_panel->sc > p_panel->ec) || (p_panel->sp > p_panel->ep))
+    {
+        p_panel->stats.outside_pixels++;
+        return;
+    }
+    if (p_panel->sp + p_panel->page > p_panel->ep)
+    {
+        p_panel->is_overflowed = 1;
+        if (!(p_panel->ifctl[0] & PANEL_IFCTL_WEMODE))
+        {
+            p_panel->stats.overflow_pixels++;
+            return;
+        }
+        p_panel->column = 0;
+        p_panel->page = 0;
+    }
+    if (p_panel->is_overflowed)
+    {
+        p_panel->stats.overflow_pixels++;
+    }
+    int column;
+    int page;
+    if (panel_map(p_panel, p_panel->sc + p_panel->column, p_panel->sp + p_panel->page, &column, &page))
+    {
+        p_panel->gram[page][column] = rgb666;
+        p_panel->stats.pixels++;
+    }
+    else
+    {
+        p_panel->stats.outside_pixels++;
+    }
+    if (p_panel->sc + ++p_panel->column > p_panel->ec)
+    {
+        p_panel->column = 0;
+        p_panel->page++;
+    }
+}
+
+/**@brief   Decodes a Command byte.
+ */
+static void panel_command(ili9341_panel_model_t *p_panel, uint8_t command)
+{
+    p_panel->stats.command_bytes++;
+    p_panel->stats.commands[command]++;
+    p_panel->command = command;
+    p_panel->param_index = 0;
+    p_panel->pixel_byte_index = 0;
+    if (p_panel->trace_count < ILI9341_PANEL_TRACE_LENGTH)
+    {
+        ili9341_panel_trace_entry_t *p_entry = &p_panel->trace[p_panel->trace_count++];
+        memset(p_entry, 0, sizeof(*p_entry));
+        p_entry->command = command;
+    }
+    else
+    {
+        p_panel->trace_dropped++;
+    }
+    switch (command)
+    {
+        case 0x01:
+            panel_reset_registers(p_panel);
+            break;
+        case 0x2C:
+            p_panel->column = 0;
+            p_panel->page = 0;
+            p_panel->is_overflowed = 0;
+            break;
+        default:
+            break;
+    }
+}
+
+/**@brief   Decodes a pixel byte of a Memory Write or Memory Write Continue.
+ */
+static void panel_pixel_byte(ili9341_panel_model_t *p_panel, uint8_t data)
+{
+    uint8_t bytes_per_pixel = ((p_panel->colmod & 0x07) == 0x05) ? 2 : 3;
+    p_panel->pixel_bytes[p_panel->pixel_byte_index++] = data;
+    if (p_panel->pixel_byte_index < bytes_per_pixel)
+    {
+        return;
+    }
+    p_panel->pixel_byte_index = 0;
+    uint32_t rgb666;
+    if (bytes_per_pixel == 2)
+    {
+        uint32_t rgb565 = ((uint32_t) p_panel->pixel_bytes[0] << 8) | p_panel->pixel_bytes[1];
+        uint32_t green = (rgb565 >> 5) & 0x3F;
+        rgb666 = (panel_expand_5_to_6(p_panel, rgb565 >> 11, green) << 12) | (green << 6)
+                 | panel_expand_5_to_6(p_panel, rgb565 & 0x1F, green);
+    }
+    else
+    {
+        rgb666 = ((uint32_t) (p_panel->pixel_bytes[0] >> 2) << 12) | ((uint32_t) (p_panel->pixel_bytes[1] >> 2) << 6)
+                 | (uint32_t) (p_panel->pixel_bytes[2] >> 2);
+    }
+    panel_write_pixel(p_panel, rgb666);
+}
+
+/**@brief   Decodes a Data byte.
+ */
+static void panel_data(ili9341_panel_model_t *p_panel, uint8_t data)
+{
+    if ((p_panel->command == 0x2C) || (p_panel->command == 0x3C))
+    {
+        panel_pixel_byte(p_panel, data);
+        return;
+    }
+    uint32_t index = p_panel->param_index++;
+    if (index < sizeof(p_panel->params))
+    {
+        p_panel->params[index] = data;
+    }
+    if ((p_panel->trace_count > 0) && (p_panel->trace_dropped == 0))
+    {
+        ili9341_panel_trace_entry_t *p_entry = &p_panel->trace[p_panel->trace_count - 1];
+        if (index < ILI9341_PANEL_TRACE_PARAMS)
+        {
+            p_entry->params[index] = data;
+        }
+        p_entry->param_bytes++;
+    }
+    const uint8_t *p = p_panel->params;
+    switch (p_panel->command)
+    {
+        case 0x2A:
+            if (index == 3)
+            {
+                p_panel->sc = (uint16_t) (p[0] << 8 | p[1]);
+                p_panel->ec = (uint16_t) (p[2] << 8 | p[3]);
+            }
+            break;
+        case 0x2B:
+            if (index == 3)
+            {
+                p_panel->sp = (uint16_t) (p[0] << 8 | p[1]);
+                p_panel->ep = (uint16_t) (p[2] << 8 | p[3]);
+            }
+            break;
+        case 0x33:
+            if (index == 5)
+            {
+                p_panel->tfa = (uint16_t) (p[0] << 8 | p[1]);
+                p_panel->vsa = (uint16_t) (p[2] << 8 | p[3]);
+                p_panel->bfa = (uint16_t) (p[4] << 8 | p[5]);
+            }
+            break;
+        case 0x36:
+            if (index == 0)
+            {
+                p_panel->madctl = data;
+            }
+            break;
+        case 0x37:
+            if (index == 1)
+            {
+                p_panel->vsp = (uint16_t) (p[0] << 8 | p[1]);
+                p_panel->is_scrolling = 1;
+            }
+            break;
+        case 0x3A:
+            if (index == 0)
+            {
+                p_panel->colmod = data;
+            }
+            break;
+        case 0xF6:
+            if (index < 3)
+            {
+                p_panel->ifctl[index] = data;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/**@brief   Tells whether a pin is low in the given snapshot of the GPIO ports of the @ref stm32_host_hal .
+ */
+static int panel_is_pin_low(const uint32_t *p_odr, const GPIO_TypeDef *p_port, uint16_t pin)
+{
+    return (p_odr[p_port - host_gpio] & pin) == 0;
+}
+
+/**@brief   Receives a DMA transfer of the @ref stm32_host_hal .
+ */
+static void panel_on_transfer(void *p_context, const host_spi_transfer_t *p_transfer)
+{
+    ili9341_panel_model_t *p_panel = (ili9341_panel_model_t *) p_context;
+    if (!panel_is_pin_low(p_transfer->odr, p_panel->pins.p_cs_port, p_panel->pins.cs_pin))
+    {
+        return;
+    }
+    if (!p_panel->is_cs_low)
+    {
+        p_panel->is_cs_low = 1;
+        p_panel->stats.cs_sessions++;
+    }
+    p_panel->stats.transfers++;
+    int is_command = panel_is_pin_low(p_transfer->odr, p_panel->pins.p_dc_port, p_panel->pins.dc_pin);
+    uint32_t bytes = p_transfer->is_16bit ? 2U * p_transfer->frames : p_transfer->frames;
+    p_panel->stats.bytes += bytes;
+    for (uint32_t i = 0; i < bytes; i++)
+    {
+        uint8_t byte;
+        if (p_transfer->is_16bit)
+        {
+            uint16_t frame = ((const uint16_t *) p_transfer->p_data)[i / 2];
+            byte = (i & 1U) ? (uint8_t) frame : (uint8_t) (frame >> 8);
+        }
+        else
+        {
+            byte = p_transfer->p_data[i];
+        }
+        if (is_command)
+        {
+            panel_command(p_panel, byte);
+        }
+        else
+        {
+            panel_data(p_panel, byte);
+        }
+    }
+}
+
+/**@brief   Receives a change of the pins of a GPIO port of the @ref stm32_host_hal .
+ */
+static void panel_on_gpio(void *p_context, const GPIO_TypeDef *p_port, uint32_t odr)
+{
+    ili9341_panel_model_t *p_panel = (ili9341_panel_model_t *) p_context;
+    if (p_port == p_panel->pins.p_cs_port)
+    {
+        uint8_t is_cs_low = (odr & p_panel->pins.cs_pin) == 0;
+        if (is_cs_low && !p_panel->is_cs_low)
+        {
+            p_panel->stats.cs_sessions++;
+        }
+        if (!is_cs_low)
+        {
+            p_panel->pixel_byte_index = 0;
+        }
+        p_panel->is_cs_low = is_cs_low;
+    }
+    if ((p_port == p_panel->pins.p_reset_port) && ((odr & p_panel->pins.reset_pin) == 0))
+    {
+        panel_reset_registers(p_panel);
+    }
+}
+
+int ili9341_panel_model_init(ili9341_panel_model_t *p_panel, const ili9341_panel_pins_t *p_pins)
+{
+    memset(p_panel, 0, sizeof(*p_panel));
+    p_panel->pins = *p_pins;
+    panel_reset_registers(p_panel);
+    p_panel->sink.p_context = p_panel;
+    p_panel->sink.p_on_transfer = panel_on_transfer;
+    p_panel->sink.p_on_gpio = panel_on_gpio;
+    return host_hal_attach_sink(&p_panel->sink);
+}
+
+void ili9341_panel_model_reset_stats(ili9341_panel_model_t *p_panel)
+{
+    memset(&p_panel->stats, 0, sizeof(p_panel->stats));
+    p_panel->trace_count = 0;
+    p_panel->trace_dropped = 0;
+}
+
+void ili9341_panel_model_fill_gram(ili9341_panel_model_t *p_panel, uint32_t rgb666)
+{
+    for (int page = 0; page < ILI9341_PANEL_PAGES; page++)
+    {
+        for (int column = 0; column < ILI9341_PANEL_COLUMNS; column++)
+        {
+            p_panel->gram[page][column] = rgb666;
+        }
+    }
+}
+
+uint32_t ili9341_panel_model_get_pixel(const ili9341_panel_model_t *p_panel, int x, int y)
+{
+    int column;
+    int page;
+    if (!panel_map(p_panel, x, y, &column, &page))
+    {
+        return 0xFFFFFFFFU;
+    }
+    return p_panel->gram[page][column];
+}
+
+uint16_t ili9341_panel_model_get_pixel_565(const ili9341_panel_model_t *p_panel, int x, int y)
+{
+    uint32_t rgb666 = ili9341_panel_model_get_pixel(p_panel, x, y);
+    if (rgb666 == 0xFFFFFFFFU)
+    {
+        return 0;
+    }
+    return (uint16_t) ((((rgb666 >> 13) & 0x1F) << 11) | (((rgb666 >> 6) & 0x3F) << 5) | ((rgb666 >> 1) & 0x1F));
+}
+
+uint32_t ili9341_panel_model_get_display_pixel(const ili9341_panel_model_t *p_panel, int column, int line)
+{
+    if ((column < 0) || (column >= ILI9341_PANEL_COLUMNS) || (line < 0) || (line >= ILI9341_PANEL_PAGES))
+    {
+        return 0xFFFFFFFFU;
+    }
+    int page = line;
+    if (p_panel->is_scrolling && (p_panel->vsa > 0) && (line >= p_panel->tfa) && (line < p_panel->tfa + p_panel->vsa))
+    {
+        page = p_panel->tfa + (line - p_panel->tfa + p_panel->vsp - p_panel->tfa + p_panel->vsa) % p_panel->vsa;
+    }
+    if (page >= ILI9341_PANEL_PAGES)
+    {
+        return 0xFFFFFFFFU;
+    }
+    return p_panel->gram[page][column];
+}
+
+/** @} */
@@ -0,0 +1,160 @@
+/**@file
+ * @brief	Virtual ILI9341 Device Header file for the host tests of the @ref ili9341 .
+ *
+ * @defgroup ili9341_panel_model Virtual ILI9341 Device module
+ * @{
+ *
+ * @brief   This module decodes the Commands and Data that the @ref ili9341 sends through the @ref stm32_host_hal into
+ *          the 240x320 Frame Memory of a virtual ILI9341 Device, while counting what was sent to it.
+ *
+ * @details The following Commands are decoded as described in the ILI9341 datasheet, while any other Command is only
+ *          counted and recorded in the trace:
+ *          - Software Reset (0x01).
+ *          - Column Address Set (0x2A) and Page Address Set (0x2B).
+ *          - Memory Write (0x2C) and Memory Write Continue (0x3C), in 16 and 18 bits per pixel.
+ *          - Vertical Scrolling Definition (0x33) and Vertical Scrolling Start Address (0x37).
+ *          - Memory Access Control (0x36), whose MY, MX and MV bits map the Address Window onto the Frame Memory.
+ *          - Pixel Format Set (0x3A).
+ *          - Interface Control (0xF6), whose WEMODE and EPF fields are honoured. Its ENDIAN bit is only recorded since
+ *            the ILI9341 Device does not honour it through its serial interface.
+ *          Pulling its RESET pin low applies a Hardware Reset to the virtual ILI9341 Device.
+ */
+
+#ifndef ILI9341_PANEL_MODEL_H_
+#define ILI9341_PANEL_MODEL_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "stm32_host_hal.h"
+
+#define ILI9341_PANEL_COLUMNS           (240)   /**< @brief Number of columns of the Frame Memory of the virtual ILI9341 Device. */
+#define ILI9341_PANEL_PAGES             (320)   /**< @brief Number of pages (i.e., rows) of the Frame Memory of the virtual ILI9341 Device. */
+#define ILI9341_PANEL_TRACE_LENGTH      (4096)  /**< @brief Maximum number of Commands that the trace of the virtual ILI9341 Device can record. */
+#define ILI9341_PANEL_TRACE_PARAMS      (4)     /**< @brief Number of parameter bytes of each Command that are recorded in the trace. */
+
+/**@brief	Pins of the MCU to which a virtual ILI9341 Device is connected.
+ */
+typedef struct
+{
+    GPIO_TypeDef *p_cs_port;        //!< Port of the CS pin.
+    uint16_t cs_pin;                //!< Bit mask of the CS pin.
+    GPIO_TypeDef *p_dc_port;        //!< Port of the D/C pin.
+    uint16_t dc_pin;                //!< Bit mask of the D/C pin.
+    GPIO_TypeDef *p_reset_port;     //!< Port of the RESET pin.
+    uint16_t reset_pin;             //!< Bit mask of the RESET pin.
+} ili9341_panel_pins_t;
+
+/**@brief	Counters of what a virtual ILI9341 Device has received.
+ */
+typedef struct
+{
+    uint64_t bytes;                 //!< Number of bytes received, including Commands.
+    uint64_t command_bytes;         //!< Number of Commands received.
+    uint64_t pixels;                //!< Number of pixels written into the Frame Memory.
+    uint64_t overflow_pixels;       //!< Number of pixels received after the last one of the Address Window.
+    uint64_t outside_pixels;        //!< Number of pixels whose address lies outside of the Frame Memory.
+    uint64_t transfers;             //!< Number of DMA transfers received while the CS pin was low.
+    uint64_t cs_sessions;           //!< Number of times that the CS pin was pulled low.
+    uint32_t commands[256];         //!< Number of times that each Command was received.
+} ili9341_panel_stats_t;
+
+/**@brief	Command recorded in the trace of a virtual ILI9341 Device.
+ */
+typedef struct
+{
+    uint8_t command;                            //!< Command byte.
+    uint8_t params[ILI9341_PANEL_TRACE_PARAMS]; //!< First parameter bytes of the Command.
+    uint32_t param_bytes;                       //!< Number of parameter bytes received for the Command, excluding pixels.
+    uint32_t pixels;                            //!< Number of pixels received for the Command.
+} ili9341_panel_trace_entry_t;
+
+/**@brief	Virtual ILI9341 Device.
+ *
+ * @details The Frame Memory holds each pixel as an 18 bit value with the 6 bits of Red in bits 12 up to 17, the 6
+ *          bits of Green in bits 6 up to 11 and the 6 bits of Blue in bits 0 up to 5, and is addressed by its physical
+ *          page and column (i.e., as if MY = MX = MV = 0).
+ */
+typedef struct
+{
+    ili9341_panel_pins_t pins;                                          //!< Pins to which the virtual ILI9341 Device is connected.
+    host_spi_sink_t sink;                                               //!< Receiver attached to the @ref stm32_host_hal .
+    uint32_t gram[ILI9341_PANEL_PAGES][ILI9341_PANEL_COLUMNS];          //!< Frame Memory.
+    uint8_t madctl;                                                     //!< Memory Access Control register.
+    uint8_t colmod;                                                     //!< Pixel Format Set register.
+    uint8_t ifctl[3];                                                   //!< Interface Control registers.
+    uint16_t sc, ec, sp, ep;                                            //!< Start and end column and page of the Address Window.
+    uint16_t column, page;                                              //!< Address counter, relative to the Address Window.
+    uint8_t is_overflowed;                                              //!< Whether more pixels than the ones of the Address Window were received since the last Memory Write.
+    uint16_t tfa, vsa, bfa, vsp;                                        //!< Vertical Scrolling Definition and Start Address.
+    uint8_t is_scrolling;                                               //!< Whether a Vertical Scrolling Start Address was received since the last reset.
+    uint8_t is_cs_low;                                                  //!< Last level seen for the CS pin.
+    int command;                                                        //!< Last Command received, or -1.
+    uint32_t param_index;                                               //!< Number of parameter bytes received for @ref command .
+    uint8_t params[8];                                                  //!< Parameter bytes received for @ref command .
+    uint8_t pixel_bytes[3];                                             //!< Bytes received so far of the current pixel.
+    uint8_t pixel_byte_index;                                           //!< Number of bytes in @ref pixel_bytes .
+    ili9341_panel_stats_t stats;                                        //!< Counters of what was received.
+    ili9341_panel_trace_entry_t trace[ILI9341_PANEL_TRACE_LENGTH];      //!< Commands received, in order.
+    uint32_t trace_count;                                               //!< Number of Commands in @ref trace .
+    uint32_t trace_dropped;                                             //!< Number of Commands that did not fit into @ref trace .
+} ili9341_panel_model_t;
+
+/**@brief   Initializes a virtual ILI9341 Device in its Hardware Reset state and attaches it to the SPI bus of the
+ *          @ref stm32_host_hal .
+ *
+ * @param[out] p_panel  Pointer to the virtual ILI9341 Device.
+ * @param[in] p_pins    Pointer to the pins to which it is connected, each of which must be on its own port.
+ *
+ * @retval  0 if it was initialized.
+ * @retval  -1 if it could not be attached to the SPI bus.
+ */
+int ili9341_panel_model_init(ili9341_panel_model_t *p_panel, const ili9341_panel_pins_t *p_pins);
+
+/**@brief   Clears the counters and the trace of a virtual ILI9341 Device.
+ *
+ * @param[in,out] p_panel   Pointer to the virtual ILI9341 Device.
+ */
+void ili9341_panel_model_reset_stats(ili9341_panel_model_t *p_panel);
+
+/**@brief   Fills the whole Frame Memory of a virtual ILI9341 Device without going through the SPI bus.
+ *
+ * @param[in,out] p_panel   Pointer to the virtual ILI9341 Device.
+ * @param rgb666            18 bit value with which the Frame Memory will be filled.
+ */
+void ili9341_panel_model_fill_gram(ili9341_panel_model_t *p_panel, uint32_t rgb666);
+
+/**@brief   Gets a pixel of the Frame Memory by the column and page with which the @ref ili9341 addresses it under the
+ *          current Memory Access Control.
+ *
+ * @param[in] p_panel   Pointer to the virtual ILI9341 Device.
+ * @param x             Column of the pixel.
+ * @param y             Page (i.e., row) of the pixel.
+ *
+ * @return  18 bit value of the pixel, or 0xFFFFFFFF if it lies outside of the Frame Memory.
+ */
+uint32_t ili9341_panel_model_get_pixel(const ili9341_panel_model_t *p_panel, int x, int y);
+
+/**@brief   Gets a pixel of the Frame Memory, addressed just like in @ref ili9341_panel_model_get_pixel , converted
+ *          into the 16 bits per pixel Bit Color Order by dropping the Least Significant Bit of Red and Blue.
+ *
+ * @param[in] p_panel   Pointer to the virtual ILI9341 Device.
+ * @param x             Column of the pixel.
+ * @param y             Page (i.e., row) of the pixel.
+ *
+ * @return  16 bit value of the pixel, or 0 if it lies outside of the Frame Memory.
+ */
+uint16_t ili9341_panel_model_get_pixel_565(const ili9341_panel_model_t *p_panel, int x, int y);
+
+/**@brief   Gets the pixel shown at the given physical position of the Display, which only differs from the physical
+ *          position of the Frame Memory while vertical scrolling is in use.
+ *
+ * @param[in] p_panel   Pointer to the virtual ILI9341 Device.
+ * @param column        Physical column of the Display.
+ * @param line          Physical line of the Display.
+ *
+ * @return  18 bit value of the pixel, or 0xFFFFFFFF if it lies outside of the Display.
+ */
+uint32_t ili9341_panel_model_get_display_pixel(const ili9341_panel_model_t *p_panel, int column, int line);
+
+#endif /* ILI9341_PANEL_MODEL_H_ */
+
+/** @} */
@@ -0,0 +1,148 @@
+/** @addtogroup ili9341_test
+ * @{
+ */
+
+#include "ili9341_test.h"
+
+#define TEST_CS_PIN             (0x0010)    /**< @brief CS pin of every ILI9341 Device, each on the port given by @ref test_cs_port . */
+#define TEST_DC_PIN             (0x0020)    /**< @brief D/C pin shared by all the ILI9341 Devices. */
+#define TEST_RESET_PIN          (0x0040)    /**< @brief RESET pin of every ILI9341 Device, each on the port given by @ref test_reset_port . */
+#define TEST_MAX_REPORTED       (8)         /**< @brief Maximum number of different pixels printed by @ref test_compare_frame_565 . */
+
+ILI9341_handle_t test_lcd[TEST_DEVICE_COUNT];
+ili9341_panel_model_t test_panel[TEST_DEVICE_COUNT];
+ILI9341_peripherals_def_t test_peripherals[TEST_DEVICE_COUNT];
+
+static int test_device_count;
+static unsigned long test_checks;
+static unsigned long test_failures;
+
+static GPIO_TypeDef *test_cs_port(int device)
+{
+    return &host_gpio[device * 2];
+}
+
+static GPIO_TypeDef *test_reset_port(int device)
+{
+    return &host_gpio[device * 2 + 1];
+}
+
+static GPIO_TypeDef *test_dc_port(void)
+{
+    return &host_gpio[HOST_GPIO_PORT_COUNT - 1];
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    ili9341_spi_tx_cplt_callback(hspi);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    ili9341_spi_error_callback(hspi);
+}
+
+void test_check(int is_passed, const char *condition, const char *file, int line)
+{
+    test_checks++;
+    if (!is_passed)
+    {
+        test_failures++;
+        printf("%s:%d: check failed: %s\n", file, line, condition);
+    }
+}
+
+void test_check_eq(long long actual, long long expected, const char *expression, const char *file, int line)
+{
+    test_checks++;
+    if (actual != expected)
+    {
+        test_failures++;
+        printf("%s:%d: check failed: %s is %lld, expected %lld\n", file, line, expression, actual, expected);
+    }
+}
+
+void test_begin(const host_hal_config_t *p_config, int devices)
+{
+    host_hal_start(p_config);
+    test_device_count = devices;
+    for (int i = 0; i < devices; i++)
+    {
+        ili9341_panel_pins_t pins = {test_cs_port(i), TEST_CS_PIN, test_dc_port(), TEST_DC_PIN, test_reset_port(i), TEST_RESET_PIN};
+        TEST_CHECK_EQ(ili9341_panel_model_init(&test_panel[i], &pins), 0);
+        test_peripherals[i].CS.GPIO_Port = test_cs_port(i);
+        test_peripherals[i].CS.GPIO_Pin = TEST_CS_PIN;
+        test_peripherals[i].RESET.GPIO_Port = test_reset_port(i);
+        test_peripherals[i].RESET.GPIO_Pin = TEST_RESET_PIN;
+        test_peripherals[i].DC.GPIO_Port = test_dc_port();
+        test_peripherals[i].DC.GPIO_Pin = TEST_DC_PIN;
+    }
+    for (int i = 0; i < devices; i++)
+    {
+        TEST_CHECK_EQ(init_ili9341_module(&test_lcd[i], &host_hspi, &test_peripherals[i]), ILI9341_EC_OK);
+    }
+    test_sync(&test_lcd[0]);
+}
+
+int test_end(const char *name)
+{
+    for (int i = 0; i < test_device_count; i++)
+    {
+        TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[i]), ILI9341_EC_OK);
+    }
+    host_hal_stop();
+    printf("%s: %lu checks, %lu failed\n", name, test_checks, test_failures);
+    return (test_failures == 0) ? 0 : 1;
+}
+
+void test_sync(ILI9341_handle_t *p_handle)
+{
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_handle), ILI9341_EC_OK);
+    host_hal_reset_stats();
+    for (int i = 0; i < test_device_count; i++)
+    {
+        ili9341_panel_model_reset_stats(&test_panel[i]);
+    }
+}
+
+uint32_t test_compare_frame_565(const ili9341_panel_model_t *p_panel, const uint16_t *p_expected)
+{
+    uint32_t mismatches = 0;
+    for (int y = 0; y < ILI9341_SCREEN_HEIGHT; y++)
+    {
+        for (int x = 0; x < ILI9341_SCREEN_WIDTH; x++)
+        {
+            uint16_t expected = p_expected[y * ILI9341_SCREEN_WIDTH + x];
+            uint16_t actual = ili9341_panel_model_get_pixel_565(p_panel, x, y);
+            if (actual != expected)
+            {
+                if (mismatches < TEST_MAX_REPORTED)
+                {
+                    printf("  pixel (%d, %d) is 0x%04X, expected 0x%04X\n", x, y, actual, expected);
+                }
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+uint32_t test_rgb565_to_rgb666(uint16_t rgb565)
+{
+    uint32_t red = rgb565 >> 11;
+    uint32_t green = (rgb565 >> 5) & 0x3F;
+    uint32_t blue = rgb565 & 0x1F;
+    return (((red << 1) | (red >> 4)) << 12) | (green << 6) | ((blue << 1) | (blue >> 4));
+}
+
+uint32_t test_bpp18_to_rgb666(uint32_t bpp_18)
+{
+    return (((bpp_18 >> 18) & 0x3F) << 12) | (((bpp_18 >> 10) & 0x3F) << 6) | ((bpp_18 >> 2) & 0x3F);
+}
+
+uint16_t test_argb_to_rgb565(uint32_t argb)
+{
+    return (uint16_t) ((((argb >> 19) & 0x1F) << 11) | (((argb >> 10) & 0x3F) << 5) | ((argb >> 3) & 0x1F));
+}
+
+/** @} */
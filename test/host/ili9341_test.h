@@ -0,0 +1,117 @@
+/**@file
+ * @brief	Common fixture and checks of the host tests and benchmarks of the @ref ili9341 .
+ *
+ * @defgroup ili9341_test ILI9341 host test support module
+ * @{
+ *
+ * @brief   This module starts the @ref stm32_host_hal , connects a @ref ili9341_panel_model_t to it and initializes an
+ *          ILI9341 Device Handle for it, so that each test only has to draw and then compare the Frame Memory of the
+ *          virtual ILI9341 Device against what it expects.
+ */
+
+#ifndef ILI9341_TEST_H_
+#define ILI9341_TEST_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stdio.h> // This library contains the function: printf.
+#include "ili9341_tft_lcd_driver.h"
+#include "ili9341_panel_model.h"
+
+#define TEST_DEVICE_COUNT       (2)     /**< @brief Number of ILI9341 Devices that share the SPI bus of the @ref stm32_host_hal in the tests. */
+
+/**@brief   Checks a condition and counts it as a failure, without stopping the test, whenever it does not hold.
+ */
+#define TEST_CHECK(condition) test_check((condition) ? 1 : 0, #condition, __FILE__, __LINE__)
+
+/**@brief   Checks that two integer values are equal and counts it as a failure, without stopping the test, whenever
+ *          they are not.
+ */
+#define TEST_CHECK_EQ(actual, expected) test_check_eq((long long) (actual), (long long) (expected), #actual, __FILE__, __LINE__)
+
+/**@brief	Source image of the host tests of the image formats of the @ref ili9341 .
+ *
+ * @details This contains the very pixels from which "fixtures/make_images.py" wrote a PNG or PPM image, so that what
+ *          "tools/ili9341_image_encoder.py" makes out of that image can be checked against them.
+ */
+typedef struct
+{
+    uint16_t width;             //!< Number of columns of the image.
+    uint16_t height;            //!< Number of rows of the image.
+    const uint32_t *p_argb;     //!< Pointer to the pixels of the image, row by row, as 0xAARRGGBB.
+} test_source_image_t;
+
+extern ILI9341_handle_t test_lcd[TEST_DEVICE_COUNT];                 /**< @brief ILI9341 Device Handles of the ILI9341 Devices of the tests. */
+extern ili9341_panel_model_t test_panel[TEST_DEVICE_COUNT];          /**< @brief Virtual ILI9341 Devices to which @ref test_lcd are connected. */
+extern ILI9341_peripherals_def_t test_peripherals[TEST_DEVICE_COUNT]; /**< @brief Pins to which @ref test_panel are connected. */
+
+/**@brief   Starts the @ref stm32_host_hal and initializes the given number of ILI9341 Devices, which share the SPI bus
+ *          and the D/C pin but each have their own CS and RESET pins.
+ *
+ * @details The statistics of the @ref stm32_host_hal and of the virtual ILI9341 Devices are reset once the
+ *          initialization has been sent.
+ *
+ * @param[in] p_config  Pointer to the configuration of the SPI bus, or NULL for the default one of
+ *                      @ref host_hal_start .
+ * @param devices       Number of ILI9341 Devices, from 1 up to @ref TEST_DEVICE_COUNT .
+ */
+void test_begin(const host_hal_config_t *p_config, int devices);
+
+/**@brief   Stops the @ref stm32_host_hal and reports the result of the test.
+ *
+ * @param[in] name  Name of the test.
+ *
+ * @return  0 if all the checks passed or 1 otherwise, so that it can be returned from \c main .
+ */
+int test_end(const char *name);
+
+/**@brief   Waits for the given ILI9341 Device to be idle, checks that no error was reported and resets the statistics
+ *          of the @ref stm32_host_hal and of all the virtual ILI9341 Devices.
+ *
+ * @param[in] p_handle  Pointer to the ILI9341 Device Handle.
+ */
+void test_sync(ILI9341_handle_t *p_handle);
+
+/**@brief   Counts the pixels of a virtual ILI9341 Device that differ from the given frame.
+ *
+ * @param[in] p_panel       Pointer to the virtual ILI9341 Device.
+ * @param[in] p_expected    Pointer to the 240x320 pixels expected, row by row, in the 16 bits per pixel Bit Color
+ *                          Order.
+ *
+ * @return  Number of different pixels, of which the first few are printed.
+ */
+uint32_t test_compare_frame_565(const ili9341_panel_model_t *p_panel, const uint16_t *p_expected);
+
+/**@brief   Converts a 16 bits per pixel color into the 18 bit value with which the ILI9341 Device stores it with the
+ *          default @ref ILI9341_EPF_MSB_COPY expansion.
+ *
+ * @param rgb565    Color in the 16 bits per pixel Bit Color Order.
+ *
+ * @return  18 bit value of the color (see @ref ili9341_panel_model_t ).
+ */
+uint32_t test_rgb565_to_rgb666(uint16_t rgb565);
+
+/**@brief   Converts a color in the 18 bits per pixel Bit Color Order (see @ref ILI9341_COLOR::bpp_18 ) into the 18 bit
+ *          value with which the ILI9341 Device stores it.
+ *
+ * @param bpp_18    Color in the 18 bits per pixel Bit Color Order.
+ *
+ * @return  18 bit value of the color (see @ref ili9341_panel_model_t ).
+ */
+uint32_t test_bpp18_to_rgb666(uint32_t bpp_18);
+
+/**@brief   Converts a 0xAARRGGBB pixel of a @ref test_source_image_t into the 16 bits per pixel Bit Color Order, by
+ *          keeping the most significant bits of each channel.
+ *
+ * @param argb  Pixel of a @ref test_source_image_t .
+ *
+ * @return  Color in the 16 bits per pixel Bit Color Order.
+ */
+uint16_t test_argb_to_rgb565(uint32_t argb);
+
+/* Used through the TEST_CHECK and TEST_CHECK_EQ macros. */
+void test_check(int is_passed, const char *condition, const char *file, int line);
+void test_check_eq(long long actual, long long expected, const char *expression, const char *file, int line);
+
+#endif /* ILI9341_TEST_H_ */
+
+/** @} */
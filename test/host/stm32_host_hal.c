@@ -0,0 +1,324 @@
+/** @addtogroup stm32_host_hal
+ * @{
+ */
+
+#define _GNU_SOURCE
+#include "stm32_host_hal.h"
+#include <pthread.h> // This library contains the threads, mutexes and condition variables of the host computer.
+#include <string.h> // This library contains the functions: memcpy and memset.
+#include <time.h> // This library contains the functions: clock_gettime and clock_nanosleep.
+
+#define HOST_DEFAULT_SPI_CLOCK_HZ       (36000000U)     /**< @brief SPI clock used whenever @ref host_hal_start is given no configuration, which is the fastest one of the SPI1 of a 72 MHz STM32F1. */
+#define HOST_DEFAULT_OVERHEAD_NS        (2000U)         /**< @brief Modeled time that the DMA and its interrupt add to each transfer whenever @ref host_hal_start is given no configuration. */
+
+GPIO_TypeDef host_gpio[HOST_GPIO_PORT_COUNT];
+static SPI_TypeDef host_spi_regs;
+static DMA_Channel_TypeDef host_dma_regs;
+static DMA_HandleTypeDef host_hdma = {&host_dma_regs, {0}};
+SPI_HandleTypeDef host_hspi = {&host_spi_regs, {0}, &host_hdma};
+
+static host_hal_config_t config;
+static host_hal_stats_t stats;
+static const host_spi_sink_t *p_sinks[HOST_SPI_SINK_COUNT];
+static int sink_count;
+
+static pthread_t isr_thread;
+static pthread_mutex_t irq_mutex = PTHREAD_MUTEX_INITIALIZER;       // Held by whoever has the interrupts disabled, including the interrupt thread while it runs a callback.
+static pthread_mutex_t state_mutex = PTHREAD_MUTEX_INITIALIZER;     // Protects the pending transfer and the statistics.
+static pthread_mutex_t gpio_mutex = PTHREAD_MUTEX_INITIALIZER;      // Serializes the latching of the GPIO ports between both threads.
+static pthread_cond_t state_cond = PTHREAD_COND_INITIALIZER;
+static _Thread_local uint32_t primask;
+static _Thread_local uint8_t is_isr_context;
+
+static uint8_t is_pending;
+static uint8_t is_stopping;
+static host_spi_transfer_t pending;
+static uint64_t pending_start_ns;
+static uint32_t error_skip;
+static uint32_t error_count;
+
+uint64_t host_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+uint64_t host_thread_cpu_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/**@brief   Latches the pending writes of the BSRR and BRR registers of every GPIO port into their ODR register and
+ *          notifies the attached receivers about the ports that changed.
+ *
+ * @note    The set half of BSRR takes priority over its reset half, just like in the STM32 GPIO peripheral.
+ */
+static void host_gpio_latch(void)
+{
+    pthread_mutex_lock(&gpio_mutex);
+    for (int i = 0; i < HOST_GPIO_PORT_COUNT; i++)
+    {
+        GPIO_TypeDef *p_port = &host_gpio[i];
+        uint32_t bsrr = p_port->BSRR;
+        uint32_t brr = p_port->BRR;
+        if ((bsrr | brr) == 0)
+        {
+            continue;
+        }
+        uint32_t odr = p_port->ODR;
+        odr &= ~((bsrr >> 16) | brr);
+        odr |= bsrr & 0xFFFFU;
+        p_port->BSRR = 0;
+        p_port->BRR = 0;
+        if (odr != p_port->ODR)
+        {
+            p_port->ODR = odr;
+            for (int s = 0; s < sink_count; s++)
+            {
+                if (p_sinks[s]->p_on_gpio != NULL)
+                {
+                    p_sinks[s]->p_on_gpio(p_sinks[s]->p_context, p_port, odr);
+                }
+            }
+        }
+    }
+    pthread_mutex_unlock(&gpio_mutex);
+}
+
+int host_gpio_read(GPIO_TypeDef *p_port, uint16_t pin)
+{
+    host_gpio_latch();
+    return (p_port->ODR & pin) ? 1 : 0;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    host_gpio_latch();
+    GPIOx->BSRR = (PinState == GPIO_PIN_SET) ? GPIO_Pin : ((uint32_t) GPIO_Pin << 16);
+    host_gpio_latch();
+    stats.gpio_writes++;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    stats.delay_ms += Delay;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+    (void) hdma;
+    return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    (void) hspi;
+}
+
+__attribute__((weak)) void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    (void) hspi;
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    return is_isr_context ? 1 : primask;
+}
+
+void __disable_irq(void)
+{
+    __set_PRIMASK(1);
+}
+
+void __enable_irq(void)
+{
+    __set_PRIMASK(0);
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+    if (is_isr_context)
+    {
+        return; // The interrupt thread already holds the irq_mutex for as long as it runs a callback.
+    }
+    if ((priMask != 0) && (primask == 0))
+    {
+        pthread_mutex_lock(&irq_mutex);
+    }
+    else if ((priMask == 0) && (primask != 0))
+    {
+        pthread_mutex_unlock(&irq_mutex);
+    }
+    primask = priMask;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+    if ((pData == NULL) || (Size == 0))
+    {
+        return HAL_ERROR;
+    }
+    host_gpio_latch();
+    pthread_mutex_lock(&state_mutex);
+    if (is_pending)
+    {
+        stats.busy_starts++;
+        pthread_mutex_unlock(&state_mutex);
+        return HAL_BUSY;
+    }
+    pending.p_data = pData;
+    pending.frames = Size;
+    pending.is_16bit = (hspi->Instance->CR1 & SPI_CR1_DFF) ? 1 : 0;
+    for (int i = 0; i < HOST_GPIO_PORT_COUNT; i++)
+    {
+        pending.odr[i] = host_gpio[i].ODR;
+    }
+    pending_start_ns = host_time_ns();
+    is_pending = 1;
+    pthread_cond_signal(&state_cond);
+    pthread_mutex_unlock(&state_mutex);
+    return HAL_OK;
+}
+
+/**@brief   Thread that stands for the DMA interrupt of the MCU, which completes the pending transfer.
+ */
+static void *host_isr_thread(void *p_arg)
+{
+    (void) p_arg;
+    is_isr_context = 1;
+    for (;;)
+    {
+        pthread_mutex_lock(&state_mutex);
+        while (!is_pending && !is_stopping)
+        {
+            pthread_cond_wait(&state_cond, &state_mutex);
+        }
+        if (!is_pending)
+        {
+            pthread_mutex_unlock(&state_mutex);
+            break;
+        }
+        host_spi_transfer_t transfer = pending;
+        uint64_t start_ns = pending_start_ns;
+        pthread_mutex_unlock(&state_mutex);
+
+        uint64_t bits = (uint64_t) transfer.frames * (transfer.is_16bit ? 16U : 8U);
+        uint64_t time_ns = bits * 1000000000ULL / config.spi_clock_hz + config.transfer_overhead_ns;
+        if (config.is_paced)
+        {
+            uint64_t end_ns = start_ns + time_ns;
+            struct timespec ts = {(time_t) (end_ns / 1000000000ULL), (long) (end_ns % 1000000000ULL)};
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0);
+        }
+
+        pthread_mutex_lock(&irq_mutex);
+        uint8_t is_error = 0;
+        if (error_skip > 0)
+        {
+            error_skip--;
+        }
+        else if (error_count > 0)
+        {
+            error_count--;
+            is_error = 1;
+        }
+        if (!is_error)
+        {
+            for (int s = 0; s < sink_count; s++)
+            {
+                p_sinks[s]->p_on_transfer(p_sinks[s]->p_context, &transfer);
+            }
+        }
+        pthread_mutex_lock(&state_mutex);
+        stats.transfers++;
+        stats.frames += transfer.frames;
+        stats.bytes += transfer.is_16bit ? 2U * transfer.frames : transfer.frames;
+        stats.bus_time_ns += time_ns;
+        is_pending = 0;
+        pthread_mutex_unlock(&state_mutex);
+        if (is_error)
+        {
+            HAL_SPI_ErrorCallback(&host_hspi);
+        }
+        else
+        {
+            HAL_SPI_TxCpltCallback(&host_hspi);
+        }
+        host_gpio_latch();
+        pthread_mutex_unlock(&irq_mutex);
+    }
+    return NULL;
+}
+
+void host_hal_start(const host_hal_config_t *p_config)
+{
+    if (p_config != NULL)
+    {
+        config = *p_config;
+    }
+    else
+    {
+        config.spi_clock_hz = HOST_DEFAULT_SPI_CLOCK_HZ;
+        config.transfer_overhead_ns = HOST_DEFAULT_OVERHEAD_NS;
+        config.is_paced = 0;
+    }
+    for (int i = 0; i < HOST_GPIO_PORT_COUNT; i++)
+    {
+        memset((void *) &host_gpio[i], 0, sizeof(host_gpio[i]));
+        host_gpio[i].ODR = 0xFFFFU;
+    }
+    memset((void *) &host_spi_regs, 0, sizeof(host_spi_regs));
+    memset(&stats, 0, sizeof(stats));
+    sink_count = 0;
+    is_pending = 0;
+    is_stopping = 0;
+    error_skip = 0;
+    error_count = 0;
+    pthread_create(&isr_thread, NULL, host_isr_thread, NULL);
+}
+
+void host_hal_stop(void)
+{
+    pthread_mutex_lock(&state_mutex);
+    is_stopping = 1;
+    pthread_cond_signal(&state_cond);
+    pthread_mutex_unlock(&state_mutex);
+    pthread_join(isr_thread, NULL);
+}
+
+int host_hal_attach_sink(const host_spi_sink_t *p_sink)
+{
+    if (sink_count >= HOST_SPI_SINK_COUNT)
+    {
+        return -1;
+    }
+    p_sinks[sink_count++] = p_sink;
+    return 0;
+}
+
+void host_hal_inject_dma_errors(uint32_t skip, uint32_t count)
+{
+    pthread_mutex_lock(&irq_mutex);
+    error_skip = skip;
+    error_count = count;
+    pthread_mutex_unlock(&irq_mutex);
+}
+
+void host_hal_get_stats(host_hal_stats_t *p_stats)
+{
+    pthread_mutex_lock(&state_mutex);
+    *p_stats = stats;
+    pthread_mutex_unlock(&state_mutex);
+}
+
+void host_hal_reset_stats(void)
+{
+    pthread_mutex_lock(&state_mutex);
+    memset(&stats, 0, sizeof(stats));
+    pthread_mutex_unlock(&state_mutex);
+}
+
+/** @} */
@@ -0,0 +1,236 @@
+/**@file
+ * @brief	Host-side stand-in of the STM32 HAL Driver Library Header file.
+ *
+ * @defgroup stm32_host_hal STM32 HAL host stand-in module
+ * @{
+ *
+ * @brief   This module provides just the types, registers, functions and intrinsics of the STM32 HAL Driver Library
+ *          that the @ref ili9341 requires, so that it can be built and exercised on a host computer by defining
+ *          \c ILI9341_HAL_HEADER as \c "stm32_host_hal.h" from the compiler flags.
+ *
+ * @details Each call to \c HAL_SPI_Transmit_DMA is held as a pending DMA transfer, together with the levels that the
+ *          GPIO pins had when it was started, until a separate thread (which stands for the interrupt context of the
+ *          MCU) completes it. That thread hands the transfer over to the attached @ref host_spi_sink_t (e.g., a
+ *          virtual ILI9341 Device) and then calls \c HAL_SPI_TxCpltCallback or \c HAL_SPI_ErrorCallback just like the
+ *          DMA interrupt of the MCU would. Whenever @ref host_hal_config_t::is_paced is set, the transfers take as
+ *          much real time as they would take on the SPI bus, so that the CPU time returned to the caller can be
+ *          measured.
+ *
+ * @note    The GPIO pins written through their BSRR register are latched into their ODR register whenever the
+ *          @ref stm32_host_hal samples them (i.e., on every HAL call and after every completed transfer), which is
+ *          enough for the CS and D/C pins because a transfer is always started right after toggling them. Since only
+ *          the last write into a BSRR register is latched, each of those pins must be given its own port.
+ */
+
+#ifndef STM32_HOST_HAL_H_
+#define STM32_HOST_HAL_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stddef.h> // This library contains the definition of NULL.
+
+#define HOST_GPIO_PORT_COUNT        (8)         /**< @brief Number of GPIO ports that the @ref stm32_host_hal provides in @ref host_gpio . */
+#define HOST_SPI_SINK_COUNT         (4)         /**< @brief Maximum number of @ref host_spi_sink_t that can be attached to the SPI bus at the same time. */
+
+typedef enum
+{
+    HAL_OK       = 0x00U,
+    HAL_ERROR    = 0x01U,
+    HAL_BUSY     = 0x02U,
+    HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct
+{
+    volatile uint32_t CRL;
+    volatile uint32_t CRH;
+    volatile uint32_t IDR;
+    volatile uint32_t ODR;
+    volatile uint32_t BSRR;
+    volatile uint32_t BRR;
+    volatile uint32_t LCKR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t CR1;
+    volatile uint32_t CR2;
+    volatile uint32_t SR;
+    volatile uint32_t DR;
+} SPI_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t CCR;
+    volatile uint32_t CNDTR;
+    volatile uint32_t CPAR;
+    volatile uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+    uint32_t Direction;
+    uint32_t PeriphInc;
+    uint32_t MemInc;
+    uint32_t PeriphDataAlignment;
+    uint32_t MemDataAlignment;
+    uint32_t Mode;
+    uint32_t Priority;
+} DMA_InitTypeDef;
+
+typedef struct
+{
+    DMA_Channel_TypeDef *Instance;
+    DMA_InitTypeDef Init;
+} DMA_HandleTypeDef;
+
+typedef struct
+{
+    uint32_t Mode;
+    uint32_t Direction;
+    uint32_t DataSize;
+} SPI_InitTypeDef;
+
+typedef struct __SPI_HandleTypeDef
+{
+    SPI_TypeDef *Instance;
+    SPI_InitTypeDef Init;
+    DMA_HandleTypeDef *hdmatx;
+} SPI_HandleTypeDef;
+
+#define SPI_CR1_SPE                 (1U << 6)
+#define SPI_CR1_DFF                 (1U << 11)
+#define SPI_DATASIZE_8BIT           (0U)
+#define SPI_DATASIZE_16BIT          SPI_CR1_DFF
+#define DMA_PDATAALIGN_BYTE         (0U)
+#define DMA_PDATAALIGN_HALFWORD     (1U << 8)
+#define DMA_MDATAALIGN_BYTE         (0U)
+#define DMA_MDATAALIGN_HALFWORD     (1U << 10)
+
+#define __HAL_SPI_DISABLE(__HANDLE__)                   CLEAR_BIT((__HANDLE__)->Instance->CR1, SPI_CR1_SPE)
+#define SET_BIT(REG, BIT)                               ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)                             ((REG) &= ~(BIT))
+#define MODIFY_REG(REG, CLEARMASK, SETMASK)             ((REG) = (((REG) & (~(CLEARMASK))) | (SETMASK)))
+
+/**@brief	SPI Transfer given to a @ref host_spi_sink_t structure.
+ */
+typedef struct
+{
+    const uint8_t *p_data;                  //!< Pointer to the frames that were sent.
+    uint32_t frames;                        //!< Number of frames that were sent.
+    uint8_t is_16bit;                       //!< Whether the SPI peripheral was in 16 bit data frames (1), where each frame is shifted out Most Significant Byte first, or in 8 bit data frames (0).
+    uint32_t odr[HOST_GPIO_PORT_COUNT];     //!< Levels of the pins of every port of @ref host_gpio when the transfer was started.
+} host_spi_transfer_t;
+
+/**@brief	Receiver of the SPI Transfers and of the changes of the GPIO pins of the @ref stm32_host_hal .
+ */
+typedef struct
+{
+    void *p_context;                                                        //!< Pointer given back to both of the callbacks.
+    void (*p_on_transfer)(void *p_context, const host_spi_transfer_t *p_transfer);  //!< Called from the interrupt thread for every completed transfer.
+    void (*p_on_gpio)(void *p_context, const GPIO_TypeDef *p_port, uint32_t odr);   //!< Called whenever the ODR register of a port changes, or NULL.
+} host_spi_sink_t;
+
+/**@brief	Configuration of the SPI bus of the @ref stm32_host_hal .
+ */
+typedef struct
+{
+    uint32_t spi_clock_hz;                  //!< Clock of the SPI bus, which sets the modeled time of each transfer.
+    uint32_t transfer_overhead_ns;          //!< Modeled time that the DMA and its interrupt add to each transfer.
+    uint8_t is_paced;                       //!< Whether each transfer takes its modeled time in real time (1) or completes right away (0).
+} host_hal_config_t;
+
+/**@brief	Statistics of the SPI bus of the @ref stm32_host_hal .
+ */
+typedef struct
+{
+    uint64_t transfers;                     //!< Number of completed DMA transfers.
+    uint64_t frames;                        //!< Number of frames sent by those transfers.
+    uint64_t bytes;                         //!< Number of bytes sent by those transfers.
+    uint64_t bus_time_ns;                   //!< Modeled time that those transfers took on the SPI bus.
+    uint64_t busy_starts;                   //!< Number of calls to \c HAL_SPI_Transmit_DMA while a transfer was still pending.
+    uint64_t gpio_writes;                   //!< Number of calls to \c HAL_GPIO_WritePin .
+    uint64_t delay_ms;                      //!< Sum of the milliseconds requested to \c HAL_Delay .
+} host_hal_stats_t;
+
+extern GPIO_TypeDef host_gpio[HOST_GPIO_PORT_COUNT];   /**< @brief GPIO ports of the @ref stm32_host_hal . */
+extern SPI_HandleTypeDef host_hspi;                     /**< @brief SPI peripheral of the @ref stm32_host_hal . */
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_Delay(uint32_t Delay);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+uint32_t __get_PRIMASK(void);
+void __disable_irq(void);
+void __enable_irq(void);
+void __set_PRIMASK(uint32_t priMask);
+
+/**@brief   Starts the interrupt thread of the @ref stm32_host_hal with the given configuration and resets all of its
+ *          GPIO pins to High State.
+ *
+ * @param[in] p_config  Pointer to the configuration of the SPI bus, or NULL for a 36 MHz bus that is not paced.
+ */
+void host_hal_start(const host_hal_config_t *p_config);
+
+/**@brief   Waits for the pending transfer to complete and stops the interrupt thread of the @ref stm32_host_hal .
+ */
+void host_hal_stop(void);
+
+/**@brief   Attaches the given receiver to the SPI bus of the @ref stm32_host_hal .
+ *
+ * @param[in] p_sink    Pointer to the receiver, which must remain valid until @ref host_hal_stop is called.
+ *
+ * @retval  0 if it was attached.
+ * @retval  -1 if there are already @ref HOST_SPI_SINK_COUNT receivers attached.
+ */
+int host_hal_attach_sink(const host_spi_sink_t *p_sink);
+
+/**@brief   Makes the given number of upcoming DMA transfers complete with an error instead of being sent, after
+ *          skipping the given number of transfers.
+ *
+ * @param skip      Number of transfers to be sent normally before the first failing one.
+ * @param count     Number of consecutive transfers that will fail.
+ */
+void host_hal_inject_dma_errors(uint32_t skip, uint32_t count);
+
+/**@brief   Gets the statistics of the SPI bus of the @ref stm32_host_hal .
+ *
+ * @param[out] p_stats  Pointer into which the statistics will be copied.
+ */
+void host_hal_get_stats(host_hal_stats_t *p_stats);
+
+/**@brief   Resets the statistics of the SPI bus of the @ref stm32_host_hal .
+ */
+void host_hal_reset_stats(void);
+
+/**@brief   Gets the level of a GPIO pin after latching the pending writes of its BSRR register.
+ *
+ * @param[in] p_port    Pointer to the GPIO port of the pin.
+ * @param pin           Bit mask of the pin.
+ *
+ * @return  1 if the pin is in High State or 0 if it is in Low State.
+ */
+int host_gpio_read(GPIO_TypeDef *p_port, uint16_t pin);
+
+/**@brief   Gets the monotonic time of the host computer.
+ *
+ * @return  Time in nanoseconds.
+ */
+uint64_t host_time_ns(void);
+
+/**@brief   Gets the CPU time consumed by the calling thread.
+ *
+ * @return  Time in nanoseconds.
+ */
+uint64_t host_thread_cpu_time_ns(void);
+
+#endif /* STM32_HOST_HAL_H_ */
+
+/** @} */
@@ -0,0 +1,142 @@
+/**@file
+ * @brief	Checks @ref ili9341_blit and @ref ili9341_set_clip_rect against a per-pixel reference, and that the bitmap
+ *          is sent by DMA straight out of the memory of the caller.
+ *
+ * @details Random bitmaps, with strides equal to and greater than their widths, are drawn partly outside of the screen
+ *          and of random Clip Rectangles. Every pixel of the screen must then hold either the pixel of the bitmap that
+ *          covers it or the background, and every pixel of the bitmap must have been sent by a DMA transfer that reads
+ *          it in place: as a single segment when the visible rows lie back to back in memory, or as one segment per
+ *          visible row otherwise.
+ */
+
+#include "ili9341_test.h"
+#include <stdlib.h> // This library contains the functions: rand and srand.
+
+#define BITMAP_STRIDE       (100)   /**< @brief Largest stride, in pixels, of the bitmaps of this test. */
+#define BITMAP_ROWS         (80)    /**< @brief Number of rows held by @ref bitmap at its largest stride. */
+#define BLIT_ROUNDS         (120)   /**< @brief Number of random bitmaps that are checked. */
+
+static uint16_t bitmap[BITMAP_STRIDE * BITMAP_ROWS];
+
+/**@brief   DMA transfers that read @ref bitmap in place, as counted by @ref on_transfer .
+ */
+static struct
+{
+    uint32_t segments;  //!< Number of transfers whose data lies within @ref bitmap .
+    uint32_t bytes;     //!< Number of bytes sent by those transfers.
+} in_place;
+
+static void on_transfer(void *p_context, const host_spi_transfer_t *p_transfer)
+{
+    const uint8_t *p_start = (const uint8_t *) bitmap;
+    uint32_t bytes = p_transfer->frames * (p_transfer->is_16bit ? 2U : 1U);
+    (void) p_context;
+    if ((p_transfer->p_data >= p_start) && (p_transfer->p_data + bytes <= p_start + sizeof(bitmap)))
+    {
+        in_place.segments++;
+        in_place.bytes += bytes;
+    }
+}
+
+static const host_spi_sink_t in_place_sink = {NULL, on_transfer, NULL};
+
+static int max(int a, int b)
+{
+    return (a > b) ? a : b;
+}
+
+static int min(int a, int b)
+{
+    return (a < b) ? a : b;
+}
+
+int main(void)
+{
+    ILI9341_handle_t *p_lcd = &test_lcd[0];
+    test_begin(NULL, 1);
+    TEST_CHECK_EQ(host_hal_attach_sink(&in_place_sink), 0);
+    srand(1);
+    for (int i = 0; i < BITMAP_STRIDE * BITMAP_ROWS; i++)
+    {
+        bitmap[i] = (uint16_t) (rand() | 1);
+    }
+
+    for (int round = 0; round < BLIT_ROUNDS; round++)
+    {
+        /* The expected Clip Rectangle, as {x0, y0, x1, y1} with x1 and y1 exclusive. */
+        int clip[4] = {0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT};
+        ili9341_reset_clip_rect(p_lcd);
+        if (round % 3 == 0)
+        {
+            int cx = rand() % 200 - 20;
+            int cy = rand() % 280 - 20;
+            int cw = 1 + rand() % 200;
+            int ch = 1 + rand() % 300;
+            TEST_CHECK_EQ(ili9341_set_clip_rect(p_lcd, (int16_t) cx, (int16_t) cy, (uint16_t) cw, (uint16_t) ch), ILI9341_EC_OK);
+            clip[0] = max(cx, 0);
+            clip[1] = max(cy, 0);
+            clip[2] = min(cx + cw, ILI9341_SCREEN_WIDTH);
+            clip[3] = min(cy + ch, ILI9341_SCREEN_HEIGHT);
+        }
+        int x = rand() % 300 - 60;
+        int y = rand() % 380 - 60;
+        int width = 1 + rand() % BITMAP_STRIDE;
+        int stride = (round & 4) ? (width + rand() % (BITMAP_STRIDE - width + 1)) : width;
+        int height = 1 + rand() % BITMAP_ROWS;
+        height = min(height, (BITMAP_STRIDE * BITMAP_ROWS - width) / stride + 1);
+
+        test_sync(p_lcd);
+        ili9341_panel_model_fill_gram(&test_panel[0], 0);
+        in_place.segments = 0;
+        in_place.bytes = 0;
+        ILI9341_Status ret = ili9341_blit(p_lcd, (int16_t) x, (int16_t) y, (uint16_t) width, (uint16_t) height, bitmap, (uint16_t) stride);
+        TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+
+        int left = max(x, clip[0]);
+        int top = max(y, clip[1]);
+        int right = min(x + width, clip[2]);
+        int bottom = min(y + height, clip[3]);
+        uint32_t visible = ((right > left) && (bottom > top)) ? (uint32_t) ((right - left) * (bottom - top)) : 0;
+        uint32_t mismatches = 0;
+        for (int py = 0; py < ILI9341_SCREEN_HEIGHT; py++)
+        {
+            for (int px = 0; px < ILI9341_SCREEN_WIDTH; px++)
+            {
+                int is_visible = (px >= left) && (px < right) && (py >= top) && (py < bottom);
+                uint16_t expected = is_visible ? bitmap[(py - y) * stride + (px - x)] : 0;
+                mismatches += ili9341_panel_model_get_pixel_565(&test_panel[0], (uint16_t) px, (uint16_t) py) != expected;
+            }
+        }
+        TEST_CHECK_EQ(mismatches, 0);
+        TEST_CHECK_EQ(test_panel[0].stats.pixels, visible);
+        TEST_CHECK_EQ(test_panel[0].stats.overflow_pixels, 0);
+        TEST_CHECK_EQ(ret, (visible > 0) ? ILI9341_EC_OK : ILI9341_EC_NA);
+
+        /* Zero-copy: every pixel was read by the DMA straight out of the bitmap. */
+        TEST_CHECK_EQ(in_place.bytes, 2 * visible);
+        if (visible > 0)
+        {
+            int is_contiguous = (left == x) && (right == x + width) && (stride == width);
+            TEST_CHECK_EQ(in_place.segments, is_contiguous ? 1U : (uint32_t) (bottom - top));
+        }
+    }
+    ili9341_reset_clip_rect(p_lcd);
+
+    /* A Clip Rectangle outside of the screen is rejected and leaves the previous one unchanged. */
+    TEST_CHECK_EQ(ili9341_set_clip_rect(p_lcd, 10, 10, 20, 20), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_set_clip_rect(p_lcd, 300, 10, 20, 20), ILI9341_EC_NA);
+    TEST_CHECK_EQ(ili9341_set_clip_rect(p_lcd, 10, 10, 0, 20), ILI9341_EC_NA);
+    TEST_CHECK_EQ(p_lcd->clip_rect.x0, 10);
+    TEST_CHECK_EQ(p_lcd->clip_rect.y1, 29);
+    TEST_CHECK_EQ(ili9341_blit(p_lcd, 40, 40, 10, 10, bitmap, 10), ILI9341_EC_NA);
+    ili9341_reset_clip_rect(p_lcd);
+    TEST_CHECK_EQ(p_lcd->clip_rect.x1, ILI9341_SCREEN_WIDTH - 1);
+    TEST_CHECK_EQ(p_lcd->clip_rect.y1, ILI9341_SCREEN_HEIGHT - 1);
+
+    TEST_CHECK_EQ(ili9341_blit(p_lcd, 0, 0, 10, 10, NULL, 10), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_blit(p_lcd, 0, 0, 10, 10, bitmap, 5), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(set_ili9341_bpp_type(p_lcd, ILI9341_BPP_18), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_blit(p_lcd, 0, 0, 10, 10, bitmap, 10), ILI9341_EC_NA);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    return test_end("test_blit");
+}
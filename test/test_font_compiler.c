@@ -0,0 +1,194 @@
+/**@file
+ * @brief	Checks that the fonts written by "tools/ili9341_font_compiler.py" with plain and with Run-Length Encoded
+ *          (RLE) bitmaps draw the very same pixels through @ref ili9341_draw_string , and that their kerning pairs
+ *          are kept sorted by character code.
+ *
+ * @details The fonts are compiled from the BDF font of "fixtures/fonts", which keeps a sparse set of characters
+ *          (i.e., listed through @ref ILI9341_font_t::p_characters ), and from the TrueType font of
+ *          "fixtures/make_fonts.py" in 1, 2 and 4 bits per pixel, whose "kern" table is sorted by glyph index rather
+ *          than by character code. Both encodings of each font must have the same metrics, and each string is drawn
+ *          with both of them over a known background, partly outside of the screen and of a Clip Rectangle, in 16 and
+ *          in 18 bits per pixel, where the whole screen must then be the same. The kerning pairs must be strictly
+ *          sorted by their left and then right characters, without zero adjustments, and must be applied to the
+ *          width of the strings.
+ */
+
+#include "ili9341_fonts.h"
+#include "ili9341_test.h"
+#include <string.h> // This library contains the functions: memcmp.
+
+#define SCREEN_COLOR    (0x1234)    /**< @brief Color that fills the screen before each string is drawn. */
+
+extern const ILI9341_font_t test_bdf_plain, test_bdf_rle;
+extern const ILI9341_font_t kern_ttf_1_plain, kern_ttf_1_rle, kern_ttf_2_plain, kern_ttf_2_rle, kern_ttf_4_plain, kern_ttf_4_rle;
+
+/**@brief   Gets the glyph of a character of the given font, or NULL if the font does not have it.
+ */
+static const ILI9341_glyph_t *find_glyph(const ILI9341_font_t *p_font, uint8_t character)
+{
+    if (p_font->p_characters == NULL)
+    {
+        return ((character >= p_font->first) && (character <= p_font->last)) ? &p_font->p_glyphs[character - p_font->first] : NULL;
+    }
+    for (uint16_t i = 0; i < p_font->glyph_count; i++)
+    {
+        if (p_font->p_characters[i] == character)
+        {
+            return &p_font->p_glyphs[i];
+        }
+    }
+    return NULL;
+}
+
+/**@brief   Checks that both encodings of a font have the same metrics and that their kerning pairs are sorted.
+ */
+static void check_metrics(const ILI9341_font_t *p_plain, const ILI9341_font_t *p_rle, const char *p_characters)
+{
+    TEST_CHECK_EQ(p_plain->is_rle, 0);
+    TEST_CHECK_EQ(p_rle->is_rle, 1);
+    TEST_CHECK_EQ(p_rle->first, p_plain->first);
+    TEST_CHECK_EQ(p_rle->last, p_plain->last);
+    TEST_CHECK_EQ(p_rle->ascent, p_plain->ascent);
+    TEST_CHECK_EQ(p_rle->descent, p_plain->descent);
+    TEST_CHECK_EQ(p_rle->bpp, p_plain->bpp);
+    TEST_CHECK_EQ(p_rle->glyph_count, p_plain->glyph_count);
+    TEST_CHECK_EQ(p_rle->kerning_pair_count, p_plain->kerning_pair_count);
+    for (const char *p = p_characters; *p != '\0'; p++)
+    {
+        const ILI9341_glyph_t *p_plain_glyph = find_glyph(p_plain, (uint8_t) *p);
+        const ILI9341_glyph_t *p_rle_glyph = find_glyph(p_rle, (uint8_t) *p);
+        TEST_CHECK(p_plain_glyph != NULL);
+        TEST_CHECK(p_rle_glyph != NULL);
+        if ((p_plain_glyph != NULL) && (p_rle_glyph != NULL))
+        {
+            TEST_CHECK_EQ(p_rle_glyph->width, p_plain_glyph->width);
+            TEST_CHECK_EQ(p_rle_glyph->height, p_plain_glyph->height);
+            TEST_CHECK_EQ(p_rle_glyph->x_advance, p_plain_glyph->x_advance);
+            TEST_CHECK_EQ(p_rle_glyph->x_offset, p_plain_glyph->x_offset);
+            TEST_CHECK_EQ(p_rle_glyph->y_offset, p_plain_glyph->y_offset);
+        }
+    }
+    for (uint16_t i = 0; i < p_plain->kerning_pair_count; i++)
+    {
+        const ILI9341_kerning_pair_t *p_pair = &p_plain->p_kerning_pairs[i];
+        TEST_CHECK(p_pair->adjustment != 0);
+        TEST_CHECK(find_glyph(p_plain, p_pair->left) != NULL);
+        TEST_CHECK(find_glyph(p_plain, p_pair->right) != NULL);
+        TEST_CHECK_EQ(memcmp(p_pair, &p_rle->p_kerning_pairs[i], sizeof(*p_pair)), 0);
+        if (i > 0)
+        {
+            const ILI9341_kerning_pair_t *p_previous = &p_plain->p_kerning_pairs[i - 1];
+            TEST_CHECK((p_previous->left < p_pair->left) || ((p_previous->left == p_pair->left) && (p_previous->right < p_pair->right)));
+        }
+        /* The adjustment goes between the advances of the two characters. */
+        char string[3] = {(char) p_pair->left, (char) p_pair->right, '\0'};
+        TEST_CHECK_EQ(ili9341_get_string_width(p_plain, string),
+                      find_glyph(p_plain, p_pair->left)->x_advance + find_glyph(p_plain, p_pair->right)->x_advance + p_pair->adjustment);
+    }
+}
+
+/**@brief   Draws a string with a font over the screen color and returns the status with which it was drawn, copying the
+ *          whole screen into \p p_screen .
+ */
+static ILI9341_Status draw(const ILI9341_font_t *p_font, const char *p_string, int x, int y, uint32_t *p_screen)
+{
+    ILI9341_COLOR ink;
+    ILI9341_COLOR background;
+    if (get_ili9341_bpp_type(&test_lcd[0]) == ILI9341_BPP_16)
+    {
+        ink.bpp_16 = 0xFFE0;
+        background.bpp_16 = 0x0010;
+    }
+    else
+    {
+        ink.bpp_18 = 0xFC8C30U;
+        background.bpp_18 = 0x0404FCU;
+    }
+    test_sync(&test_lcd[0]);
+    ili9341_panel_model_fill_gram(&test_panel[0], test_rgb565_to_rgb666(SCREEN_COLOR));
+    ILI9341_Status ret = ili9341_draw_string(&test_lcd[0], (int16_t) x, (int16_t) y, p_font, p_string, ink, background);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    for (int py = 0; py < ILI9341_SCREEN_HEIGHT; py++)
+    {
+        for (int px = 0; px < ILI9341_SCREEN_WIDTH; px++)
+        {
+            p_screen[py * ILI9341_SCREEN_WIDTH + px] = ili9341_panel_model_get_pixel(&test_panel[0], px, py);
+        }
+    }
+    return ret;
+}
+
+/**@brief   Draws a string with both encodings of a font and compares the whole screen after each of them.
+ */
+static void check_string(const ILI9341_font_t *p_plain, const ILI9341_font_t *p_rle, const char *p_string, int x, int y)
+{
+    static uint32_t plain_screen[ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT];
+    static uint32_t rle_screen[ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT];
+    uint32_t mismatches = 0;
+    uint32_t changed = 0;
+
+    ILI9341_Status plain_ret = draw(p_plain, p_string, x, y, plain_screen);
+    uint32_t plain_pixels = test_panel[0].stats.pixels;
+    TEST_CHECK_EQ(draw(p_rle, p_string, x, y, rle_screen), plain_ret);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, plain_pixels);
+    for (uint32_t i = 0; i < ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT; i++)
+    {
+        changed += plain_screen[i] != test_rgb565_to_rgb666(SCREEN_COLOR);
+        if (rle_screen[i] != plain_screen[i])
+        {
+            if (mismatches < 4)
+            {
+                printf("  \"%s\" at (%d, %d): pixel (%u, %u) is 0x%05X with RLE, 0x%05X plain\n", p_string, x, y, (unsigned) (i % ILI9341_SCREEN_WIDTH),
+                       (unsigned) (i / ILI9341_SCREEN_WIDTH), (unsigned) rle_screen[i], (unsigned) plain_screen[i]);
+            }
+            mismatches++;
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+    TEST_CHECK_EQ(changed, plain_pixels);
+}
+
+int main(void)
+{
+    const ILI9341_font_t *plain_fonts[4] = {&test_bdf_plain, &kern_ttf_1_plain, &kern_ttf_2_plain, &kern_ttf_4_plain};
+    const ILI9341_font_t *rle_fonts[4] = {&test_bdf_rle, &kern_ttf_1_rle, &kern_ttf_2_rle, &kern_ttf_4_rle};
+    const char *characters[4] = {"AB g\xC9", "AVTo. ", "AVTo. ", "AVTo. "};
+    const char *strings[4][3] = {{"AB g\xC9", "gABBA g", "\xC9g"},
+                                 {"AVATo. T.", "ToVo", "A V"},
+                                 {"AVATo. T.", "ToVo", "A V"},
+                                 {"AVATo. T.", "ToVo", "A V"}};
+    const ILI9341_BPP_t bpps[2] = {ILI9341_BPP_16, ILI9341_BPP_18};
+    const int positions[4][2] = {{0, 0}, {-7, -5}, {180, 300}, {61, 150}};
+    test_begin(NULL, 1);
+
+    /* The BDF font lists its characters and has no kerning, whereas every TrueType font keeps the same pairs. */
+    TEST_CHECK(test_bdf_plain.p_characters != NULL);
+    TEST_CHECK_EQ(test_bdf_plain.glyph_count, 5);
+    TEST_CHECK_EQ(test_bdf_plain.kerning_pair_count, 0);
+    TEST_CHECK(kern_ttf_1_plain.kerning_pair_count > 0);
+    TEST_CHECK_EQ(kern_ttf_2_plain.kerning_pair_count, kern_ttf_1_plain.kerning_pair_count);
+    TEST_CHECK_EQ(kern_ttf_4_plain.kerning_pair_count, kern_ttf_1_plain.kerning_pair_count);
+    for (int f = 0; f < 4; f++)
+    {
+        check_metrics(plain_fonts[f], rle_fonts[f], characters[f]);
+    }
+
+    for (int b = 0; b < 2; b++)
+    {
+        TEST_CHECK_EQ(set_ili9341_bpp_type(&test_lcd[0], bpps[b]), ILI9341_EC_OK);
+        for (int f = 0; f < 4; f++)
+        {
+            for (int s = 0; s < 3; s++)
+            {
+                for (int p = 0; p < 4; p++)
+                {
+                    check_string(plain_fonts[f], rle_fonts[f], strings[f][s], positions[p][0], positions[p][1]);
+                }
+                TEST_CHECK_EQ(ili9341_set_clip_rect(&test_lcd[0], 9, 4, 23, 11), ILI9341_EC_OK);
+                check_string(plain_fonts[f], rle_fonts[f], strings[f][s], 2, 0);
+                ili9341_reset_clip_rect(&test_lcd[0]);
+            }
+        }
+    }
+    return test_end("test_font_compiler");
+}
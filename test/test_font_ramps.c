@@ -0,0 +1,201 @@
+/**@file
+ * @brief	Checks that @ref ili9341_draw_string blends the coverage of anti-aliased glyphs through color ramps that run
+ *          exactly from the background up to the ink, and that the cache of those ramps keeps giving the ramp of the
+ *          pair of colors being drawn while its entries are replaced.
+ *
+ * @details One font per glyph depth (i.e., 1, 2 and 4 bits per pixel) holds a single glyph with every coverage of
+ *          its depth, so that each drawn string shows every color of the ramp that the font indexes. Those colors must
+ *          match an independent per-channel interpolation of the pair of colors, where a coverage of zero must be
+ *          exactly the background and a full coverage exactly the ink, in 16 and in 18 bits per pixel.
+ *
+ *          More pairs of colors than @ref ILI9341_FONTS_RAMP_CACHE_SIZE are drawn forwards, backwards and interleaved
+ *          with the first one, so that every ramp is replaced and computed again several times. Every other pair shares
+ *          its ink with the previous one, the 16 bits per pixel colors hold random bits in the rest of their union, and
+ *          a pair that was cached in 16 bits per pixel is drawn again in 18 bits per pixel, so that a ramp may only be
+ *          reused for the very same colors in the very same Bits Per Pixel (BPP) type.
+ */
+
+#include "ili9341_fonts.h"
+#include "ili9341_test.h"
+#include <stdlib.h> // This library contains the functions: rand and srand.
+#include <string.h> // This library contains the functions: memset.
+
+#define SCREEN_COLOR    (0x1234)    /**< @brief Color that fills the screen before each string is drawn. */
+#define RAMP_PAIRS      (ILI9341_FONTS_RAMP_CACHE_SIZE + 2)  /**< @brief Number of pairs of colors drawn, which is more than the cache can hold. */
+#define TEXT_X          (17)        /**< @brief X coordinate at which the strings are drawn. */
+#define TEXT_Y          (23)        /**< @brief Y coordinate at which the strings are drawn. */
+
+/**@brief   A pair of ink and background colors.
+ */
+typedef struct
+{
+    ILI9341_COLOR ink;          //!< Color of the ink.
+    ILI9341_COLOR background;   //!< Color of the background.
+} color_pair_t;
+
+static ILI9341_glyph_t glyphs[3];
+static uint8_t bitmaps[3][16];
+static ILI9341_font_t fonts[3];
+
+/**@brief   Makes a font of the given depth whose only glyph, 'A', holds every coverage of that depth in ascending order
+ *          in its first row and in descending order in its second one.
+ */
+static void make_font(ILI9341_font_t *p_font, ILI9341_glyph_t *p_glyph, uint8_t *p_bitmap, uint8_t bpp)
+{
+    uint8_t levels = (uint8_t) (1 << bpp);
+    memset(p_bitmap, 0, 16);
+    for (uint32_t i = 0; i < 2U * levels; i++)
+    {
+        uint32_t coverage = (i < levels) ? i : (2U * levels - 1 - i);
+        uint32_t bit = i * bpp;
+        p_bitmap[bit / 8] |= (uint8_t) (coverage << (8 - bpp - bit % 8));
+    }
+    p_glyph->bitmap_offset = 0;
+    p_glyph->width = levels;
+    p_glyph->height = 2;
+    p_glyph->x_advance = levels;
+    p_glyph->x_offset = 0;
+    p_glyph->y_offset = -2;
+    memset(p_font, 0, sizeof(*p_font));
+    p_font->p_bitmaps = p_bitmap;
+    p_font->p_glyphs = p_glyph;
+    p_font->first = 'A';
+    p_font->last = 'A';
+    p_font->ascent = 2;
+    p_font->descent = 0;
+    p_font->bpp = bpp;
+}
+
+/**@brief   Interpolates a channel from the background up to the ink at the given color of a 16-color ramp, rounded to
+ *          the nearest value.
+ */
+static uint32_t interpolate(uint32_t background, uint32_t ink, uint32_t index)
+{
+    return (uint32_t) ((background * (15.0 - index) + ink * (double) index) / 15.0 + 0.5);
+}
+
+/**@brief   Gets the 18 bit value with which the ILI9341 Device stores the given color of the ramp of a pair of colors.
+ */
+static uint32_t expected_rgb666(ILI9341_BPP_t bpp, const color_pair_t *p_pair, uint32_t index)
+{
+    if (bpp == ILI9341_BPP_16)
+    {
+        uint16_t ink = p_pair->ink.bpp_16;
+        uint16_t background = p_pair->background.bpp_16;
+        uint32_t red = interpolate(background >> 11, ink >> 11, index);
+        uint32_t green = interpolate((background >> 5) & 0x3F, (ink >> 5) & 0x3F, index);
+        uint32_t blue = interpolate(background & 0x1F, ink & 0x1F, index);
+        return test_rgb565_to_rgb666((uint16_t) ((red << 11) | (green << 5) | blue));
+    }
+    uint32_t ink = p_pair->ink.bpp_18;
+    uint32_t background = p_pair->background.bpp_18;
+    uint32_t red = interpolate((background >> 18) & 0x3F, (ink >> 18) & 0x3F, index);
+    uint32_t green = interpolate((background >> 10) & 0x3F, (ink >> 10) & 0x3F, index);
+    uint32_t blue = interpolate((background >> 2) & 0x3F, (ink >> 2) & 0x3F, index);
+    return (red << 12) | (green << 6) | blue;
+}
+
+/**@brief   Draws the glyph of the given font with a pair of colors and checks every pixel of its text box.
+ */
+static void check_pair(const ILI9341_font_t *p_font, const color_pair_t *p_pair)
+{
+    ILI9341_BPP_t bpp = get_ili9341_bpp_type(&test_lcd[0]);
+    uint32_t levels = 1U << p_font->bpp;
+    uint32_t mismatches = 0;
+    uint32_t ink_rgb666 = (bpp == ILI9341_BPP_16) ? test_rgb565_to_rgb666(p_pair->ink.bpp_16) : test_bpp18_to_rgb666(p_pair->ink.bpp_18);
+    uint32_t background_rgb666 = (bpp == ILI9341_BPP_16) ? test_rgb565_to_rgb666(p_pair->background.bpp_16) : test_bpp18_to_rgb666(p_pair->background.bpp_18);
+
+    test_sync(&test_lcd[0]);
+    ili9341_panel_model_fill_gram(&test_panel[0], test_rgb565_to_rgb666(SCREEN_COLOR));
+    TEST_CHECK_EQ(ili9341_draw_string(&test_lcd[0], TEXT_X, TEXT_Y, p_font, "A", p_pair->ink, p_pair->background), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, 2 * levels);
+
+    for (uint32_t i = 0; i < 2 * levels; i++)
+    {
+        uint32_t coverage = (i < levels) ? i : (2 * levels - 1 - i);
+        uint32_t expected = expected_rgb666(bpp, p_pair, coverage * 15 / (levels - 1));
+        uint32_t actual = ili9341_panel_model_get_pixel(&test_panel[0], (int) (TEXT_X + i % levels), (int) (TEXT_Y + i / levels));
+        if (actual != expected)
+        {
+            if (mismatches < 4)
+            {
+                printf("  %u bpp font, coverage %u: pixel is 0x%05X, expected 0x%05X\n", (unsigned) p_font->bpp, (unsigned) coverage,
+                       (unsigned) actual, (unsigned) expected);
+            }
+            mismatches++;
+        }
+        /* The ends of the ramp are exactly the colors of the pair. */
+        if (coverage == 0)
+        {
+            TEST_CHECK_EQ(actual, background_rgb666);
+        }
+        else if (coverage == levels - 1)
+        {
+            TEST_CHECK_EQ(actual, ink_rgb666);
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+}
+
+/**@brief   Makes random pairs of colors in the given Bits Per Pixel (BPP) type, where every odd pair shares its ink with
+ *          the previous one and the first pair is the same color twice.
+ */
+static void make_pairs(color_pair_t *p_pairs, ILI9341_BPP_t bpp)
+{
+    for (int p = 0; p < RAMP_PAIRS; p++)
+    {
+        uint32_t ink = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+        uint32_t background = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+        /* In 16 bits per pixel, the rest of the union holds random bits, which the cache must ignore. */
+        p_pairs[p].ink.bpp_18 = (bpp == ILI9341_BPP_16) ? ink : (ink & 0xFCFCFC);
+        p_pairs[p].background.bpp_18 = (bpp == ILI9341_BPP_16) ? background : (background & 0xFCFCFC);
+        if (p == 0)
+        {
+            p_pairs[p].background = p_pairs[p].ink;
+        }
+        else if (p % 2 == 1)
+        {
+            p_pairs[p].ink = p_pairs[p - 1].ink;
+        }
+    }
+}
+
+int main(void)
+{
+    static color_pair_t pairs[RAMP_PAIRS];
+    const ILI9341_BPP_t bpps[2] = {ILI9341_BPP_16, ILI9341_BPP_18};
+    /* A pair whose union holds valid colors in both Bits Per Pixel (BPP) types. */
+    const color_pair_t shared = {.ink = {.bpp_18 = 0x00FCF81FU}, .background = {.bpp_18 = 0x00040C40U}};
+    test_begin(NULL, 1);
+    srand(24);
+    make_font(&fonts[0], &glyphs[0], bitmaps[0], 1);
+    make_font(&fonts[1], &glyphs[1], bitmaps[1], 2);
+    make_font(&fonts[2], &glyphs[2], bitmaps[2], 4);
+
+    for (int b = 0; b < 2; b++)
+    {
+        TEST_CHECK_EQ(set_ili9341_bpp_type(&test_lcd[0], bpps[b]), ILI9341_EC_OK);
+        /* The pair that was last cached in 16 bits per pixel must be computed again in 18 bits per pixel. */
+        check_pair(&fonts[2], &shared);
+        make_pairs(pairs, bpps[b]);
+        for (int f = 0; f < 3; f++)
+        {
+            for (int p = 0; p < RAMP_PAIRS; p++)
+            {
+                check_pair(&fonts[f], &pairs[p]);
+            }
+            for (int p = RAMP_PAIRS - 1; p >= 0; p--)
+            {
+                check_pair(&fonts[f], &pairs[p]);
+            }
+            for (int p = 1; p < RAMP_PAIRS; p++)
+            {
+                check_pair(&fonts[f], &pairs[0]);
+                check_pair(&fonts[f], &pairs[p]);
+            }
+        }
+        check_pair(&fonts[2], &shared);
+    }
+    return test_end("test_font_ramps");
+}
@@ -0,0 +1,198 @@
+/**@file
+ * @brief	Checks that @ref ili9341_draw_string draws each string through a single Address Window, whichever number of
+ *          strips its text box is rendered in, and that the text box holds the ink of its glyphs over its background.
+ *
+ * @details Two fonts of random 1 bit per pixel glyphs are used: a small one, whose text boxes mostly fit in a single
+ *          strip buffer, and a tall one, whose text boxes take many strips (i.e., one per row with the smallest
+ *          @ref ILI9341_FONTS_STRIP_PIXELS ). The glyphs overhang their advances and start left of their pens, so
+ *          that their ink overlaps and is cut at the sides of the text box. Each string is drawn in 16 and in 18 bits
+ *          per pixel, partly outside of the screen and of a Clip Rectangle, where every pixel must then hold the ink or
+ *          background of the text box or, outside of it, the color that the screen had before. Every string must
+ *          cost at most one Column Address Set (CASET) and one Page Address Set (PASET), and exactly one Memory Write
+ *          (RAMWR).
+ */
+
+#include "ili9341_fonts.h"
+#include "ili9341_test.h"
+#include <stdlib.h> // This library contains the functions: rand and srand.
+
+#define SCREEN_COLOR        (0x1234)    /**< @brief Color that fills the screen before each string is drawn. */
+#define INK_16              (0xFFE0)    /**< @brief Color of the ink in 16 bits per pixel. */
+#define BACKGROUND_16       (0x0010)    /**< @brief Color of the background of the text boxes in 16 bits per pixel. */
+#define INK_18              (0xFC8C30U) /**< @brief Color of the ink in 18 bits per pixel. */
+#define BACKGROUND_18       (0x0404FCU) /**< @brief Color of the background of the text boxes in 18 bits per pixel. */
+#define FONT_FIRST          (32)        /**< @brief First character of the fonts of this test. */
+#define FONT_LAST           (126)       /**< @brief Last character of the fonts of this test. */
+#define FONT_GLYPHS         (FONT_LAST - FONT_FIRST + 1)    /**< @brief Number of glyphs of each font of this test. */
+
+static ILI9341_glyph_t small_glyphs[FONT_GLYPHS];
+static ILI9341_glyph_t tall_glyphs[FONT_GLYPHS];
+static uint8_t small_bitmaps[FONT_GLYPHS * 16];
+static uint8_t tall_bitmaps[FONT_GLYPHS * 128];
+
+/**@brief   Fills in the glyphs of a font with random bitmaps of the given size, which start one column left of the pen
+ *          and overhang their advance by two columns.
+ */
+static void make_font(ILI9341_font_t *p_font, ILI9341_glyph_t *p_glyphs, uint8_t *p_bitmaps, uint8_t width, uint8_t height, uint8_t ascent,
+                      uint8_t descent)
+{
+    uint32_t bytes = ((uint32_t) width * height + 7) / 8;
+    for (int i = 0; i < FONT_GLYPHS; i++)
+    {
+        p_glyphs[i].bitmap_offset = (uint16_t) (i * bytes);
+        p_glyphs[i].width = width;
+        p_glyphs[i].height = height;
+        p_glyphs[i].x_advance = (uint8_t) (width - 2);
+        p_glyphs[i].x_offset = -1;
+        p_glyphs[i].y_offset = (int8_t) (2 - ascent);
+        for (uint32_t b = 0; b < bytes; b++)
+        {
+            p_bitmaps[i * bytes + b] = (uint8_t) rand();
+        }
+    }
+    p_font->p_bitmaps = p_bitmaps;
+    p_font->p_glyphs = p_glyphs;
+    p_font->first = FONT_FIRST;
+    p_font->last = FONT_LAST;
+    p_font->ascent = ascent;
+    p_font->descent = descent;
+    p_font->bpp = 1;
+    p_font->is_rle = 0;
+    p_font->p_characters = NULL;
+    p_font->glyph_count = 0;
+    p_font->kerning_pair_count = 0;
+    p_font->p_kerning_pairs = NULL;
+}
+
+/**@brief   Tells whether the given pixel, relative to the top-left corner of the text box of a string drawn with the
+ *          given font, is covered by the ink of any of its glyphs.
+ */
+static int is_ink(const ILI9341_font_t *p_font, const char *p_string, int bx, int by)
+{
+    int pen = 0;
+    for (; *p_string != '\0'; p_string++)
+    {
+        const ILI9341_glyph_t *p_glyph = &p_font->p_glyphs[(uint8_t) *p_string - FONT_FIRST];
+        int gx = bx - (pen + p_glyph->x_offset);
+        int gy = by - (p_font->ascent + p_glyph->y_offset);
+        pen += p_glyph->x_advance;
+        if ((gx >= 0) && (gy >= 0) && (gx < p_glyph->width) && (gy < p_glyph->height))
+        {
+            uint32_t bit = (uint32_t) gy * p_glyph->width + (uint32_t) gx;
+            if (p_font->p_bitmaps[p_glyph->bitmap_offset + bit / 8] & (0x80 >> (bit % 8)))
+            {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/**@brief   Draws a string over the screen color and compares the whole screen against it, where only the pixels within
+ *          the given Clip Rectangle (as {x0, y0, x1, y1} with x1 and y1 exclusive) may change.
+ */
+static void check_string(const ILI9341_font_t *p_font, const char *p_string, int x, int y, const int *p_clip)
+{
+    ILI9341_BPP_t bpp = get_ili9341_bpp_type(&test_lcd[0]);
+    ILI9341_COLOR ink;
+    ILI9341_COLOR background;
+    uint32_t ink_rgb666;
+    uint32_t background_rgb666;
+    int width = ili9341_get_string_width(p_font, p_string);
+    int height = p_font->ascent + p_font->descent;
+    uint32_t mismatches = 0;
+    uint32_t visible = 0;
+
+    if (bpp == ILI9341_BPP_16)
+    {
+        ink.bpp_16 = INK_16;
+        background.bpp_16 = BACKGROUND_16;
+        ink_rgb666 = test_rgb565_to_rgb666(INK_16);
+        background_rgb666 = test_rgb565_to_rgb666(BACKGROUND_16);
+    }
+    else
+    {
+        ink.bpp_18 = INK_18;
+        background.bpp_18 = BACKGROUND_18;
+        ink_rgb666 = test_bpp18_to_rgb666(INK_18);
+        background_rgb666 = test_bpp18_to_rgb666(BACKGROUND_18);
+    }
+    test_sync(&test_lcd[0]);
+    ili9341_panel_model_fill_gram(&test_panel[0], test_rgb565_to_rgb666(SCREEN_COLOR));
+    ILI9341_Status ret = ili9341_draw_string(&test_lcd[0], (int16_t) x, (int16_t) y, p_font, p_string, ink, background);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+
+    for (int py = 0; py < ILI9341_SCREEN_HEIGHT; py++)
+    {
+        for (int px = 0; px < ILI9341_SCREEN_WIDTH; px++)
+        {
+            int bx = px - x;
+            int by = py - y;
+            uint32_t expected = test_rgb565_to_rgb666(SCREEN_COLOR);
+            if ((px >= p_clip[0]) && (px < p_clip[2]) && (py >= p_clip[1]) && (py < p_clip[3]) && (bx >= 0) && (by >= 0) && (bx < width) && (by < height))
+            {
+                expected = is_ink(p_font, p_string, bx, by) ? ink_rgb666 : background_rgb666;
+                visible++;
+            }
+            uint32_t actual = ili9341_panel_model_get_pixel(&test_panel[0], px, py);
+            if (actual != expected)
+            {
+                if (mismatches < 4)
+                {
+                    printf("  \"%s\" at (%d, %d): pixel (%d, %d) is 0x%05X, expected 0x%05X\n", p_string, x, y, px, py, (unsigned) actual, (unsigned) expected);
+                }
+                mismatches++;
+            }
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, visible);
+    TEST_CHECK_EQ(ret, (visible > 0) ? ILI9341_EC_OK : ILI9341_EC_NA);
+    /* The whole visible part of the text box is written through a single Address Window, whose CASET or PASET is
+     * only sent if it differs from the one of the previous Address Window. */
+    TEST_CHECK(test_panel[0].stats.commands[0x2A] <= ((visible > 0) ? 1U : 0U));
+    TEST_CHECK(test_panel[0].stats.commands[0x2B] <= ((visible > 0) ? 1U : 0U));
+    TEST_CHECK_EQ(test_panel[0].stats.commands[0x2C], (visible > 0) ? 1 : 0);
+}
+
+int main(void)
+{
+    ILI9341_font_t small_font;
+    ILI9341_font_t tall_font;
+    const ILI9341_font_t *fonts[2] = {&small_font, &tall_font};
+    const ILI9341_BPP_t bpps[2] = {ILI9341_BPP_16, ILI9341_BPP_18};
+    const char *strings[3] = {"Temp: 23.5 C", "The quick brown fox jumps over the lazy dog", "W"};
+    const int positions[5][2] = {{0, 0}, {-11, -5}, {3, 290}, {200, 100}, {240, 0}};
+    const int screen[4] = {0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT};
+    const int clip[4] = {7, 12, 151, 260};
+    test_begin(NULL, 1);
+    srand(23);
+    make_font(&small_font, small_glyphs, small_bitmaps, 9, 12, 11, 4);
+    make_font(&tall_font, tall_glyphs, tall_bitmaps, 24, 42, 36, 10);
+
+    for (int b = 0; b < 2; b++)
+    {
+        TEST_CHECK_EQ(set_ili9341_bpp_type(&test_lcd[0], bpps[b]), ILI9341_EC_OK);
+        for (int f = 0; f < 2; f++)
+        {
+            for (int s = 0; s < 3; s++)
+            {
+                for (int p = 0; p < 5; p++)
+                {
+                    check_string(fonts[f], strings[s], positions[p][0], positions[p][1], screen);
+                }
+                TEST_CHECK_EQ(ili9341_set_clip_rect(&test_lcd[0], (int16_t) clip[0], (int16_t) clip[1], (uint16_t) (clip[2] - clip[0]),
+                                                    (uint16_t) (clip[3] - clip[1])), ILI9341_EC_OK);
+                check_string(fonts[f], strings[s], -3, 240, clip);
+                check_string(fonts[f], strings[s], 20, 30, clip);
+                ili9341_reset_clip_rect(&test_lcd[0]);
+            }
+        }
+    }
+
+    ILI9341_COLOR color = {0};
+    TEST_CHECK_EQ(ili9341_draw_string(&test_lcd[0], 0, 0, &small_font, "", color, color), ILI9341_EC_NA);
+    TEST_CHECK_EQ(ili9341_draw_string(&test_lcd[0], 0, 0, NULL, "A", color, color), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_draw_string(&test_lcd[0], 0, 0, &small_font, NULL, color, color), ILI9341_EC_ERR);
+    return test_end("test_fonts");
+}
@@ -0,0 +1,247 @@
+/**@file
+ * @brief	Checks that @ref ili9341_draw_jpeg and @ref ili9341_draw_jpeg_stream decode the JPEG images of
+ *          "fixtures/jpeg" into the very pixels into which libjpeg decodes them, and that the images that they do not
+ *          support are rejected.
+ *
+ * @details The images cover 4:4:4, 4:2:2, 4:2:0, 1x2 and grayscale sampling, quality 100, restart intervals and sizes
+ *          that are not a multiple of their MCUs (see "fixtures/make_jpegs.c"). Each of them is drawn over a known
+ *          background, partly outside of the screen and of a Clip Rectangle, where every visible pixel must hold the
+ *          pixel of the libjpeg reference (i.e., decoded with JDCT_ISLOW and without fancy upsampling) and every other
+ *          pixel must keep the background. The same must hold when the image is read in small chunks. A scan that uses
+ *          a table that its own image has not defined must be rejected, even if a previous image did define it, and so
+ *          must a Huffman table that has more codes of a length than the ones that fit in it. An image whose 16 bit
+ *          quantization table scales its coefficients far beyond the ones of any 8 bit image must still be decoded.
+ */
+
+#include "ili9341_jpeg.h"
+#include "ili9341_test.h"
+#include <stdlib.h> // This library contains the functions: malloc and free.
+#include <string.h> // This library contains the functions: memcpy, memmove and memset.
+
+#define BACKGROUND          (0x1234)    /**< @brief Color that fills the screen before each image is drawn. */
+#define JPEG_MAX_SIZE       (65536)     /**< @brief Largest size, in bytes, of the JPEG images of "fixtures/jpeg". */
+#define STREAM_CHUNK_SIZE   (7)         /**< @brief Number of bytes that @ref read_chunk gives at most per call. */
+
+/**@brief   A JPEG image of "fixtures/jpeg" together with its libjpeg reference.
+ */
+typedef struct
+{
+    const char *name;       //!< Name of the files of the image, without their extension.
+    int width;              //!< Number of columns of the image.
+    int height;             //!< Number of rows of the image.
+    uint32_t size;          //!< Number of bytes in @ref data .
+    uint8_t data[JPEG_MAX_SIZE]; //!< The JPEG image.
+    uint16_t *p_reference;  //!< The libjpeg reference of the image, as one 16 bits per pixel pixel per pixel.
+} jpeg_fixture_t;
+
+/**@brief   Position within a JPEG image up to which @ref read_chunk has read it.
+ */
+typedef struct
+{
+    const jpeg_fixture_t *p_fixture;    //!< Image that is being read.
+    uint32_t offset;                    //!< Number of bytes of the image that have been read.
+} jpeg_stream_t;
+
+static uint32_t read_file(const char *name, const char *extension, uint8_t *p_data, uint32_t size)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.%s", ILI9341_JPEG_FIXTURES_DIR, name, extension);
+    FILE *p_file = fopen(path, "rb");
+    TEST_CHECK(p_file != NULL);
+    if (p_file == NULL)
+    {
+        return 0;
+    }
+    uint32_t read = (uint32_t) fread(p_data, 1, size, p_file);
+    fclose(p_file);
+    return read;
+}
+
+static void load_fixture(jpeg_fixture_t *p_fixture, const char *name, int width, int height)
+{
+    uint32_t pixels = (uint32_t) width * height;
+    uint8_t *p_bytes = malloc(2 * pixels);
+    p_fixture->name = name;
+    p_fixture->width = width;
+    p_fixture->height = height;
+    p_fixture->size = read_file(name, "jpg", p_fixture->data, JPEG_MAX_SIZE);
+    TEST_CHECK(p_fixture->size < JPEG_MAX_SIZE);
+    p_fixture->p_reference = malloc(pixels * sizeof(uint16_t));
+    TEST_CHECK_EQ(read_file(name, "565", p_bytes, 2 * pixels), 2 * pixels);
+    for (uint32_t i = 0; i < pixels; i++)
+    {
+        p_fixture->p_reference[i] = (uint16_t) (p_bytes[2 * i] | (p_bytes[2 * i + 1] << 8));
+    }
+    free(p_bytes);
+}
+
+static uint32_t read_chunk(void *p_context, uint8_t *p_buffer, uint32_t size)
+{
+    jpeg_stream_t *p_stream = (jpeg_stream_t *) p_context;
+    uint32_t left = p_stream->p_fixture->size - p_stream->offset;
+    uint32_t n = (size < STREAM_CHUNK_SIZE) ? size : STREAM_CHUNK_SIZE;
+    n = (n < left) ? n : left;
+    memcpy(p_buffer, p_stream->p_fixture->data + p_stream->offset, n);
+    p_stream->offset += n;
+    return n;
+}
+
+/**@brief   Draws the given image over the background, either from memory or in chunks, and compares the whole screen
+ *          against its reference, where only the pixels within the given Clip Rectangle (as {x0, y0, x1, y1} with x1
+ *          and y1 exclusive) may differ from the background.
+ */
+static void check_jpeg(const jpeg_fixture_t *p_fixture, int is_stream, int x, int y, const int *p_clip)
+{
+    jpeg_stream_t stream = {p_fixture, 0};
+    uint32_t mismatches = 0;
+    uint32_t visible = 0;
+    ILI9341_Status ret;
+
+    test_sync(&test_lcd[0]);
+    ili9341_panel_model_fill_gram(&test_panel[0], test_rgb565_to_rgb666(BACKGROUND));
+    if (is_stream)
+    {
+        ret = ili9341_draw_jpeg_stream(&test_lcd[0], (int16_t) x, (int16_t) y, read_chunk, &stream);
+    }
+    else
+    {
+        ret = ili9341_draw_jpeg(&test_lcd[0], (int16_t) x, (int16_t) y, p_fixture->data, p_fixture->size);
+    }
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+
+    for (int py = 0; py < ILI9341_SCREEN_HEIGHT; py++)
+    {
+        for (int px = 0; px < ILI9341_SCREEN_WIDTH; px++)
+        {
+            int sx = px - x;
+            int sy = py - y;
+            uint16_t expected = BACKGROUND;
+            if ((px >= p_clip[0]) && (px < p_clip[2]) && (py >= p_clip[1]) && (py < p_clip[3]) && (sx >= 0) && (sy >= 0)
+                && (sx < p_fixture->width) && (sy < p_fixture->height))
+            {
+                expected = p_fixture->p_reference[sy * p_fixture->width + sx];
+                visible++;
+            }
+            uint16_t actual = ili9341_panel_model_get_pixel_565(&test_panel[0], (uint16_t) px, (uint16_t) py);
+            if (actual != expected)
+            {
+                if (mismatches < 4)
+                {
+                    printf("  %s at (%d, %d): pixel (%d, %d) is 0x%04X, expected 0x%04X\n", p_fixture->name, x, y, px, py, actual, expected);
+                }
+                mismatches++;
+            }
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, visible);
+    TEST_CHECK_EQ(ret, (visible > 0) ? ILI9341_EC_OK : ILI9341_EC_NA);
+}
+
+/**@brief   Finds the first marker segment of the given type within a JPEG image.
+ *
+ * @return  Offset of the first byte of the marker segment after its length field.
+ */
+static uint32_t find_segment(const uint8_t *p_data, uint32_t size, uint8_t marker)
+{
+    uint32_t i = 2;
+    while ((i + 4 <= size) && (p_data[i + 1] != marker))
+    {
+        i += 2 + (uint32_t) ((p_data[i + 2] << 8) | p_data[i + 3]);
+    }
+    TEST_CHECK(i + 4 <= size);
+    return i + 4;
+}
+
+int main(void)
+{
+    static jpeg_fixture_t fixtures[7];
+    static jpeg_fixture_t modified;
+    const int positions[4][2] = {{0, 0}, {-80, 80}, {17, -5}, {150, 250}};
+    const int screen[4] = {0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT};
+    const int clip[4] = {13, 21, 187, 190};
+    test_begin(NULL, 1);
+    load_fixture(&fixtures[0], "p444", 320, 240);
+    load_fixture(&fixtures[1], "p422", 320, 240);
+    load_fixture(&fixtures[2], "p420", 320, 240);
+    load_fixture(&fixtures[3], "gray", 320, 240);
+    load_fixture(&fixtures[4], "q100", 320, 240);
+    load_fixture(&fixtures[5], "odd12", 211, 99);
+    load_fixture(&fixtures[6], "odd420", 203, 157);
+
+    for (int i = 0; i < 7; i++)
+    {
+        for (int p = 0; p < 4; p++)
+        {
+            check_jpeg(&fixtures[i], 0, positions[p][0], positions[p][1], screen);
+        }
+        check_jpeg(&fixtures[i], 1, -5, 3, screen);
+        TEST_CHECK_EQ(ili9341_set_clip_rect(&test_lcd[0], (int16_t) clip[0], (int16_t) clip[1], (uint16_t) (clip[2] - clip[0]),
+                                            (uint16_t) (clip[3] - clip[1])), ILI9341_EC_OK);
+        check_jpeg(&fixtures[i], 0, -30, 7, clip);
+        check_jpeg(&fixtures[i], 1, 100, 150, clip);
+        ili9341_reset_clip_rect(&test_lcd[0]);
+    }
+
+    /* Progressive images are not supported. */
+    modified.size = read_file("prog", "jpg", modified.data, JPEG_MAX_SIZE);
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 0, 0, modified.data, modified.size), ILI9341_EC_ERR);
+
+    /* A grayscale image whose scan uses the second Huffman tables, or whose frame uses the second quantization table,
+     * which only the previous 4:4:4 image defined. */
+    uint32_t offset;
+    check_jpeg(&fixtures[0], 0, 0, 0, screen);
+    modified = fixtures[3];
+    offset = find_segment(modified.data, modified.size, 0xDA);
+    TEST_CHECK_EQ(modified.data[offset + 2], 0x00);
+    modified.data[offset + 2] = 0x11;
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 0, 0, modified.data, modified.size), ILI9341_EC_ERR);
+    modified.data[offset + 2] = 0x01;
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 0, 0, modified.data, modified.size), ILI9341_EC_ERR);
+    modified.data[offset + 2] = 0x00;
+    offset = find_segment(modified.data, modified.size, 0xC0);
+    TEST_CHECK_EQ(modified.data[offset + 8], 0x00);
+    modified.data[offset + 8] = 0x01;
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 0, 0, modified.data, modified.size), ILI9341_EC_ERR);
+    modified.data[offset + 8] = 0x00;
+    check_jpeg(&modified, 0, 0, 0, screen);
+
+    /* A grayscale image whose first Huffman table has three codes of a single bit, without changing its number of codes. */
+    offset = find_segment(modified.data, modified.size, 0xC4);
+    TEST_CHECK_EQ(modified.data[offset + 1], 0);
+    TEST_CHECK_EQ(modified.data[offset + 3], 5);
+    modified.data[offset + 1] = 3;
+    modified.data[offset + 3] = 2;
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 0, 0, modified.data, modified.size), ILI9341_EC_ERR);
+    modified.data[offset + 1] = 0;
+    modified.data[offset + 3] = 5;
+    check_jpeg(&modified, 0, 0, 0, screen);
+
+    /* A grayscale image whose quantization table is rewritten with 16 bit values of 65535, so that every coefficient
+     * that is not zero goes far beyond the range of the inverse DCT. */
+    offset = find_segment(modified.data, modified.size, 0xDB);
+    TEST_CHECK_EQ((modified.data[offset - 2] << 8) | modified.data[offset - 1], 2 + 1 + 64);
+    memmove(&modified.data[offset + 1 + 128], &modified.data[offset + 1 + 64], modified.size - (offset + 1 + 64));
+    memset(&modified.data[offset + 1], 0xFF, 128);
+    modified.data[offset - 1] = 2 + 1 + 128;
+    modified.data[offset] |= 0x10;
+    modified.size += 64;
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 0, 0, modified.data, modified.size), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+
+    /* A truncated image still draws all of its visible pixels, but is reported. */
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 0, 0, fixtures[2].data, fixtures[2].size / 2), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 240, 0, fixtures[0].data, fixtures[0].size), ILI9341_EC_NA);
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 0, 0, NULL, 0), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_draw_jpeg_stream(&test_lcd[0], 0, 0, NULL, NULL), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(set_ili9341_bpp_type(&test_lcd[0], ILI9341_BPP_18), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_draw_jpeg(&test_lcd[0], 0, 0, fixtures[0].data, fixtures[0].size), ILI9341_EC_NA);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    for (int i = 0; i < 7; i++)
+    {
+        free(fixtures[i].p_reference);
+    }
+    return test_end("test_jpeg");
+}
@@ -0,0 +1,173 @@
+/**@file
+ * @brief	Checks @ref ili9341_draw_line and @ref ili9341_draw_polyline , and therefore the runs into which they
+ *          split each line, against a per-pixel Bresenham reference rasterizer.
+ *
+ * @details Random lines, including horizontal, vertical and diagonal ones and ones whose endpoints lie outside of the
+ *          screen, must light exactly the same pixels of the Frame Memory as the reference, which plots each pixel of
+ *          the line and only keeps the ones that lie within the screen.
+ */
+
+#include "ili9341_graphics.h"
+#include "ili9341_test.h"
+#include <stdlib.h> // This library contains the functions: abs, rand and srand.
+#include <string.h> // This library contains the function: memset.
+
+#define LINE_ROUNDS         (300)   /**< @brief Number of random lines that are checked. */
+#define POLYLINE_POINTS     (200)   /**< @brief Number of points of the random polylines that are checked. */
+
+static uint16_t expected[ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT];
+
+/**@brief   Plots the given line into @ref expected with the textbook Bresenham algorithm.
+ */
+static void reference_line(int x0, int y0, int x1, int y1, uint16_t color)
+{
+    int dx = abs(x1 - x0);
+    int dy = abs(y1 - y0);
+    int sx = (x1 >= x0) ? 1 : -1;
+    int sy = (y1 >= y0) ? 1 : -1;
+    int x = x0;
+    int y = y0;
+    int is_x_major = dx >= dy;
+    int d = is_x_major ? (2 * dy - dx) : (2 * dx - dy);
+    for (;;)
+    {
+        if ((x >= 0) && (x < ILI9341_SCREEN_WIDTH) && (y >= 0) && (y < ILI9341_SCREEN_HEIGHT))
+        {
+            expected[y * ILI9341_SCREEN_WIDTH + x] = color;
+        }
+        if ((x == x1) && (y == y1))
+        {
+            break;
+        }
+        if (is_x_major)
+        {
+            if (d > 0)
+            {
+                y += sy;
+                d -= 2 * dx;
+            }
+            d += 2 * dy;
+            x += sx;
+        }
+        else
+        {
+            if (d > 0)
+            {
+                x += sx;
+                d -= 2 * dy;
+            }
+            d += 2 * dx;
+            y += sy;
+        }
+    }
+}
+
+static int is_any_expected(void)
+{
+    for (uint32_t i = 0; i < ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT; i++)
+    {
+        if (expected[i] != 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void clear(void)
+{
+    ILI9341_COLOR black = {0};
+    TEST_CHECK_EQ(ili9341_fill_screen(&test_lcd[0], black), ILI9341_EC_OK);
+    test_sync(&test_lcd[0]);
+    memset(expected, 0, sizeof(expected));
+}
+
+int main(void)
+{
+    ILI9341_COLOR white;
+    white.bpp_16 = 0xFFFF;
+    test_begin(NULL, 1);
+    srand(1);
+
+    /* Random lines, of which some are forced to be horizontal, vertical or exactly diagonal. */
+    for (int round = 0; round < LINE_ROUNDS; round++)
+    {
+        int x0 = rand() % 400 - 80;
+        int y0 = rand() % 480 - 80;
+        int x1 = rand() % 400 - 80;
+        int y1 = rand() % 480 - 80;
+        switch (round % 10)
+        {
+            case 0:
+                x1 = x0;
+                break;
+            case 1:
+                y1 = y0;
+                break;
+            case 2:
+                y1 = y0 + (x1 - x0);
+                break;
+            case 3:
+                x1 = x0;
+                y1 = y0;
+                break;
+            default:
+                break;
+        }
+        clear();
+        ILI9341_Status ret = ili9341_draw_line(&test_lcd[0], (int16_t) x0, (int16_t) y0, (int16_t) x1, (int16_t) y1, white);
+        TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+        reference_line(x0, y0, x1, y1, 0xFFFF);
+        uint32_t mismatches = test_compare_frame_565(&test_panel[0], expected);
+        if (mismatches != 0)
+        {
+            printf("line (%d, %d) to (%d, %d)\n", x0, y0, x1, y1);
+        }
+        TEST_CHECK_EQ(mismatches, 0);
+        TEST_CHECK_EQ(ret, is_any_expected() ? ILI9341_EC_OK : ILI9341_EC_NA);
+    }
+
+    /* Random polylines, whose segments share their endpoints and cross each other. */
+    static ILI9341_point_t points[POLYLINE_POINTS];
+    for (int round = 0; round < 4; round++)
+    {
+        int step = (round < 2) ? 41 : 301;
+        points[0].x = 120;
+        points[0].y = 160;
+        for (int i = 1; i < POLYLINE_POINTS; i++)
+        {
+            points[i].x = (int16_t) (points[i - 1].x + rand() % step - step / 2);
+            points[i].y = (int16_t) (points[i - 1].y + rand() % step - step / 2);
+        }
+        clear();
+        TEST_CHECK_EQ(ili9341_draw_polyline(&test_lcd[0], points, POLYLINE_POINTS, white), ILI9341_EC_OK);
+        TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+        for (int i = 1; i < POLYLINE_POINTS; i++)
+        {
+            reference_line(points[i - 1].x, points[i - 1].y, points[i].x, points[i].y, 0xFFFF);
+        }
+        TEST_CHECK_EQ(test_compare_frame_565(&test_panel[0], expected), 0);
+    }
+
+    /* The lines are clipped to the Clip Rectangle as well. */
+    clear();
+    TEST_CHECK_EQ(ili9341_set_clip_rect(&test_lcd[0], 50, 60, 100, 120), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_draw_line(&test_lcd[0], -30, 10, 230, 300, white), ILI9341_EC_OK);
+    ili9341_reset_clip_rect(&test_lcd[0]);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    reference_line(-30, 10, 230, 300, 0xFFFF);
+    for (int y = 0; y < ILI9341_SCREEN_HEIGHT; y++)
+    {
+        for (int x = 0; x < ILI9341_SCREEN_WIDTH; x++)
+        {
+            if ((x < 50) || (x >= 150) || (y < 60) || (y >= 180))
+            {
+                expected[y * ILI9341_SCREEN_WIDTH + x] = 0;
+            }
+        }
+    }
+    TEST_CHECK_EQ(test_compare_frame_565(&test_panel[0], expected), 0);
+
+    TEST_CHECK_EQ(ili9341_draw_polyline(&test_lcd[0], points, 0, white), ILI9341_EC_ERR);
+    return test_end("test_lines");
+}
@@ -0,0 +1,82 @@
+/**@file
+ * @brief	Checks that the virtual ILI9341 Device decodes what the @ref ili9341 sends to it.
+ *
+ * @details The initialization, an Address Window with its Memory Write, a Memory Write Continue, the 18 bits per pixel
+ *          Pixel Format and the counters of both the @ref stm32_host_hal and the virtual ILI9341 Device are checked,
+ *          since all the other tests and benchmarks rely on them.
+ */
+
+#include "ili9341_test.h"
+
+static uint8_t pixels[20 * 10 * 2];
+
+int main(void)
+{
+    test_begin(NULL, 1);
+    ili9341_panel_model_t *p_panel = &test_panel[0];
+    ILI9341_handle_t *p_lcd = &test_lcd[0];
+
+    /* The initialization leaves MX = 1 and BGR = 1, 16 bits per pixel and the default Interface Control. */
+    TEST_CHECK_EQ(p_panel->madctl, 0x48);
+    TEST_CHECK_EQ(p_panel->colmod, 0x55);
+    TEST_CHECK_EQ(p_panel->ifctl[0], 0x01);
+    TEST_CHECK_EQ(p_panel->ifctl[1], 0x00);
+    TEST_CHECK_EQ(p_panel->ifctl[2], 0x00);
+
+    /* An Address Window, its Memory Write and a Memory Write Continue into it. */
+    for (int i = 0; i < 200; i++)
+    {
+        pixels[2 * i] = 0xF8;
+        pixels[2 * i + 1] = (uint8_t) i;
+    }
+    TEST_CHECK_EQ(ili9341_set_window(p_lcd, 10, 20, 29, 29), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_write_pixels(p_lcd, pixels, 200, NULL), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_write_pixels(p_lcd, pixels + 200, 200, NULL), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    TEST_CHECK_EQ(p_panel->trace_count, 3);
+    TEST_CHECK_EQ(p_panel->trace[0].command, 0x2A);
+    TEST_CHECK_EQ(p_panel->trace[0].params[1], 10);
+    TEST_CHECK_EQ(p_panel->trace[0].params[3], 29);
+    TEST_CHECK_EQ(p_panel->trace[1].command, 0x2B);
+    TEST_CHECK_EQ(p_panel->trace[1].params[1], 20);
+    TEST_CHECK_EQ(p_panel->trace[1].params[3], 29);
+    TEST_CHECK_EQ(p_panel->trace[2].command, 0x2C);
+    TEST_CHECK_EQ(p_panel->trace[2].pixels, 200);
+    TEST_CHECK_EQ(p_panel->stats.bytes, 3 + 4 + 4 + 400);
+    TEST_CHECK_EQ(p_panel->stats.command_bytes, 3);
+    TEST_CHECK_EQ(p_panel->stats.pixels, 200);
+    TEST_CHECK_EQ(p_panel->stats.overflow_pixels, 0);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(p_panel, 10, 20), 0xF800);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(p_panel, 29, 29), 0xF8C7);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel(p_panel, 10, 20), test_rgb565_to_rgb666(0xF800));
+    /* MX = 1 mirrors the columns of the Frame Memory. */
+    TEST_CHECK_EQ(p_panel->gram[20][ILI9341_PANEL_COLUMNS - 1 - 10], test_rgb565_to_rgb666(0xF800));
+    host_hal_stats_t stats;
+    host_hal_get_stats(&stats);
+    TEST_CHECK_EQ(stats.bytes, p_panel->stats.bytes);
+    TEST_CHECK_EQ(stats.busy_starts, 0);
+    TEST_CHECK(stats.bus_time_ns > 0);
+    test_sync(p_lcd);
+
+    /* Pixels beyond the Address Window wrap back to its start, since the ILI9341 Device is left with WEMODE = 1. */
+    TEST_CHECK_EQ(ili9341_set_window(p_lcd, 0, 0, 9, 0), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_write_pixels(p_lcd, pixels, 24, NULL), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    TEST_CHECK_EQ(p_panel->stats.overflow_pixels, 2);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(p_panel, 0, 0), 0xF80A);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(p_panel, 2, 0), 0xF802);
+    test_sync(p_lcd);
+
+    /* 18 bits per pixel. */
+    ILI9341_COLOR color;
+    color.bpp_18 = (0x3FUL << 18) | (0x15UL << 10) | (0x2AUL << 2);
+    TEST_CHECK_EQ(set_ili9341_bpp_type(p_lcd, ILI9341_BPP_18), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_fill_rect(p_lcd, 100, 100, 5, 5, color), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    TEST_CHECK_EQ(p_panel->colmod, 0x66);
+    TEST_CHECK_EQ(p_panel->stats.pixels, 25);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel(p_panel, 104, 104), test_bpp18_to_rgb666(color.bpp_18));
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel(p_panel, 104, 104), (0x3FU << 12) | (0x15U << 6) | 0x2AU);
+
+    return test_end("test_panel_model");
+}
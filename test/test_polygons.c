@@ -0,0 +1,212 @@
+/**@file
+ * @brief	Checks @ref ili9341_fill_polygon against a brute-force reference that tests the center of every pixel of
+ *          the screen against every edge of the polygon.
+ *
+ * @details The reference follows both Fill Rules exactly, whereas @ref ili9341_fill_polygon walks its edges in fixed
+ *          point, so a mismatch is only tolerated for the pixels whose center lies within @ref EDGE_TOLERANCE of an
+ *          edge. Polygons that share an edge must not draw any of its pixels twice, horizontal edges must not add any
+ *          row of their own and the vertices may lie anywhere outside of the screen or of the Clip Rectangle.
+ */
+
+#include "ili9341_graphics.h"
+#include "ili9341_test.h"
+#include <stdlib.h> // This library contains the functions: rand and srand.
+
+#define EDGE_TOLERANCE      (0.01)  /**< @brief Distance, in pixels, from an edge within which a mismatch is tolerated. */
+#define RANDOM_ROUNDS       (200)   /**< @brief Number of random polygons that are checked. */
+
+/**@brief   Clip Rectangle against which the reference is checked, as {x0, y0, x1, y1} with x1 and y1 exclusive.
+ */
+static int clip[4] = {0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT};
+
+/**@brief   Decides whether the point (px, py) lies inside of the given polygon, by casting a ray from it towards the
+ *          left and counting the edges that it crosses.
+ */
+static int is_inside(const ILI9341_point_t *p_points, int count, double px, double py, ILI9341_FILL_RULE_t fill_rule)
+{
+    int crossings = 0;
+    int winding = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const ILI9341_point_t *p_a = &p_points[i];
+        const ILI9341_point_t *p_b = &p_points[(i + 1) % count];
+        if (p_a->y == p_b->y)
+        {
+            continue;
+        }
+        double y_low = (p_a->y < p_b->y) ? p_a->y : p_b->y;
+        double y_high = (p_a->y < p_b->y) ? p_b->y : p_a->y;
+        if ((py < y_low) || (py >= y_high))
+        {
+            continue;
+        }
+        double x = p_a->x + (py - p_a->y) * (p_b->x - p_a->x) / (double) (p_b->y - p_a->y);
+        if (x <= px)
+        {
+            crossings ^= 1;
+            winding += (p_a->y < p_b->y) ? 1 : -1;
+        }
+    }
+    return (fill_rule == ILI9341_FILL_RULE_NON_ZERO) ? (winding != 0) : crossings;
+}
+
+/**@brief   Decides whether any edge of the given polygon crosses the row of the point (px, py) within
+ *          @ref EDGE_TOLERANCE of it, where the fixed point edges of @ref ili9341_fill_polygon may round either way.
+ */
+static int is_near_edge(const ILI9341_point_t *p_points, int count, double px, double py)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const ILI9341_point_t *p_a = &p_points[i];
+        const ILI9341_point_t *p_b = &p_points[(i + 1) % count];
+        double y_low = (p_a->y < p_b->y) ? p_a->y : p_b->y;
+        double y_high = (p_a->y < p_b->y) ? p_b->y : p_a->y;
+        if ((p_a->y == p_b->y) || (py < y_low) || (py >= y_high))
+        {
+            continue;
+        }
+        double x = p_a->x + (py - p_a->y) * (p_b->x - p_a->x) / (double) (p_b->y - p_a->y);
+        if ((x > px - EDGE_TOLERANCE) && (x < px + EDGE_TOLERANCE))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**@brief   Compares the Frame Memory against the reference for a polygon that was filled in white over black.
+ *
+ * @return  The number of mismatches that are not explained by an edge passing near the center of their pixel.
+ */
+static uint32_t check_polygon(const ILI9341_point_t *p_points, int count, ILI9341_FILL_RULE_t fill_rule, uint32_t *p_inside)
+{
+    uint32_t mismatches = 0;
+    *p_inside = 0;
+    for (int y = 0; y < ILI9341_SCREEN_HEIGHT; y++)
+    {
+        for (int x = 0; x < ILI9341_SCREEN_WIDTH; x++)
+        {
+            int is_clipped = (x < clip[0]) || (y < clip[1]) || (x >= clip[2]) || (y >= clip[3]);
+            int expected = !is_clipped && is_inside(p_points, count, x + 0.5, y + 0.5, fill_rule);
+            int actual = ili9341_panel_model_get_pixel_565(&test_panel[0], x, y) == 0xFFFF;
+            *p_inside += (uint32_t) expected;
+            if ((expected != actual) && !is_near_edge(p_points, count, x + 0.5, y + 0.5))
+            {
+                if (mismatches < 8)
+                {
+                    printf("  pixel (%d, %d) is %d instead of %d\n", x, y, actual, expected);
+                }
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+static void clear(void)
+{
+    test_sync(&test_lcd[0]);
+    ili9341_panel_model_fill_gram(&test_panel[0], 0);
+}
+
+/**@brief   Fills the given polygon over a black screen and checks it against the reference.
+ *
+ * @return  The number of pixels that the polygon sent to the ILI9341 Device.
+ */
+static uint32_t fill_and_check(const ILI9341_point_t *p_points, int count, ILI9341_FILL_RULE_t fill_rule)
+{
+    ILI9341_COLOR white;
+    white.bpp_16 = 0xFFFF;
+    uint32_t inside;
+    clear();
+    ILI9341_Status ret = ili9341_fill_polygon(&test_lcd[0], p_points, (uint8_t) count, fill_rule, white);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    TEST_CHECK_EQ(check_polygon(p_points, count, fill_rule, &inside), 0);
+    if (inside > 0)
+    {
+        TEST_CHECK_EQ(ret, ILI9341_EC_OK);
+    }
+    return test_panel[0].stats.pixels;
+}
+
+int main(void)
+{
+    ILI9341_COLOR white;
+    white.bpp_16 = 0xFFFF;
+    test_begin(NULL, 1);
+
+    /* A self-intersecting star, whose center is only inside of it with the Non-Zero Fill Rule. */
+    const ILI9341_point_t star[5] = {{120, 20}, {190, 280}, {20, 110}, {220, 110}, {50, 280}};
+    fill_and_check(star, 5, ILI9341_FILL_RULE_EVEN_ODD);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(&test_panel[0], 120, 150), 0x0000);
+    fill_and_check(star, 5, ILI9341_FILL_RULE_NON_ZERO);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(&test_panel[0], 120, 150), 0xFFFF);
+
+    /* Horizontal edges do not add a row of their own: a rectangle covers the pixels whose centers lie inside of it. */
+    const ILI9341_point_t rectangle[4] = {{10, 20}, {50, 20}, {50, 60}, {10, 60}};
+    TEST_CHECK_EQ(fill_and_check(rectangle, 4, ILI9341_FILL_RULE_EVEN_ODD), 40 * 40);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(&test_panel[0], 10, 20), 0xFFFF);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(&test_panel[0], 49, 59), 0xFFFF);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(&test_panel[0], 50, 59), 0x0000);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(&test_panel[0], 49, 60), 0x0000);
+    const ILI9341_point_t staircase[8] = {{10, 10}, {100, 10}, {100, 40}, {60, 40}, {60, 70}, {30, 70}, {30, 40}, {10, 40}};
+    fill_and_check(staircase, 8, ILI9341_FILL_RULE_EVEN_ODD);
+    const ILI9341_point_t flat[3] = {{10, 10}, {100, 10}, {200, 10}};
+    TEST_CHECK_EQ(ili9341_fill_polygon(&test_lcd[0], flat, 3, ILI9341_FILL_RULE_EVEN_ODD, white), ILI9341_EC_NA);
+
+    /* Polygons that share an edge draw each of its pixels exactly once, whatever the slope of the edge. */
+    const ILI9341_point_t shared_edges[][4] = {{{20, 30}, {200, 30}, {200, 290}, {20, 290}}, {{37, 11}, {211, 53}, {190, 301}, {5, 250}}};
+    for (int i = 0; i < 2; i++)
+    {
+        const ILI9341_point_t *p_quad = shared_edges[i];
+        const ILI9341_point_t first[3] = {p_quad[0], p_quad[1], p_quad[2]};
+        const ILI9341_point_t second[3] = {p_quad[0], p_quad[2], p_quad[3]};
+        uint32_t quad_pixels = fill_and_check(p_quad, 4, ILI9341_FILL_RULE_EVEN_ODD);
+        clear();
+        TEST_CHECK_EQ(ili9341_fill_polygon(&test_lcd[0], first, 3, ILI9341_FILL_RULE_EVEN_ODD, white), ILI9341_EC_OK);
+        TEST_CHECK_EQ(ili9341_fill_polygon(&test_lcd[0], second, 3, ILI9341_FILL_RULE_EVEN_ODD, white), ILI9341_EC_OK);
+        TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+        TEST_CHECK_EQ(test_panel[0].stats.pixels, quad_pixels);
+        uint32_t inside;
+        TEST_CHECK_EQ(check_polygon(p_quad, 4, ILI9341_FILL_RULE_EVEN_ODD, &inside), 0);
+    }
+
+    /* Random polygons, whose vertices lie well beyond the edges of the screen. */
+    srand(3);
+    for (int round = 0; round < RANDOM_ROUNDS; round++)
+    {
+        ILI9341_point_t points[12];
+        int count = 3 + rand() % 10;
+        for (int i = 0; i < count; i++)
+        {
+            points[i].x = (int16_t) (rand() % 400 - 80);
+            points[i].y = (int16_t) (rand() % 480 - 80);
+        }
+        fill_and_check(points, count, (round & 1) ? ILI9341_FILL_RULE_NON_ZERO : ILI9341_FILL_RULE_EVEN_ODD);
+    }
+
+    /* The same random polygons, clipped to a Clip Rectangle that leaves many of their vertices outside of it. */
+    TEST_CHECK_EQ(ili9341_set_clip_rect(&test_lcd[0], 40, 50, 120, 180), ILI9341_EC_OK);
+    clip[0] = 40;
+    clip[1] = 50;
+    clip[2] = 160;
+    clip[3] = 230;
+    srand(3);
+    for (int round = 0; round < RANDOM_ROUNDS / 4; round++)
+    {
+        ILI9341_point_t points[12];
+        int count = 3 + rand() % 10;
+        for (int i = 0; i < count; i++)
+        {
+            points[i].x = (int16_t) (rand() % 400 - 80);
+            points[i].y = (int16_t) (rand() % 480 - 80);
+        }
+        fill_and_check(points, count, (round & 1) ? ILI9341_FILL_RULE_NON_ZERO : ILI9341_FILL_RULE_EVEN_ODD);
+    }
+    ili9341_reset_clip_rect(&test_lcd[0]);
+
+    TEST_CHECK_EQ(ili9341_fill_polygon(&test_lcd[0], star, 2, ILI9341_FILL_RULE_EVEN_ODD, white), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_fill_polygon(&test_lcd[0], star, 5, (ILI9341_FILL_RULE_t) 7, white), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_fill_polygon(&test_lcd[0], NULL, 5, ILI9341_FILL_RULE_EVEN_ODD, white), ILI9341_EC_ERR);
+    return test_end("test_polygons");
+}
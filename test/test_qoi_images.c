@@ -0,0 +1,197 @@
+/**@file
+ * @brief	Checks that the QOI images written by "tools/ili9341_image_encoder.py", in both 16 and 18 bits per pixel,
+ *          draw through @ref ili9341_draw_qoi_image the very pixels of the PNG and PPM images from which they were
+ *          encoded, whichever Bits Per Pixel (BPP) type the ILI9341 Device is in, and that cut operations are reported.
+ *
+ * @details Each image is drawn over a known background, partly outside of the screen and of a Clip Rectangle, with
+ *          the ILI9341 Device in 16 and in 18 bits per pixel. Every visible pixel must then hold its source pixel,
+ *          quantized into the Bits Per Pixel (BPP) type of the image and then converted into the one of the ILI9341
+ *          Device (i.e., an 18 bits per pixel image drawn in 16 bits per pixel loses the lowest bit of its red and blue
+ *          channels, while a 16 bits per pixel image drawn in 18 bits per pixel is expanded just like the ILI9341
+ *          Device expands 16 bits per pixel colors), and every other pixel must keep the background. Whenever the
+ *          operations of an image end too early, the pixels decoded up to that point must still be drawn, the rest of
+ *          the image must be drawn in black and @ref ILI9341_EC_ERR must be returned.
+ */
+
+#include "ili9341_images.h"
+#include "ili9341_test.h"
+
+#define BACKGROUND      (0x1234)    /**< @brief Color that fills the screen before each image is drawn. */
+#define CORRUPT_WIDTH   (4)         /**< @brief Width of the hand-made operations of this test. */
+#define CORRUPT_HEIGHT  (2)         /**< @brief Height of the hand-made operations of this test. */
+
+extern const ILI9341_qoi_image_t photo_ppm_qoi_16, photo_ppm_qoi_18, illustration_png_qoi_16, illustration_png_qoi_18;
+extern const ILI9341_qoi_image_t mixed_ppm_qoi_16, mixed_ppm_qoi_18;
+extern const test_source_image_t photo_ppm_source, illustration_png_source, mixed_ppm_source;
+
+/**@brief   Converts a pixel of a @ref test_source_image_t into the 18 bit value with which the ILI9341 Device stores
+ *          it, once quantized into \p image_bpp by the encoder and converted into \p panel_bpp by the decoder.
+ */
+static uint32_t expected_rgb666(uint32_t argb, ILI9341_BPP_t image_bpp, ILI9341_BPP_t panel_bpp)
+{
+    uint32_t red = (argb >> 18) & 0x3F;
+    uint32_t green = (argb >> 10) & 0x3F;
+    uint32_t blue = (argb >> 2) & 0x3F;
+    if (image_bpp == ILI9341_BPP_16)
+    {
+        return test_rgb565_to_rgb666(test_argb_to_rgb565(argb));
+    }
+    if (panel_bpp == ILI9341_BPP_16)
+    {
+        return test_rgb565_to_rgb666((uint16_t) (((red >> 1) << 11) | (green << 5) | (blue >> 1)));
+    }
+    return (red << 12) | (green << 6) | blue;
+}
+
+/**@brief   Compares the whole screen against the given pixels of an image drawn at (x, y), as 18 bit values, where
+ *          only the pixels within the given Clip Rectangle (as {x0, y0, x1, y1} with x1 and y1 exclusive) may differ
+ *          from the background.
+ *
+ * @return  The number of visible pixels of the image.
+ */
+static uint32_t check_frame(int width, int height, const uint32_t *p_rgb666, int x, int y, const int *p_clip)
+{
+    uint32_t mismatches = 0;
+    uint32_t visible = 0;
+    for (int py = 0; py < ILI9341_SCREEN_HEIGHT; py++)
+    {
+        for (int px = 0; px < ILI9341_SCREEN_WIDTH; px++)
+        {
+            int sx = px - x;
+            int sy = py - y;
+            uint32_t expected = test_rgb565_to_rgb666(BACKGROUND);
+            if ((px >= p_clip[0]) && (px < p_clip[2]) && (py >= p_clip[1]) && (py < p_clip[3]) && (sx >= 0) && (sy >= 0) && (sx < width) && (sy < height))
+            {
+                expected = p_rgb666[sy * width + sx];
+                visible++;
+            }
+            uint32_t actual = ili9341_panel_model_get_pixel(&test_panel[0], px, py);
+            if (actual != expected)
+            {
+                if (mismatches < 4)
+                {
+                    printf("  image at (%d, %d): pixel (%d, %d) is 0x%05X, expected 0x%05X\n", x, y, px, py, (unsigned) actual, (unsigned) expected);
+                }
+                mismatches++;
+            }
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+    return visible;
+}
+
+static ILI9341_Status draw(const ILI9341_qoi_image_t *p_image, int x, int y)
+{
+    test_sync(&test_lcd[0]);
+    ili9341_panel_model_fill_gram(&test_panel[0], test_rgb565_to_rgb666(BACKGROUND));
+    ILI9341_Status ret = ili9341_draw_qoi_image(&test_lcd[0], (int16_t) x, (int16_t) y, p_image);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    return ret;
+}
+
+static void check_image(const ILI9341_qoi_image_t *p_image, const test_source_image_t *p_source, int x, int y, const int *p_clip)
+{
+    static uint32_t expected[ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT];
+    ILI9341_BPP_t panel_bpp = get_ili9341_bpp_type(&test_lcd[0]);
+    TEST_CHECK_EQ(p_image->width, p_source->width);
+    TEST_CHECK_EQ(p_image->height, p_source->height);
+    for (uint32_t i = 0; i < (uint32_t) p_source->width * p_source->height; i++)
+    {
+        expected[i] = expected_rgb666(p_source->p_argb[i], p_image->bpp_type, panel_bpp);
+    }
+    ILI9341_Status ret = draw(p_image, x, y);
+    uint32_t visible = check_frame(p_source->width, p_source->height, expected, x, y, p_clip);
+    TEST_CHECK_EQ(ret, (visible > 0) ? ILI9341_EC_OK : ILI9341_EC_NA);
+    /* The whole visible part is written with a single Address Window. */
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, visible);
+    TEST_CHECK_EQ(test_panel[0].stats.commands[0x2C], (visible > 0) ? 1 : 0);
+}
+
+/**@brief   Draws hand-made 16 bits per pixel operations of @ref CORRUPT_WIDTH x @ref CORRUPT_HEIGHT pixels whose
+ *          first \p decoded_pixels pixels are valid, and checks that the rest of them are drawn in black.
+ */
+static void check_corrupt(const uint8_t *p_data, uint32_t size, const uint16_t *p_decoded, uint32_t decoded_pixels)
+{
+    ILI9341_qoi_image_t image = {CORRUPT_WIDTH, CORRUPT_HEIGHT, ILI9341_BPP_16, size, p_data};
+    uint32_t expected[CORRUPT_WIDTH * CORRUPT_HEIGHT] = {0};
+    const int screen[4] = {0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT};
+    for (uint32_t i = 0; i < decoded_pixels; i++)
+    {
+        expected[i] = test_rgb565_to_rgb666(p_decoded[i]);
+    }
+    TEST_CHECK_EQ(draw(&image, 50, 60), ILI9341_EC_ERR);
+    check_frame(CORRUPT_WIDTH, CORRUPT_HEIGHT, expected, 50, 60, screen);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, CORRUPT_WIDTH * CORRUPT_HEIGHT);
+}
+
+int main(void)
+{
+    const ILI9341_qoi_image_t *images[6] = {&photo_ppm_qoi_16, &photo_ppm_qoi_18, &illustration_png_qoi_16, &illustration_png_qoi_18,
+                                            &mixed_ppm_qoi_16, &mixed_ppm_qoi_18};
+    const test_source_image_t *sources[6] = {&photo_ppm_source, &photo_ppm_source, &illustration_png_source, &illustration_png_source,
+                                             &mixed_ppm_source, &mixed_ppm_source};
+    const ILI9341_BPP_t panel_bpps[2] = {ILI9341_BPP_16, ILI9341_BPP_18};
+    const int positions[4][2] = {{0, 0}, {-13, -7}, {100, 250}, {230, 2}};
+    const int screen[4] = {0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT};
+    const int clip[4] = {5, 10, 205, 300};
+    test_begin(NULL, 1);
+
+    for (int b = 0; b < 2; b++)
+    {
+        TEST_CHECK_EQ(set_ili9341_bpp_type(&test_lcd[0], panel_bpps[b]), ILI9341_EC_OK);
+        for (int i = 0; i < 6; i++)
+        {
+            for (int p = 0; p < 4; p++)
+            {
+                check_image(images[i], sources[i], positions[p][0], positions[p][1], screen);
+            }
+            TEST_CHECK_EQ(ili9341_set_clip_rect(&test_lcd[0], (int16_t) clip[0], (int16_t) clip[1], (uint16_t) (clip[2] - clip[0]),
+                                                (uint16_t) (clip[3] - clip[1])), ILI9341_EC_OK);
+            check_image(images[i], sources[i], -13, -7, clip);
+            ili9341_reset_clip_rect(&test_lcd[0]);
+        }
+    }
+    TEST_CHECK_EQ(set_ili9341_bpp_type(&test_lcd[0], ILI9341_BPP_16), ILI9341_EC_OK);
+
+    /* A red pixel repeated 4 times, a green one and then a luma operation without its second byte. */
+    const uint16_t decoded[5] = {0xF800, 0xF800, 0xF800, 0xF800, 0x07E0};
+    const uint8_t cut_luma[8] = {0xFE, 0xF8, 0x00, 0xC2, 0xFE, 0x07, 0xE0, 0xA0};
+    check_corrupt(cut_luma, 8, decoded, 5);
+    /* The operations end right after the first 5 pixels. */
+    check_corrupt(cut_luma, 7, decoded, 5);
+    /* A pixel operation without all of its bytes. */
+    check_corrupt(cut_luma, 6, decoded, 4);
+    /* An empty stream. */
+    check_corrupt(cut_luma, 0, decoded, 0);
+
+    /* A valid image whose size has been truncated in the middle of its operations: its pixels are drawn up to the
+     * first one that could not be decoded, and in black from there on. */
+    ILI9341_qoi_image_t truncated = photo_ppm_qoi_18;
+    truncated.size = photo_ppm_qoi_18.size / 2;
+    TEST_CHECK_EQ(draw(&truncated, 0, 0), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, photo_ppm_qoi_18.width * photo_ppm_qoi_18.height);
+    uint32_t decoded_pixels = 0;
+    uint32_t not_black = 0;
+    for (uint32_t i = 0; i < (uint32_t) photo_ppm_qoi_18.width * photo_ppm_qoi_18.height; i++)
+    {
+        uint32_t actual = ili9341_panel_model_get_pixel(&test_panel[0], (int) (i % photo_ppm_qoi_18.width), (int) (i / photo_ppm_qoi_18.width));
+        if ((decoded_pixels == i) && (actual == expected_rgb666(photo_ppm_source.p_argb[i], ILI9341_BPP_18, ILI9341_BPP_16)))
+        {
+            decoded_pixels++;
+        }
+        else
+        {
+            not_black += actual != 0;
+        }
+    }
+    TEST_CHECK(decoded_pixels > 0);
+    TEST_CHECK(decoded_pixels < (uint32_t) photo_ppm_qoi_18.width * photo_ppm_qoi_18.height);
+    TEST_CHECK_EQ(not_black, 0);
+
+    ILI9341_qoi_image_t invalid_bpp = mixed_ppm_qoi_16;
+    invalid_bpp.bpp_type = (ILI9341_BPP_t) 0xFF;
+    TEST_CHECK_EQ(ili9341_draw_qoi_image(&test_lcd[0], 0, 0, &invalid_bpp), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_draw_qoi_image(&test_lcd[0], 240, 0, &mixed_ppm_qoi_16), ILI9341_EC_NA);
+    TEST_CHECK_EQ(ili9341_draw_qoi_image(&test_lcd[0], 0, 0, NULL), ILI9341_EC_ERR);
+    return test_end("test_qoi_images");
+}
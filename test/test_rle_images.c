@@ -0,0 +1,157 @@
+/**@file
+ * @brief	Checks that the Run-Length Encoded images written by "tools/ili9341_image_encoder.py" draw, through
+ *          @ref ili9341_draw_rle_image , the very pixels of the PPM images from which they were encoded, and that
+ *          corrupt or truncated token streams are reported.
+ *
+ * @details The images are drawn over a known background, partly outside of the screen and of a Clip Rectangle, where
+ *          every visible pixel must show its source pixel and every other pixel must keep the background. Whenever the
+ *          tokens of an image end too early (i.e., a literal token without all of its pixels, a run token without its
+ *          pixel or no token at all), the pixels decoded up to that point must still be drawn, the rest of the image
+ *          must be drawn in black and @ref ILI9341_EC_ERR must be returned.
+ */
+
+#include "ili9341_images.h"
+#include "ili9341_test.h"
+
+#define BACKGROUND      (0x1234)    /**< @brief Color that fills the screen before each image is drawn. */
+#define CORRUPT_WIDTH   (8)         /**< @brief Width of the hand-made token streams of this test. */
+#define CORRUPT_HEIGHT  (2)         /**< @brief Height of the hand-made token streams of this test. */
+
+extern const ILI9341_rle_image_t background_ppm_rle, noise_ppm_rle, small_ppm_rle;
+extern const test_source_image_t background_ppm_source, noise_ppm_source, small_ppm_source;
+
+/**@brief   Compares the whole screen against the given pixels of an image drawn at (x, y), where only the pixels within
+ *          the given Clip Rectangle (as {x0, y0, x1, y1} with x1 and y1 exclusive) may differ from the background.
+ *
+ * @return  The number of visible pixels of the image.
+ */
+static uint32_t check_frame(int width, int height, const uint32_t *p_argb, const uint16_t *p_rgb565, int x, int y, const int *p_clip)
+{
+    uint32_t mismatches = 0;
+    uint32_t visible = 0;
+    for (int py = 0; py < ILI9341_SCREEN_HEIGHT; py++)
+    {
+        for (int px = 0; px < ILI9341_SCREEN_WIDTH; px++)
+        {
+            int sx = px - x;
+            int sy = py - y;
+            uint16_t expected = BACKGROUND;
+            if ((px >= p_clip[0]) && (px < p_clip[2]) && (py >= p_clip[1]) && (py < p_clip[3]) && (sx >= 0) && (sy >= 0) && (sx < width) && (sy < height))
+            {
+                expected = (p_argb != NULL) ? test_argb_to_rgb565(p_argb[sy * width + sx]) : p_rgb565[sy * width + sx];
+                visible++;
+            }
+            uint16_t actual = ili9341_panel_model_get_pixel_565(&test_panel[0], (uint16_t) px, (uint16_t) py);
+            if (actual != expected)
+            {
+                if (mismatches < 4)
+                {
+                    printf("  image at (%d, %d): pixel (%d, %d) is 0x%04X, expected 0x%04X\n", x, y, px, py, actual, expected);
+                }
+                mismatches++;
+            }
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+    return visible;
+}
+
+static ILI9341_Status draw(const ILI9341_rle_image_t *p_image, int x, int y)
+{
+    test_sync(&test_lcd[0]);
+    ili9341_panel_model_fill_gram(&test_panel[0], test_rgb565_to_rgb666(BACKGROUND));
+    ILI9341_Status ret = ili9341_draw_rle_image(&test_lcd[0], (int16_t) x, (int16_t) y, p_image);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    return ret;
+}
+
+static void check_image(const ILI9341_rle_image_t *p_image, const test_source_image_t *p_source, int x, int y, const int *p_clip)
+{
+    TEST_CHECK_EQ(p_image->width, p_source->width);
+    TEST_CHECK_EQ(p_image->height, p_source->height);
+    ILI9341_Status ret = draw(p_image, x, y);
+    uint32_t visible = check_frame(p_source->width, p_source->height, p_source->p_argb, NULL, x, y, p_clip);
+    TEST_CHECK_EQ(ret, (visible > 0) ? ILI9341_EC_OK : ILI9341_EC_NA);
+    /* The whole visible part is written with a single Address Window. */
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, visible);
+    TEST_CHECK_EQ(test_panel[0].stats.commands[0x2C], (visible > 0) ? 1 : 0);
+}
+
+/**@brief   Draws a hand-made token stream of @ref CORRUPT_WIDTH x @ref CORRUPT_HEIGHT pixels whose first
+ *          \p decoded_pixels pixels are valid, and checks that the rest of them are drawn in black.
+ */
+static void check_corrupt(const uint16_t *p_data, uint32_t size, const uint16_t *p_decoded, uint32_t decoded_pixels)
+{
+    ILI9341_rle_image_t image = {CORRUPT_WIDTH, CORRUPT_HEIGHT, size, p_data};
+    uint16_t expected[CORRUPT_WIDTH * CORRUPT_HEIGHT] = {0};
+    const int screen[4] = {0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT};
+    for (uint32_t i = 0; i < decoded_pixels; i++)
+    {
+        expected[i] = p_decoded[i];
+    }
+    TEST_CHECK_EQ(draw(&image, 50, 60), ILI9341_EC_ERR);
+    check_frame(CORRUPT_WIDTH, CORRUPT_HEIGHT, NULL, expected, 50, 60, screen);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, CORRUPT_WIDTH * CORRUPT_HEIGHT);
+}
+
+int main(void)
+{
+    const ILI9341_rle_image_t *images[3] = {&background_ppm_rle, &noise_ppm_rle, &small_ppm_rle};
+    const test_source_image_t *sources[3] = {&background_ppm_source, &noise_ppm_source, &small_ppm_source};
+    const int positions[5][2] = {{0, 0}, {-13, -7}, {100, 250}, {230, 2}, {-30, 300}};
+    const int screen[4] = {0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT};
+    const int clip[4] = {5, 10, 205, 300};
+    test_begin(NULL, 1);
+
+    for (int i = 0; i < 3; i++)
+    {
+        for (int p = 0; p < 5; p++)
+        {
+            check_image(images[i], sources[i], positions[p][0], positions[p][1], screen);
+            TEST_CHECK_EQ(ili9341_set_clip_rect(&test_lcd[0], (int16_t) clip[0], (int16_t) clip[1], (uint16_t) (clip[2] - clip[0]),
+                                                (uint16_t) (clip[3] - clip[1])), ILI9341_EC_OK);
+            check_image(images[i], sources[i], positions[p][0], positions[p][1], clip);
+            ili9341_reset_clip_rect(&test_lcd[0]);
+        }
+    }
+
+    /* A run of 10 pixels followed by a literal of 5, so that the last pixel of the image is missing. */
+    const uint16_t decoded[15] = {0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0xF800, 0x001F, 0xFFFF, 0x1111, 0x2222};
+    const uint16_t missing_pixel[8] = {0x8009, 0x07E0, 0x0004, 0xF800, 0x001F, 0xFFFF, 0x1111, 0x2222};
+    check_corrupt(missing_pixel, 8, decoded, 15);
+    /* A literal token that claims more pixels than the stream holds. */
+    const uint16_t short_literal[5] = {0x8009, 0x07E0, 0x0010, 0xF800, 0x001F};
+    check_corrupt(short_literal, 5, decoded, 10);
+    /* A run token without its pixel. */
+    const uint16_t short_run[3] = {0x8009, 0x07E0, 0x8005};
+    check_corrupt(short_run, 3, decoded, 10);
+    /* A valid image whose size has been truncated in the middle of a token: its pixels are drawn up to the first one
+     * that could not be decoded, and in black from there on. */
+    ILI9341_rle_image_t truncated = background_ppm_rle;
+    truncated.size = background_ppm_rle.size / 2;
+    TEST_CHECK_EQ(draw(&truncated, 0, 0), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, background_ppm_rle.width * background_ppm_rle.height);
+    uint32_t decoded_pixels = 0;
+    uint32_t not_black = 0;
+    for (uint32_t i = 0; i < (uint32_t) background_ppm_rle.width * background_ppm_rle.height; i++)
+    {
+        uint16_t actual = ili9341_panel_model_get_pixel_565(&test_panel[0], (uint16_t) (i % background_ppm_rle.width), (uint16_t) (i / background_ppm_rle.width));
+        if ((decoded_pixels == i) && (actual == test_argb_to_rgb565(background_ppm_source.p_argb[i])))
+        {
+            decoded_pixels++;
+        }
+        else
+        {
+            not_black += actual != 0x0000;
+        }
+    }
+    TEST_CHECK(decoded_pixels > 0);
+    TEST_CHECK(decoded_pixels < (uint32_t) background_ppm_rle.width * background_ppm_rle.height);
+    TEST_CHECK_EQ(not_black, 0);
+    /* An empty stream. */
+    check_corrupt(short_run, 0, decoded, 0);
+
+    TEST_CHECK_EQ(ili9341_draw_rle_image(&test_lcd[0], 240, 0, &background_ppm_rle), ILI9341_EC_NA);
+    TEST_CHECK_EQ(ili9341_draw_rle_image(&test_lcd[0], 0, 0, NULL), ILI9341_EC_ERR);
+    return test_end("test_rle_images");
+}
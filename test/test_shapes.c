@@ -0,0 +1,264 @@
+/**@file
+ * @brief	Checks the ellipses, circles, arcs, ring sectors and rounded rectangles of the @ref ili9341_graphics against
+ *          a per-pixel reference rasterizer.
+ *
+ * @details The reference decides whether each pixel lies inside of an ellipse whose radii are half a pixel longer than
+ *          the requested ones, which is the definition that the @ref ili9341_graphics follows, and takes the outline
+ *          of a shape as its inside pixels that have an outside pixel as one of their 4 neighbours. The angles of the
+ *          arcs are only checked loosely, since the @ref ili9341_graphics walks them with integer sines, so a mismatch
+ *          is tolerated for the pixels that lie within @ref ANGLE_TOLERANCE pixels of either of their limiting rays. Every
+ *          shape must also send each of its pixels exactly once.
+ */
+
+#include "ili9341_graphics.h"
+#include "ili9341_test.h"
+#include <math.h>   // This library contains the functions: cos and sin.
+#include <stdlib.h> // This library contains the functions: rand and srand.
+
+#define ANGLE_TOLERANCE     (0.6)   /**< @brief Distance, in pixels, from a limiting ray of an arc within which a mismatch is tolerated. */
+#define PI                  (3.14159265358979323846)    /**< @brief Ratio of the circumference of a circle to its diameter. */
+
+/**@brief   Shape that the reference is currently rasterizing.
+ */
+typedef enum
+{
+    SHAPE_FILLED = 0,       //!< The whole inside of an ellipse or of a rounded rectangle.
+    SHAPE_OUTLINE = 1,      //!< The outline of an ellipse or of a rounded rectangle.
+    SHAPE_ARC = 2,          //!< The part of the outline of a circle that lies within the angles of an arc.
+    SHAPE_RING_SECTOR = 3   //!< The part of a ring that lies within the angles of an arc.
+} shape_t;
+
+static int is_round_rect;
+static long rect_x, rect_y, rect_width, rect_height, rect_radius;
+static long center_x, center_y, radius_x, radius_y, inner_radius;
+static double start_angle, end_angle;
+
+static int is_in_ellipse(long dx, long dy, long rx, long ry)
+{
+    long tx = (2 * rx + 1) * (2 * rx + 1);
+    long ty = (2 * ry + 1) * (2 * ry + 1);
+    return 4 * dx * dx * ty + 4 * dy * dy * tx <= tx * ty;
+}
+
+static int is_in_shape(long x, long y)
+{
+    if (!is_round_rect)
+    {
+        return is_in_ellipse(x - center_x, y - center_y, radius_x, radius_y);
+    }
+    if ((x < rect_x) || (x >= rect_x + rect_width) || (y < rect_y) || (y >= rect_y + rect_height))
+    {
+        return 0;
+    }
+    long r = rect_radius;
+    r = (r > (rect_width - 1) / 2) ? (rect_width - 1) / 2 : r;
+    r = (r > (rect_height - 1) / 2) ? (rect_height - 1) / 2 : r;
+    long left = rect_x + r;
+    long top = rect_y + r;
+    long right = rect_x + rect_width - 1 - r;
+    long bottom = rect_y + rect_height - 1 - r;
+    long cx = (x < left) ? left : ((x > right) ? right : x);
+    long cy = (y < top) ? top : ((y > bottom) ? bottom : y);
+    return is_in_ellipse(x - cx, y - cy, r, r);
+}
+
+static int is_on_outline(long x, long y)
+{
+    return is_in_shape(x, y) && (!is_in_shape(x + 1, y) || !is_in_shape(x - 1, y) || !is_in_shape(x, y + 1) || !is_in_shape(x, y - 1));
+}
+
+/**@brief   Gets the signed distances of a pixel from both limiting rays of the current arc, which are positive on the
+ *          side of each ray that lies within the arc.
+ */
+static void get_ray_distances(long x, long y, double *p_start, double *p_end)
+{
+    double dx = (double) (x - center_x);
+    double dy = (double) (y - center_y);
+    *p_start = cos(start_angle) * dy - sin(start_angle) * dx;
+    *p_end = dx * sin(end_angle) - dy * cos(end_angle);
+}
+
+static int is_in_sector(long x, long y, double margin)
+{
+    double from_start;
+    double from_end;
+    get_ray_distances(x, y, &from_start, &from_end);
+    if (end_angle - start_angle > PI)
+    {
+        return (from_start >= margin) || (from_end >= margin);
+    }
+    return (from_start >= margin) && (from_end >= margin);
+}
+
+static int is_expected(shape_t shape, long x, long y)
+{
+    switch (shape)
+    {
+        case SHAPE_FILLED:
+            return is_in_shape(x, y);
+        case SHAPE_OUTLINE:
+            return is_on_outline(x, y);
+        case SHAPE_ARC:
+            return is_on_outline(x, y) && is_in_sector(x, y, 0.0);
+        default:
+            return is_in_ellipse(x - center_x, y - center_y, radius_x, radius_x)
+                   && !((inner_radius > 0) && is_in_ellipse(x - center_x, y - center_y, inner_radius, inner_radius)) && is_in_sector(x, y, 0.0);
+    }
+}
+
+/**@brief   Compares the Frame Memory against the reference for a shape that was drawn in white over black, and checks
+ *          that it sent each of its pixels exactly once.
+ */
+static void check_shape(shape_t shape, const char *name)
+{
+    uint32_t mismatches = 0;
+    uint32_t lit = 0;
+    for (long y = 0; y < ILI9341_SCREEN_HEIGHT; y++)
+    {
+        for (long x = 0; x < ILI9341_SCREEN_WIDTH; x++)
+        {
+            int expected = is_expected(shape, x, y);
+            int actual = ili9341_panel_model_get_pixel_565(&test_panel[0], (uint16_t) x, (uint16_t) y) == 0xFFFF;
+            lit += (uint32_t) actual;
+            if (expected == actual)
+            {
+                continue;
+            }
+            /* Near the limiting rays of an arc, the inside and the outside are only checked ANGLE_TOLERANCE apart. */
+            if ((shape >= SHAPE_ARC) && (is_in_sector(x, y, -ANGLE_TOLERANCE) != is_in_sector(x, y, ANGLE_TOLERANCE)))
+            {
+                continue;
+            }
+            if (mismatches < 4)
+            {
+                printf("  %s: pixel (%ld, %ld) is %d instead of %d\n", name, x, y, actual, expected);
+            }
+            mismatches++;
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, lit);
+}
+
+static void clear(void)
+{
+    test_sync(&test_lcd[0]);
+    ili9341_panel_model_fill_gram(&test_panel[0], 0);
+}
+
+static void set_angles(int start, int end)
+{
+    start_angle = start * PI / 180.0;
+    end_angle = ((end - start) >= 360) ? (start_angle + 2.0 * PI - 1e-9) : (end * PI / 180.0);
+}
+
+int main(void)
+{
+    ILI9341_handle_t *p_lcd = &test_lcd[0];
+    ILI9341_COLOR white;
+    white.bpp_16 = 0xFFFF;
+    test_begin(NULL, 1);
+    srand(5);
+
+    /* Ellipses and circles, from a radius of zero (i.e., a single pixel or a single row) up to beyond the screen. */
+    is_round_rect = 0;
+    for (int round = 0; round < 200; round++)
+    {
+        center_x = rand() % 300 - 30;
+        center_y = rand() % 380 - 30;
+        radius_x = (round < 8) ? (round & 1) : rand() % ((round < 100) ? 60 : 200);
+        radius_y = (round & 1) ? radius_x : ((round < 8) ? 0 : rand() % 200);
+        clear();
+        ili9341_fill_ellipse(p_lcd, (int16_t) center_x, (int16_t) center_y, (uint16_t) radius_x, (uint16_t) radius_y, white);
+        TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+        check_shape(SHAPE_FILLED, "fill_ellipse");
+        clear();
+        ili9341_draw_ellipse(p_lcd, (int16_t) center_x, (int16_t) center_y, (uint16_t) radius_x, (uint16_t) radius_y, white);
+        TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+        check_shape(SHAPE_OUTLINE, "draw_ellipse");
+        if (radius_x == radius_y)
+        {
+            clear();
+            ili9341_fill_circle(p_lcd, (int16_t) center_x, (int16_t) center_y, (uint16_t) radius_x, white);
+            TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+            check_shape(SHAPE_FILLED, "fill_circle");
+            clear();
+            ili9341_draw_circle(p_lcd, (int16_t) center_x, (int16_t) center_y, (uint16_t) radius_x, white);
+            TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+            check_shape(SHAPE_OUTLINE, "draw_circle");
+        }
+    }
+
+    /* Rounded rectangles, including radii of zero, 1 pixel wide or high rectangles and radii that must be reduced. */
+    is_round_rect = 1;
+    for (int round = 0; round < 200; round++)
+    {
+        rect_x = rand() % 260 - 20;
+        rect_y = rand() % 340 - 20;
+        rect_width = (round % 7 == 0) ? 1 : 1 + rand() % 120;
+        rect_height = (round % 7 == 1) ? 1 : 1 + rand() % 120;
+        rect_radius = (round % 5 == 0) ? 0 : rand() % 70;
+        clear();
+        ili9341_fill_round_rect(p_lcd, (int16_t) rect_x, (int16_t) rect_y, (uint16_t) rect_width, (uint16_t) rect_height, (uint16_t) rect_radius, white);
+        TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+        check_shape(SHAPE_FILLED, "fill_round_rect");
+        clear();
+        ili9341_draw_round_rect(p_lcd, (int16_t) rect_x, (int16_t) rect_y, (uint16_t) rect_width, (uint16_t) rect_height, (uint16_t) rect_radius, white);
+        TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+        check_shape(SHAPE_OUTLINE, "draw_round_rect");
+    }
+
+    /* Arcs and ring sectors, including the ones that cross 0 (i.e., 360) degrees and the ones that sweep it whole. */
+    is_round_rect = 0;
+    const int fixed_angles[][2] = {{315, 405}, {-45, 45}, {350, 370}, {270, 630}, {0, 360}, {-360, 0}, {135, 405}, {90, 91}};
+    for (int round = 0; round < 200; round++)
+    {
+        int start;
+        int end;
+        if (round < 8)
+        {
+            start = fixed_angles[round][0];
+            end = fixed_angles[round][1];
+        }
+        else
+        {
+            start = rand() % 720 - 360;
+            end = start + 1 + rand() % 400;
+        }
+        center_x = (round < 8) ? 120 : rand() % 240;
+        center_y = (round < 8) ? 160 : rand() % 320;
+        radius_x = (round < 8) ? 90 : rand() % 150;
+        radius_y = radius_x;
+        inner_radius = (round & 1) ? (rand() % (radius_x + 1)) : 0;
+        set_angles(start, end);
+        clear();
+        ili9341_draw_arc(p_lcd, (int16_t) center_x, (int16_t) center_y, (uint16_t) radius_x, (int16_t) start, (int16_t) end, white);
+        TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+        check_shape(SHAPE_ARC, "draw_arc");
+        if (inner_radius < radius_x)
+        {
+            clear();
+            ili9341_fill_arc(p_lcd, (int16_t) center_x, (int16_t) center_y, (uint16_t) inner_radius, (uint16_t) radius_x, (int16_t) start, (int16_t) end, white);
+            TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+            check_shape(SHAPE_RING_SECTOR, "fill_arc");
+        }
+    }
+
+    /* The arcs that cross 0 degrees are the same as the ones given with the equivalent angles. */
+    clear();
+    TEST_CHECK_EQ(ili9341_draw_arc(p_lcd, 120, 160, 100, -30, 30, white), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    uint32_t negative_pixels = test_panel[0].stats.pixels;
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(&test_panel[0], 220, 160), 0xFFFF);
+    clear();
+    TEST_CHECK_EQ(ili9341_draw_arc(p_lcd, 120, 160, 100, 330, 390, white), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, negative_pixels);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(&test_panel[0], 220, 160), 0xFFFF);
+
+    TEST_CHECK_EQ(ili9341_draw_circle(p_lcd, 0, 0, 20000, white), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_fill_arc(p_lcd, 0, 0, 5, 5, 0, 90, white), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_draw_arc(p_lcd, 0, 0, 5, 90, 90, white), ILI9341_EC_NA);
+    TEST_CHECK_EQ(ili9341_fill_round_rect(p_lcd, 0, 0, 0, 5, 1, white), ILI9341_EC_NA);
+    return test_end("test_shapes");
+}
@@ -0,0 +1,92 @@
+/**@file
+ * @brief	Checks that the sprites written by "tools/ili9341_image_encoder.py" draw, through
+ *          @ref ili9341_draw_sprite , the very pixels of the PNG and PPM images from which they were encoded.
+ *
+ * @details The images are an RGBA PNG whose alpha lies on both sides of the default threshold of 128, a PPM whose
+ *          magenta pixels are the color key and a 4-bit palette PNG whose first palette entry is transparent. Each of
+ *          them is drawn over a known background, partly outside of the screen and of a Clip Rectangle, where every
+ *          opaque pixel must show its source pixel and every other pixel must keep the background.
+ */
+
+#include "ili9341_images.h"
+#include "ili9341_test.h"
+
+#define BACKGROUND      (0x1234)    /**< @brief Color that fills the screen before each sprite is drawn. */
+#define KEY_COLOR       (0xFF00FFU) /**< @brief Color key with which the PPM image was encoded, as 0xRRGGBB. */
+
+extern const ILI9341_sprite_t rgba_png_sprite, key_ppm_sprite, pal4_png_sprite;
+extern const test_source_image_t rgba_png_source, key_ppm_source, pal4_png_source;
+
+static int is_opaque(uint32_t argb, int is_keyed)
+{
+    return ((argb >> 24) >= 128) && !(is_keyed && ((argb & 0xFFFFFF) == KEY_COLOR));
+}
+
+/**@brief   Draws the given sprite over the background and compares the whole screen against its source image, where
+ *          only the pixels within the given Clip Rectangle (as {x0, y0, x1, y1} with x1 and y1 exclusive) may change.
+ */
+static void check_sprite(const ILI9341_sprite_t *p_sprite, const test_source_image_t *p_source, int is_keyed, int x, int y, const int *p_clip)
+{
+    uint32_t mismatches = 0;
+    uint32_t opaque = 0;
+    TEST_CHECK_EQ(p_sprite->width, p_source->width);
+    TEST_CHECK_EQ(p_sprite->height, p_source->height);
+    test_sync(&test_lcd[0]);
+    ili9341_panel_model_fill_gram(&test_panel[0], test_rgb565_to_rgb666(BACKGROUND));
+    ILI9341_Status ret = ili9341_draw_sprite(&test_lcd[0], (int16_t) x, (int16_t) y, p_sprite);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+
+    for (int py = 0; py < ILI9341_SCREEN_HEIGHT; py++)
+    {
+        for (int px = 0; px < ILI9341_SCREEN_WIDTH; px++)
+        {
+            int sx = px - x;
+            int sy = py - y;
+            uint16_t expected = BACKGROUND;
+            if ((px >= p_clip[0]) && (px < p_clip[2]) && (py >= p_clip[1]) && (py < p_clip[3]) && (sx >= 0) && (sy >= 0) && (sx < p_source->width)
+                && (sy < p_source->height) && is_opaque(p_source->p_argb[sy * p_source->width + sx], is_keyed))
+            {
+                expected = test_argb_to_rgb565(p_source->p_argb[sy * p_source->width + sx]);
+                opaque++;
+            }
+            uint16_t actual = ili9341_panel_model_get_pixel_565(&test_panel[0], (uint16_t) px, (uint16_t) py);
+            if (actual != expected)
+            {
+                if (mismatches < 4)
+                {
+                    printf("  sprite at (%d, %d): pixel (%d, %d) is 0x%04X, expected 0x%04X\n", x, y, px, py, actual, expected);
+                }
+                mismatches++;
+            }
+        }
+    }
+    TEST_CHECK_EQ(mismatches, 0);
+    /* Transparent pixels are never sent. */
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, opaque);
+    TEST_CHECK_EQ(ret, (opaque > 0) ? ILI9341_EC_OK : ILI9341_EC_NA);
+}
+
+int main(void)
+{
+    const ILI9341_sprite_t *sprites[3] = {&rgba_png_sprite, &key_ppm_sprite, &pal4_png_sprite};
+    const test_source_image_t *sources[3] = {&rgba_png_source, &key_ppm_source, &pal4_png_source};
+    const int positions[5][2] = {{10, 10}, {-5, -7}, {220, 300}, {100, 200}, {-40, 0}};
+    const int screen[4] = {0, 0, ILI9341_SCREEN_WIDTH, ILI9341_SCREEN_HEIGHT};
+    const int clip[4] = {105, 210, 125, 220};
+    test_begin(NULL, 1);
+
+    for (int i = 0; i < 3; i++)
+    {
+        for (int p = 0; p < 5; p++)
+        {
+            check_sprite(sprites[i], sources[i], sprites[i] == &key_ppm_sprite, positions[p][0], positions[p][1], screen);
+        }
+        TEST_CHECK_EQ(ili9341_set_clip_rect(&test_lcd[0], (int16_t) clip[0], (int16_t) clip[1], (uint16_t) (clip[2] - clip[0]),
+                                            (uint16_t) (clip[3] - clip[1])), ILI9341_EC_OK);
+        check_sprite(sprites[i], sources[i], sprites[i] == &key_ppm_sprite, 100, 200, clip);
+        ili9341_reset_clip_rect(&test_lcd[0]);
+    }
+
+    TEST_CHECK_EQ(ili9341_draw_sprite(&test_lcd[0], 0, 0, NULL), ILI9341_EC_ERR);
+    return test_end("test_sprites");
+}
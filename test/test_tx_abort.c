@@ -0,0 +1,83 @@
+/**@file
+ * @brief	Checks that an SPI error that aborts the SPI Transfer Queue makes the @ref ili9341 send the whole Address
+ *          Window again, for every ILI9341 Device whose segments were dropped.
+ *
+ * @details The shadow copies of the Address Window are updated when its segments are queued. Therefore, whenever
+ *          those segments are dropped by an SPI error, the next @ref ili9341_set_window with the very same Address
+ *          Window must not rely on them and must send the Column Address Set, Page Address Set and Memory Write again.
+ */
+
+#include "ili9341_test.h"
+
+#define WINDOW_SIZE     (10)    /**< @brief Width and height of the Address Windows of this test. */
+
+static uint16_t pixels[TEST_DEVICE_COUNT][WINDOW_SIZE * WINDOW_SIZE];
+
+static void queue_window(int device, uint16_t x, uint16_t y)
+{
+    ili9341_set_window(&test_lcd[device], x, y, x + WINDOW_SIZE - 1, y + WINDOW_SIZE - 1);
+    ili9341_write_pixels_16bpp(&test_lcd[device], pixels[device], WINDOW_SIZE * WINDOW_SIZE, NULL);
+}
+
+static void check_window_sent(int device, uint16_t x, uint16_t y)
+{
+    const ili9341_panel_model_t *p_panel = &test_panel[device];
+    TEST_CHECK_EQ(p_panel->trace_count, 3);
+    TEST_CHECK_EQ(p_panel->trace[0].command, 0x2A);
+    TEST_CHECK_EQ(p_panel->trace[0].params[1], x);
+    TEST_CHECK_EQ(p_panel->trace[1].command, 0x2B);
+    TEST_CHECK_EQ(p_panel->trace[1].params[1], y);
+    TEST_CHECK_EQ(p_panel->trace[2].command, 0x2C);
+    TEST_CHECK_EQ(p_panel->stats.pixels, WINDOW_SIZE * WINDOW_SIZE);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(p_panel, x, y), pixels[device][0]);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(p_panel, x + WINDOW_SIZE - 1, y + WINDOW_SIZE - 1), pixels[device][WINDOW_SIZE * WINDOW_SIZE - 1]);
+}
+
+int main(void)
+{
+    test_begin(NULL, TEST_DEVICE_COUNT);
+    for (int d = 0; d < TEST_DEVICE_COUNT; d++)
+    {
+        for (int i = 0; i < WINDOW_SIZE * WINDOW_SIZE; i++)
+        {
+            pixels[d][i] = (uint16_t) (0x1000 * (d + 1) + i);
+        }
+    }
+
+    /* Without errors, the same Address Window only needs its Memory Write to be sent again. */
+    queue_window(0, 10, 20);
+    test_sync(&test_lcd[0]);
+    queue_window(0, 10, 20);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    TEST_CHECK_EQ(test_panel[0].trace_count, 1);
+    TEST_CHECK_EQ(test_panel[0].trace[0].command, 0x2C);
+    test_sync(&test_lcd[0]);
+
+    /* Queue a new Address Window on both ILI9341 Devices with the interrupts disabled, so that all of their segments
+     * are still in the SPI Transfer Queue when the first DMA transfer fails and aborts it. */
+    host_hal_inject_dma_errors(0, 1);
+    __disable_irq();
+    queue_window(0, 30, 40);
+    queue_window(1, 50, 60);
+    __enable_irq();
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[1]), ILI9341_EC_ERR);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels + test_panel[1].stats.pixels, 0);
+    for (int d = 0; d < TEST_DEVICE_COUNT; d++)
+    {
+        TEST_CHECK_EQ(test_lcd[d].window_shadow.is_column_valid, 0);
+        TEST_CHECK_EQ(test_lcd[d].window_shadow.is_page_valid, 0);
+        TEST_CHECK_EQ(test_lcd[d].is_memory_write_open, 0);
+    }
+    test_sync(&test_lcd[1]);
+
+    /* Requesting the very same Address Windows again must send them in full. */
+    queue_window(0, 30, 40);
+    queue_window(1, 50, 60);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[0]), ILI9341_EC_OK);
+    TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[1]), ILI9341_EC_OK);
+    check_window_sent(0, 30, 40);
+    check_window_sent(1, 50, 60);
+
+    return test_end("test_tx_abort");
+}
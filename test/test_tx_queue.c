@@ -0,0 +1,133 @@
+/**@file
+ * @brief	Checks the order in which the SPI Transfer Queue of the @ref ili9341 sends its segments and measures the
+ *          CPU time that it returns to the caller while a full-screen update is streamed out.
+ *
+ * @details Two ILI9341 Devices share the SPI bus, and many more segments than @ref ILI9341_TX_QUEUE_LENGTH are queued
+ *          for them in an interleaved fashion. Each virtual ILI9341 Device must then receive its own Commands, with the
+ *          right D/C level and parameters, in the order in which they were queued, and no transfer may reach both of
+ *          them. The SPI bus is paced at 36 MHz so that the time that each call takes can be compared against the time
+ *          that its transfers take on the bus.
+ */
+
+#include "ili9341_test.h"
+
+#define ORDER_ROUNDS            (40)    /**< @brief Number of windows queued, alternating between both ILI9341 Devices. */
+#define ORDER_WINDOW_WIDTH      (4)     /**< @brief Width of each of those windows, whose height is a single row. */
+
+static uint16_t round_pixels[ORDER_ROUNDS][ORDER_WINDOW_WIDTH];
+static uint16_t frame[ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT];
+
+static void check_segment_order(void)
+{
+    for (int i = 0; i < ORDER_ROUNDS; i++)
+    {
+        ILI9341_handle_t *p_lcd = &test_lcd[i % TEST_DEVICE_COUNT];
+        for (int x = 0; x < ORDER_WINDOW_WIDTH; x++)
+        {
+            round_pixels[i][x] = (uint16_t) ((i << 8) | x);
+        }
+        TEST_CHECK_EQ(ili9341_set_window(p_lcd, (uint16_t) (2 * i), (uint16_t) (3 * i), (uint16_t) (2 * i + ORDER_WINDOW_WIDTH - 1), (uint16_t) (3 * i)), ILI9341_EC_OK);
+        TEST_CHECK_EQ(ili9341_write_pixels_16bpp(p_lcd, round_pixels[i], ORDER_WINDOW_WIDTH, NULL), ILI9341_EC_OK);
+    }
+    for (int d = 0; d < TEST_DEVICE_COUNT; d++)
+    {
+        TEST_CHECK_EQ(ili9341_wait_until_idle(&test_lcd[d]), ILI9341_EC_OK);
+    }
+
+    for (int d = 0; d < TEST_DEVICE_COUNT; d++)
+    {
+        const ili9341_panel_model_t *p_panel = &test_panel[d];
+        TEST_CHECK_EQ(p_panel->trace_count, 3 * ORDER_ROUNDS / TEST_DEVICE_COUNT);
+        for (int n = 0; n < ORDER_ROUNDS / TEST_DEVICE_COUNT; n++)
+        {
+            int i = n * TEST_DEVICE_COUNT + d;
+            const ili9341_panel_trace_entry_t *p_entry = &p_panel->trace[3 * n];
+            TEST_CHECK_EQ(p_entry[0].command, 0x2A);
+            TEST_CHECK_EQ(p_entry[0].params[1], 2 * i);
+            TEST_CHECK_EQ(p_entry[0].params[3], 2 * i + ORDER_WINDOW_WIDTH - 1);
+            TEST_CHECK_EQ(p_entry[1].command, 0x2B);
+            TEST_CHECK_EQ(p_entry[1].params[1], 3 * i);
+            TEST_CHECK_EQ(p_entry[1].params[3], 3 * i);
+            TEST_CHECK_EQ(p_entry[2].command, 0x2C);
+            TEST_CHECK_EQ(p_entry[2].pixels, ORDER_WINDOW_WIDTH);
+            for (int x = 0; x < ORDER_WINDOW_WIDTH; x++)
+            {
+                TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(p_panel, 2 * i + x, 3 * i), round_pixels[i][x]);
+            }
+        }
+        TEST_CHECK_EQ(p_panel->stats.overflow_pixels, 0);
+    }
+
+    /* Every transfer must have reached exactly one of the ILI9341 Devices. */
+    host_hal_stats_t stats;
+    host_hal_get_stats(&stats);
+    TEST_CHECK_EQ(test_panel[0].stats.transfers + test_panel[1].stats.transfers, stats.transfers);
+    TEST_CHECK_EQ(test_panel[0].stats.bytes + test_panel[1].stats.bytes, stats.bytes);
+    TEST_CHECK_EQ(stats.busy_starts, 0);
+    TEST_CHECK(stats.transfers > ILI9341_TX_QUEUE_LENGTH);
+}
+
+/**@brief   Measures how long a call that streams a whole frame keeps the caller, against how long the frame takes on
+ *          the SPI bus, and how much work the caller gets done meanwhile.
+ */
+static void measure_returned_cpu_time(const char *name, ILI9341_Status (*p_draw)(ILI9341_handle_t *p_handle))
+{
+    ILI9341_handle_t *p_lcd = &test_lcd[0];
+    test_sync(p_lcd);
+    uint64_t start_ns = host_time_ns();
+    uint64_t start_cpu_ns = host_thread_cpu_time_ns();
+    TEST_CHECK_EQ(p_draw(p_lcd), ILI9341_EC_OK);
+    uint64_t call_ns = host_time_ns() - start_ns;
+    uint64_t call_cpu_ns = host_thread_cpu_time_ns() - start_cpu_ns;
+    volatile uint32_t work = 0;
+    while (ili9341_is_busy(p_lcd))
+    {
+        work++;
+    }
+    uint64_t total_ns = host_time_ns() - start_ns;
+    TEST_CHECK_EQ(ili9341_wait_until_idle(p_lcd), ILI9341_EC_OK);
+    host_hal_stats_t stats;
+    host_hal_get_stats(&stats);
+
+    printf("%-26s bus %7.2f ms, call returned after %7.1f us (%5.1f us CPU), idle after %7.2f ms, %.1f%% of the bus time returned to the caller (%lu loop iterations)\n",
+           name, stats.bus_time_ns / 1e6, call_ns / 1e3, call_cpu_ns / 1e3, total_ns / 1e6, 100.0 * (1.0 - (double) call_ns / (double) stats.bus_time_ns), (unsigned long) work);
+    TEST_CHECK_EQ(test_panel[0].stats.pixels, ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT);
+    /* The call must give back the CPU long before the frame has been sent (i.e., it must not wait for the DMA). */
+    TEST_CHECK(call_ns * 4 < stats.bus_time_ns);
+    TEST_CHECK(total_ns >= stats.bus_time_ns);
+}
+
+static ILI9341_Status draw_fill_screen(ILI9341_handle_t *p_handle)
+{
+    ILI9341_COLOR color;
+    color.bpp_16 = 0x07E0;
+    return ili9341_fill_screen(p_handle, color);
+}
+
+static ILI9341_Status draw_frame(ILI9341_handle_t *p_handle)
+{
+    ILI9341_Status ret = ili9341_set_window(p_handle, 0, 0, ILI9341_SCREEN_WIDTH - 1, ILI9341_SCREEN_HEIGHT - 1);
+    if (ret != ILI9341_EC_OK)
+    {
+        return ret;
+    }
+    return ili9341_write_pixels_16bpp(p_handle, frame, ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT, NULL);
+}
+
+int main(void)
+{
+    host_hal_config_t config = {36000000U, 2000U, 1};
+    test_begin(&config, TEST_DEVICE_COUNT);
+
+    check_segment_order();
+
+    for (uint32_t i = 0; i < ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT; i++)
+    {
+        frame[i] = (uint16_t) (i * 2654435761U >> 16);
+    }
+    measure_returned_cpu_time("ili9341_fill_screen", draw_fill_screen);
+    measure_returned_cpu_time("ili9341_write_pixels_16bpp", draw_frame);
+    TEST_CHECK_EQ(ili9341_panel_model_get_pixel_565(&test_panel[0], 239, 319), frame[ILI9341_SCREEN_WIDTH * ILI9341_SCREEN_HEIGHT - 1]);
+
+    return test_end("test_tx_queue");
+}
@@ -0,0 +1,694 @@
+#!/usr/bin/env python3
+"""ILI9341 Font Compiler host tool.
+
+This tool converts BDF bitmap fonts or TrueType outline fonts into the flash-resident font format of the ILI9341 Fonts
+module (see "Inc/ili9341_fonts.h") and writes them as a C source file that can be added to the project, for example:
+
+    python3 tools/ili9341_font_compiler.py --name font_mono_8x13 8x13.bdf -o Src/font_mono_8x13.c
+    python3 tools/ili9341_font_compiler.py --size 24 --bpp 4 --name font_sans_24 Lato-Regular.ttf -o Src/font_sans_24.c
+    python3 tools/ili9341_font_compiler.py --size 48 --bpp 2 --chars "0123456789.:-" --name font_digits_48 Lato-Bold.ttf
+
+Only the characters that are actually used can be kept (see --chars and --chars-file), in which case the generated font
+either spans the range from the first up to the last of them or lists them explicitly, whichever takes less flash. The
+bitmaps of the glyphs only cover the bounding box of their ink and are stored either plain or Run-Length Encoded (see
+--encoding), and the kerning pairs of the font (from the "kern" table or from the "kern" feature of the "GPOS" table of
+TrueType fonts) are kept for the pairs of kept characters whose adjustment is not zero after scaling. The generated C
+source defines a single const variable with the requested name, which has to be declared in the code that uses it
+(e.g., "extern const ILI9341_font_t font_sans_24;"). The flash taken by each part of the font is printed to the
+standard error output, so that fonts can be budgeted before being added to the project.
+
+Only the Python standard library is required. TrueType fonts are supported with quadratic outlines (i.e., "glyf"
+tables, but not CFF ones), which are rendered without hinting with an exact coverage per row of sixteen scanlines per
+pixel. Characters are looked up by their Unicode code point, so only the ones from U+0000 up to U+00FF (i.e.,
+ISO-8859-1) can be kept.
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+RLE_INK_FLAG = 0x80  # Bit of an RLE token that tells that it is not a run of pixels without coverage.
+RLE_LITERAL_FLAG = 0x40  # Bit of an RLE token, with RLE_INK_FLAG set, that tells that its coverages follow.
+RLE_MAX_BACKGROUND = 128  # Maximum number of pixels of an RLE token of pixels without coverage.
+RLE_MAX_COUNT = 64  # Maximum number of pixels of the rest of the RLE tokens.
+GLYPH_SIZE = 8  # Size in bytes of an ILI9341_glyph_t, including its padding.
+KERNING_PAIR_SIZE = 3  # Size in bytes of an ILI9341_kerning_pair_t.
+FONT_SIZE = 28  # Size in bytes of an ILI9341_font_t on a 32-bit MCU, including its padding.
+SCANLINES = 16  # Number of scanlines per row of pixels with which the outlines are rendered.
+DEFAULT_CHARACTERS = "".join(chr(c) for c in range(32, 127))
+
+
+class Glyph:
+    """Glyph whose coverages (from 0 up to 1) only cover the bounding box of its ink."""
+
+    def __init__(self, width, height, x_offset, y_offset, x_advance, coverages):
+        self.width = width
+        self.height = height
+        self.x_offset = x_offset  # Column of the left side of the bitmap, relative to the pen.
+        self.y_offset = y_offset  # Row of the top side of the bitmap, relative to the baseline.
+        self.x_advance = x_advance
+        self.coverages = coverages  # Row by row, from the top-left pixel.
+
+
+class Font:
+    """Font made of the glyphs of some characters, with its line metrics and kerning pairs in pixels."""
+
+    def __init__(self, ascent, descent, glyphs, kerning):
+        self.ascent = ascent
+        self.descent = descent
+        self.glyphs = glyphs  # Dictionary from each character code to its Glyph.
+        self.kerning = kerning  # Dictionary from each (left, right) pair of character codes to its adjustment.
+
+
+def crop_glyph(coverages, width, height, x_offset, y_offset, x_advance, levels):
+    """Crops a glyph to the bounding box of the pixels whose coverage is not quantized to zero."""
+    ink = [(x, y) for y in range(height) for x in range(width) if quantize(coverages[y * width + x], levels)]
+    if not ink:
+        return Glyph(0, 0, 0, 0, x_advance, [])
+    x0 = min(x for x, _ in ink)
+    x1 = max(x for x, _ in ink)
+    y0 = min(y for _, y in ink)
+    y1 = max(y for _, y in ink)
+    cropped = [coverages[y * width + x] for y in range(y0, y1 + 1) for x in range(x0, x1 + 1)]
+    return Glyph(x1 - x0 + 1, y1 - y0 + 1, x_offset + x0, y_offset + y0, x_advance, cropped)
+
+
+def quantize(coverage, levels):
+    """Quantizes a coverage, from 0 up to 1, into the nearest of the given number of levels."""
+    return max(0, min(levels - 1, int(coverage * (levels - 1) + 0.5)))
+
+
+def read_bdf(data, characters):
+    """Reads the glyphs of the given characters from a BDF font."""
+    lines = data.decode("latin-1").splitlines()
+    ascent = descent = None
+    glyphs = {}
+    i = 0
+    while i < len(lines):
+        words = lines[i].split()
+        i += 1
+        if not words:
+            continue
+        if words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "FONT_DESCENT":
+            descent = int(words[1])
+        elif words[0] == "FONTBOUNDINGBOX" and ascent is None:
+            ascent = int(words[2]) + int(words[4])
+            descent = -int(words[4])
+        elif words[0] == "STARTCHAR":
+            code = advance = None
+            box = (0, 0, 0, 0)
+            rows = []
+            while i < len(lines) and lines[i].split()[:1] != ["ENDCHAR"]:
+                words = lines[i].split()
+                i += 1
+                if words[:1] == ["ENCODING"]:
+                    code = int(words[1])
+                elif words[:1] == ["DWIDTH"]:
+                    advance = int(words[1])
+                elif words[:1] == ["BBX"]:
+                    box = tuple(int(word) for word in words[1:5])
+                elif words[:1] == ["BITMAP"]:
+                    while i < len(lines) and lines[i].split()[:1] != ["ENDCHAR"]:
+                        rows.append(lines[i].strip())
+                        i += 1
+            i += 1
+            if code not in characters:
+                continue
+            width, height, x_offset, y_offset = box
+            coverages = []
+            for row in rows[:height]:
+                bits = int(row, 16) if row else 0
+                total = len(row) * 4
+                coverages.extend(float((bits >> (total - 1 - x)) & 1) for x in range(width))
+            coverages.extend([0.0] * (width * height - len(coverages)))
+            advance = width if advance is None else advance
+            glyphs[code] = crop_glyph(coverages, width, height, x_offset, -(y_offset + height), advance, 2)
+    if ascent is None or descent is None:
+        raise ValueError("the BDF font has neither FONT_ASCENT and FONT_DESCENT nor FONTBOUNDINGBOX")
+    return Font(ascent, descent, glyphs, {})
+
+
+class TrueType:
+    """Reader of the tables of a TrueType font that hold its outlines, metrics, character map and kerning."""
+
+    def __init__(self, data):
+        if data[:4] not in (b"\x00\x01\x00\x00", b"true"):
+            raise ValueError("not a TrueType font with quadratic outlines (CFF outlines are not supported)")
+        self.data = data
+        self.tables = {}
+        for i in range(struct.unpack(">H", data[4:6])[0]):
+            tag, _, offset, length = struct.unpack(">4sIII", data[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode("latin-1")] = (offset, length)
+        for tag in ("head", "hhea", "hmtx", "maxp", "loca", "glyf", "cmap"):
+            if tag not in self.tables:
+                raise ValueError("the TrueType font has no '%s' table" % tag)
+        head = self.tables["head"][0]
+        self.units_per_em = self.u16(head + 18)
+        self.long_loca = self.s16(head + 50) != 0
+        hhea = self.tables["hhea"][0]
+        self.ascender = self.s16(hhea + 4)
+        self.descender = self.s16(hhea + 6)
+        self.metric_count = self.u16(hhea + 34)
+        self.glyph_count = self.u16(self.tables["maxp"][0] + 4)
+
+    def u16(self, offset):
+        return struct.unpack(">H", self.data[offset:offset + 2])[0]
+
+    def s16(self, offset):
+        return struct.unpack(">h", self.data[offset:offset + 2])[0]
+
+    def u32(self, offset):
+        return struct.unpack(">I", self.data[offset:offset + 4])[0]
+
+    def character_map(self):
+        """Returns a dictionary from each Unicode code point up to U+00FF to its glyph index."""
+        cmap = self.tables["cmap"][0]
+        subtables = {}
+        for i in range(self.u16(cmap + 2)):
+            platform, encoding, offset = struct.unpack(">HHI", self.data[cmap + 4 + 8 * i:cmap + 12 + 8 * i])
+            subtables[(platform, encoding)] = cmap + offset
+        for key in ((3, 10), (0, 4), (3, 1), (0, 3), (0, 1), (0, 0)):
+            if key in subtables and self.u16(subtables[key]) in (4, 12):
+                break
+        else:
+            raise ValueError("the TrueType font has no Unicode character map of format 4 or 12")
+        table = subtables[key]
+        mapping = {}
+        if self.u16(table) == 12:
+            for i in range(self.u32(table + 12)):
+                start, end, glyph = struct.unpack(">III", self.data[table + 16 + 12 * i:table + 28 + 12 * i])
+                for code in range(start, min(end, 255) + 1):
+                    mapping[code] = glyph + code - start
+            return mapping
+        segments = self.u16(table + 6) // 2
+        ends = table + 14
+        starts = ends + 2 * segments + 2
+        deltas = starts + 2 * segments
+        range_offsets = deltas + 2 * segments
+        for i in range(segments):
+            start, end = self.u16(starts + 2 * i), self.u16(ends + 2 * i)
+            delta, range_offset = self.u16(deltas + 2 * i), self.u16(range_offsets + 2 * i)
+            for code in range(start, min(end, 255) + 1):
+                if range_offset == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    glyph = self.u16(range_offsets + 2 * i + range_offset + 2 * (code - start))
+                    glyph = (glyph + delta) & 0xFFFF if glyph else 0
+                if glyph:
+                    mapping[code] = glyph
+        return mapping
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        return self.u16(hmtx + 4 * min(glyph, self.metric_count - 1))
+
+    def contours(self, glyph, depth=0):
+        """Returns the contours of a glyph, each of them as a list of (x, y, is_on_curve) points in font units."""
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = self.u32(loca + 4 * glyph), self.u32(loca + 4 * glyph + 4)
+        else:
+            start, end = 2 * self.u16(loca + 2 * glyph), 2 * self.u16(loca + 2 * glyph + 2)
+        if start == end or depth > 8:
+            return []
+        offset = self.tables["glyf"][0] + start
+        contour_count = self.s16(offset)
+        offset += 10
+        if contour_count < 0:
+            return self.composite_contours(offset, depth)
+        ends = [self.u16(offset + 2 * i) for i in range(contour_count)]
+        point_count = ends[-1] + 1 if ends else 0
+        offset += 2 * contour_count
+        offset += 2 + self.u16(offset)
+        flags = []
+        while len(flags) < point_count:
+            flag = self.data[offset]
+            offset += 1
+            repeat = 0
+            if flag & 0x08:
+                repeat = self.data[offset]
+                offset += 1
+            flags.extend([flag] * (repeat + 1))
+        coordinates = []
+        for short_bit, same_bit in ((0x02, 0x10), (0x04, 0x20)):
+            value = 0
+            values = []
+            for flag in flags[:point_count]:
+                if flag & short_bit:
+                    delta = self.data[offset]
+                    offset += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += self.s16(offset)
+                    offset += 2
+                values.append(value)
+            coordinates.append(values)
+        points = [(coordinates[0][i], coordinates[1][i], bool(flags[i] & 0x01)) for i in range(point_count)]
+        contours = []
+        first = 0
+        for end in ends:
+            contours.append(points[first:end + 1])
+            first = end + 1
+        return contours
+
+    def composite_contours(self, offset, depth):
+        contours = []
+        while True:
+            flags, glyph = self.u16(offset), self.u16(offset + 2)
+            offset += 4
+            if flags & 0x0001:
+                dx, dy = self.s16(offset), self.s16(offset + 2)
+                offset += 4
+            else:
+                dx, dy = struct.unpack(">bb", self.data[offset:offset + 2])
+                offset += 2
+            if not flags & 0x0002:
+                dx = dy = 0  # Components that are positioned by matching points are not supported.
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                a = d = self.s16(offset) / 16384.0
+                offset += 2
+            elif flags & 0x0040:
+                a, d = self.s16(offset) / 16384.0, self.s16(offset + 2) / 16384.0
+                offset += 4
+            elif flags & 0x0080:
+                a, b, c, d = (self.s16(offset + 2 * i) / 16384.0 for i in range(4))
+                offset += 8
+            for contour in self.contours(glyph, depth + 1):
+                contours.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+            if not flags & 0x0020:
+                return contours
+
+    def kerning(self, glyphs):
+        """Returns a dictionary from each pair of the given glyph indexes to its kerning adjustment in font units."""
+        if "GPOS" in self.tables:
+            pairs = self.gpos_kerning(set(glyphs))
+            if pairs:
+                return pairs
+        pairs = {}
+        if "kern" not in self.tables:
+            return pairs
+        offset = self.tables["kern"][0]
+        if self.u16(offset) != 0:
+            return pairs
+        offset += 4
+        for _ in range(self.u16(offset - 2)):
+            length, coverage = self.u16(offset + 2), self.u16(offset + 4)
+            if coverage >> 8 == 0 and coverage & 0x0F == 0x01:
+                for i in range(self.u16(offset + 6)):
+                    left, right, value = struct.unpack(">HHh", self.data[offset + 14 + 6 * i:offset + 20 + 6 * i])
+                    if left in glyphs and right in glyphs:
+                        pairs[(left, right)] = pairs.get((left, right), 0) + value
+            offset += length
+        return pairs
+
+    def gpos_kerning(self, glyphs):
+        gpos = self.tables["GPOS"][0]
+        features, lookups = gpos + self.u16(gpos + 6), gpos + self.u16(gpos + 8)
+        indexes = set()
+        for i in range(self.u16(features)):
+            if self.data[features + 2 + 6 * i:features + 6 + 6 * i] == b"kern":
+                feature = features + self.u16(features + 6 + 6 * i)
+                indexes.update(self.u16(feature + 4 + 2 * j) for j in range(self.u16(feature + 2)))
+        pairs = {}
+        for index in sorted(indexes):
+            lookup = lookups + self.u16(lookups + 2 + 2 * index)
+            kind = self.u16(lookup)
+            subtables = []
+            for j in range(self.u16(lookup + 4)):
+                subtable = lookup + self.u16(lookup + 6 + 2 * j)
+                if kind == 9 and self.u16(subtable + 2) == 2:
+                    subtables.append(subtable + self.u32(subtable + 4))
+                elif kind == 2:
+                    subtables.append(subtable)
+            found = {}
+            for subtable in subtables:
+                for pair, value in self.pair_adjustments(subtable, glyphs).items():
+                    found.setdefault(pair, value)
+            for pair, value in found.items():
+                pairs[pair] = pairs.get(pair, 0) + value
+        return pairs
+
+    def pair_adjustments(self, subtable, glyphs):
+        """Returns the advance adjustments of the first glyphs of the pairs of a GPOS pair adjustment subtable."""
+        form = self.u16(subtable)
+        covered = self.coverage(subtable + self.u16(subtable + 2))
+        formats = (self.u16(subtable + 4), self.u16(subtable + 6))
+        sizes = [2 * bin(f & 0xFF).count("1") for f in formats]
+        advance = 2 * bin(formats[0] & 0x03).count("1") if formats[0] & 0x04 else None
+        pairs = {}
+        if advance is None:
+            return pairs
+        if form == 1:
+            for left, index in covered.items():
+                if left not in glyphs:
+                    continue
+                pair_set = subtable + self.u16(subtable + 10 + 2 * index)
+                record_size = 2 + sizes[0] + sizes[1]
+                for k in range(self.u16(pair_set)):
+                    record = pair_set + 2 + record_size * k
+                    right = self.u16(record)
+                    if right in glyphs:
+                        pairs[(left, right)] = self.s16(record + 2 + advance)
+        elif form == 2:
+            first_classes = self.class_definition(subtable + self.u16(subtable + 8))
+            second_classes = self.class_definition(subtable + self.u16(subtable + 10))
+            second_count = self.u16(subtable + 14)
+            record_size = sizes[0] + sizes[1]
+            for left in glyphs:
+                if left not in covered:
+                    continue
+                for right in glyphs:
+                    record = (first_classes.get(left, 0) * second_count + second_classes.get(right, 0)) * record_size
+                    pairs[(left, right)] = self.s16(subtable + 16 + record + advance)
+        return pairs
+
+    def coverage(self, table):
+        """Returns a dictionary from each glyph index of a coverage table to its coverage index."""
+        covered = {}
+        if self.u16(table) == 1:
+            for i in range(self.u16(table + 2)):
+                covered[self.u16(table + 4 + 2 * i)] = i
+        else:
+            for i in range(self.u16(table + 2)):
+                start, end, index = struct.unpack(">HHH", self.data[table + 4 + 6 * i:table + 10 + 6 * i])
+                for glyph in range(start, end + 1):
+                    covered[glyph] = index + glyph - start
+        return covered
+
+    def class_definition(self, table):
+        """Returns a dictionary from each glyph index of a class definition table to its class."""
+        classes = {}
+        if self.u16(table) == 1:
+            start = self.u16(table + 2)
+            for i in range(self.u16(table + 4)):
+                classes[start + i] = self.u16(table + 6 + 2 * i)
+        else:
+            for i in range(self.u16(table + 2)):
+                start, end, value = struct.unpack(">HHH", self.data[table + 4 + 6 * i:table + 10 + 6 * i])
+                for glyph in range(start, end + 1):
+                    classes[glyph] = value
+        return classes
+
+
+def flatten(contours, scale):
+    """Converts quadratic contours in font units into the line segments, in pixels with Y pointing down, that form them."""
+    edges = []
+    for contour in contours:
+        if not contour:
+            continue
+        points = [(x * scale, -y * scale, on) for x, y, on in contour]
+        # Start from an on-curve point, which is implied halfway between two off-curve points if there is none.
+        start = next((i for i, point in enumerate(points) if point[2]), None)
+        if start is None:
+            points.insert(0, ((points[0][0] + points[-1][0]) / 2, (points[0][1] + points[-1][1]) / 2, True))
+            start = 0
+        points = points[start:] + points[:start] + [points[start]]
+        current = points[0][:2]
+        control = None
+        for x, y, on in points[1:]:
+            if on:
+                if control is None:
+                    edges.append((current, (x, y)))
+                else:
+                    edges.extend(flatten_curve(current, control, (x, y)))
+                current, control = (x, y), None
+            elif control is None:
+                control = (x, y)
+            else:
+                middle = ((control[0] + x) / 2, (control[1] + y) / 2)
+                edges.extend(flatten_curve(current, control, middle))
+                current, control = middle, (x, y)
+    return edges
+
+
+def flatten_curve(p0, p1, p2):
+    """Splits a quadratic Bézier curve into line segments that deviate from it by less than 1/32 of a pixel."""
+    deviation = math.hypot(p0[0] - 2 * p1[0] + p2[0], p0[1] - 2 * p1[1] + p2[1]) / 4
+    count = max(1, int(math.ceil(math.sqrt(deviation * 32))))
+    edges = []
+    previous = p0
+    for i in range(1, count + 1):
+        t = i / count
+        point = ((1 - t) ** 2 * p0[0] + 2 * t * (1 - t) * p1[0] + t * t * p2[0],
+                 (1 - t) ** 2 * p0[1] + 2 * t * (1 - t) * p1[1] + t * t * p2[1])
+        edges.append((previous, point))
+        previous = point
+    return edges
+
+
+def rasterize(edges):
+    """Renders the non-zero winding fill of line segments into coverages, returning them with their top-left pixel."""
+    edges = [edge for edge in edges if edge[0][1] != edge[1][1]]
+    if not edges:
+        return 0, 0, 0, 0, []
+    x0 = int(math.floor(min(min(a[0], b[0]) for a, b in edges)))
+    x1 = int(math.ceil(max(max(a[0], b[0]) for a, b in edges)))
+    y0 = int(math.floor(min(min(a[1], b[1]) for a, b in edges)))
+    y1 = int(math.ceil(max(max(a[1], b[1]) for a, b in edges)))
+    width, height = x1 - x0, y1 - y0
+    coverages = [0.0] * (width * height)
+    for row in range(height):
+        base = row * width
+        for scanline in range(SCANLINES):
+            y = y0 + row + (scanline + 0.5) / SCANLINES
+            crossings = []
+            for (ax, ay), (bx, by) in edges:
+                if (ay <= y < by) or (by <= y < ay):
+                    crossings.append((ax + (y - ay) * (bx - ax) / (by - ay) - x0, 1 if by > ay else -1))
+            crossings.sort()
+            winding = 0
+            for i, (x, direction) in enumerate(crossings[:-1]):
+                winding += direction
+                if winding != 0:
+                    add_span(coverages, base, width, x, crossings[i + 1][0])
+    return width, height, x0, y0, [min(1.0, coverage / SCANLINES) for coverage in coverages]
+
+
+def add_span(coverages, base, width, start, end):
+    """Adds the horizontal coverage of a span of a scanline to the pixels of its row."""
+    start, end = max(0.0, start), min(float(width), end)
+    if end <= start:
+        return
+    first, last = int(start), int(math.ceil(end)) - 1
+    if first == last:
+        coverages[base + first] += end - start
+        return
+    coverages[base + first] += first + 1 - start
+    for x in range(first + 1, last):
+        coverages[base + x] += 1.0
+    if last >= first + 1:
+        coverages[base + last] += end - last
+
+
+def read_truetype(data, characters, size, levels):
+    """Renders the glyphs of the given characters of a TrueType font at the given size in pixels per em."""
+    font = TrueType(data)
+    scale = size / font.units_per_em
+    mapping = font.character_map()
+    glyphs = {}
+    for code in characters:
+        if code not in mapping:
+            continue
+        index = mapping[code]
+        width, height, x0, y0, coverages = rasterize(flatten(font.contours(index), scale))
+        glyphs[code] = crop_glyph(coverages, width, height, x0, y0, int(round(font.advance(index) * scale)), levels)
+    kerning = {}
+    users = {}
+    for code in glyphs:
+        users.setdefault(mapping[code], []).append(code)
+    for (left, right), value in font.kerning(set(users)).items():
+        for left_code in users[left]:
+            for right_code in users[right]:
+                kerning[(left_code, right_code)] = int(round(value * scale))
+    return Font(int(math.ceil(font.ascender * scale)), int(math.ceil(-font.descender * scale)), glyphs, kerning)
+
+
+def pack_coverages(values, bpp):
+    """Packs coverages from the Most Significant Bits of each byte, where the last byte is padded with zeros."""
+    data = bytearray((len(values) * bpp + 7) // 8)
+    for i, value in enumerate(values):
+        bit = i * bpp
+        data[bit // 8] |= value << (8 - bpp - bit % 8)
+    return data
+
+
+def encode_rle(values, bpp):
+    """Encodes quantized coverages into the shortest sequence of RLE tokens."""
+    full = (1 << bpp) - 1
+    count = len(values)
+    cost = [0] + [None] * count  # Size in bytes of the shortest encoding of the first i coverages.
+    choice = [None] * (count + 1)
+    for i in range(count):
+        if cost[i] is None:
+            continue
+        candidates = ((0, RLE_MAX_BACKGROUND), (full, RLE_MAX_COUNT), (None, RLE_MAX_COUNT))
+        for value, limit in candidates:
+            for length in range(1, min(limit, count - i) + 1):
+                if value is not None and values[i + length - 1] != value:
+                    break
+                size = cost[i] + 1 + (0 if value is not None else (length * bpp + 7) // 8)
+                if cost[i + length] is None or size < cost[i + length]:
+                    cost[i + length] = size
+                    choice[i + length] = (i, value)
+    tokens = []
+    end = count
+    while end:
+        start, value = choice[end]
+        if value == 0:
+            tokens.append(bytes([end - start - 1]))
+        elif value is not None:
+            tokens.append(bytes([RLE_INK_FLAG | (end - start - 1)]))
+        else:
+            tokens.append(bytes([RLE_INK_FLAG | RLE_LITERAL_FLAG | (end - start - 1)]) + pack_coverages(values[start:end], bpp))
+        end = start
+    return b"".join(reversed(tokens))
+
+
+def encode_bitmaps(font, codes, bpp, is_rle):
+    """Encodes the bitmaps of the glyphs of the given characters, returning them with the offset of each of them."""
+    data = bytearray()
+    offsets = []
+    for code in codes:
+        glyph = font.glyphs.get(code)
+        values = [quantize(coverage, 1 << bpp) for coverage in glyph.coverages] if glyph else []
+        offsets.append(len(data) if values else 0)
+        data.extend(encode_rle(values, bpp) if is_rle else pack_coverages(values, bpp))
+    if len(data) > 0x10000:
+        raise ValueError("the bitmaps take %d bytes, but they can only take up to 65536 bytes" % len(data))
+    return data, offsets
+
+
+def format_array(values, per_line, digits):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join("0x%0*X" % (digits, v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines) if lines else "    0"
+
+
+def describe(code):
+    if code in (0x27, 0x5C):
+        return "'\\%s'" % chr(code)
+    return "'%s'" % chr(code) if 32 <= code < 127 else "0x%02X" % code
+
+
+def write_font(out, name, font, codes, bpp, encoding):
+    """Writes the font as C source, choosing its smallest layout, and prints the flash that each part of it takes."""
+    codes = sorted(code for code in codes if code in font.glyphs)
+    if not codes:
+        raise ValueError("the font has none of the requested characters")
+    for code in codes:
+        glyph = font.glyphs[code]
+        if not (glyph.width < 256 and glyph.height < 256 and glyph.x_advance < 256
+                and -128 <= glyph.x_offset < 128 and -128 <= glyph.y_offset < 128):
+            raise ValueError("the glyph of %s is too large for the ILI9341 Fonts module" % describe(code))
+    ascent = max([font.ascent] + [-font.glyphs[code].y_offset for code in codes])
+    descent = max([font.descent] + [font.glyphs[code].y_offset + font.glyphs[code].height for code in codes])
+    if not (0 <= ascent < 256 and 0 <= descent < 256):
+        raise ValueError("the line of text is too tall for the ILI9341 Fonts module")
+
+    # Keep either the whole range of characters, with empty glyphs for the missing ones, or only the requested ones.
+    is_sparse = len(codes) * (GLYPH_SIZE + 1) < (codes[-1] - codes[0] + 1) * GLYPH_SIZE
+    table = codes if is_sparse else list(range(codes[0], codes[-1] + 1))
+    plain, plain_offsets = encode_bitmaps(font, table, bpp, False)
+    rle, rle_offsets = encode_bitmaps(font, table, bpp, True)
+    is_rle = encoding == "rle" or (encoding == "auto" and len(rle) < len(plain))
+    bitmaps, offsets = (rle, rle_offsets) if is_rle else (plain, plain_offsets)
+    kept = set(codes)
+    pairs = sorted((left, right, max(-128, min(127, value))) for (left, right), value in font.kerning.items()
+                   if value and left in kept and right in kept)
+
+    out.write("#include \"ili9341_fonts.h\"\n\n")
+    out.write("static const uint8_t %s_bitmaps[%d] =\n{\n%s\n};\n\n" % (name, max(1, len(bitmaps)), format_array(bitmaps, 16, 2)))
+    out.write("static const ILI9341_glyph_t %s_glyphs[%d] =\n{\n" % (name, len(table)))
+    for code, offset in zip(table, offsets):
+        glyph = font.glyphs.get(code, Glyph(0, 0, 0, 0, 0, []))
+        out.write("    {%d, %d, %d, %d, %d, %d}, // %s\n"
+                  % (offset, glyph.width, glyph.height, glyph.x_advance, glyph.x_offset, glyph.y_offset, describe(code)))
+    out.write("};\n\n")
+    if is_sparse:
+        out.write("static const uint8_t %s_characters[%d] =\n{\n%s\n};\n\n" % (name, len(codes), format_array(codes, 16, 2)))
+    if pairs:
+        out.write("static const ILI9341_kerning_pair_t %s_kerning_pairs[%d] =\n{\n" % (name, len(pairs)))
+        out.write("\n".join("    {0x%02X, 0x%02X, %d}, // %s %s" % (left, right, value, describe(left), describe(right))
+                            for left, right, value in pairs))
+        out.write("\n};\n\n")
+    out.write("const ILI9341_font_t %s =\n{\n    %s_bitmaps, %s_glyphs, %d, %d, %d, %d, %d, %d, %s, %d, %d, %s\n};\n"
+              % (name, name, name, codes[0], codes[-1], ascent, descent, bpp, int(is_rle),
+                 "%s_characters" % name if is_sparse else "NULL", len(codes) if is_sparse else 0, len(pairs),
+                 "%s_kerning_pairs" % name if pairs else "NULL"))
+
+    glyphs_size = len(table) * GLYPH_SIZE
+    characters_size = len(codes) if is_sparse else 0
+    kerning_size = len(pairs) * KERNING_PAIR_SIZE
+    total = len(bitmaps) + glyphs_size + characters_size + kerning_size + FONT_SIZE
+    print("%s: %d glyphs (%s to %s%s), %d bpp, %d+%d rows per line, %d bytes of flash"
+          % (name, len(codes), describe(codes[0]), describe(codes[-1]), ", listed" if is_sparse else "", bpp, ascent,
+             descent, total), file=sys.stderr)
+    print("    bitmaps:        %6d bytes (%s; plain: %d bytes, RLE: %d bytes, %.1f%% of plain)"
+          % (len(bitmaps), "RLE" if is_rle else "plain", len(plain), len(rle), 100.0 * len(rle) / max(1, len(plain))),
+          file=sys.stderr)
+    print("    glyphs:         %6d bytes (%d entries%s)"
+          % (glyphs_size, len(table), ", %d of them empty" % (len(table) - len(codes)) if len(table) > len(codes) else ""),
+          file=sys.stderr)
+    print("    characters:     %6d bytes" % characters_size, file=sys.stderr)
+    print("    kerning pairs:  %6d bytes (%d pairs)" % (kerning_size, len(pairs)), file=sys.stderr)
+    print("    font:           %6d bytes" % FONT_SIZE, file=sys.stderr)
+
+
+def parse_characters(args):
+    text = DEFAULT_CHARACTERS if args.chars is None and args.chars_file is None else (args.chars or "")
+    if args.chars_file:
+        with open(args.chars_file, encoding="utf-8") as file:
+            text += file.read()
+    codes = set()
+    for character in text:
+        if ord(character) > 0xFF:
+            raise ValueError("U+%04X cannot be kept, since characters are single bytes" % ord(character))
+        if character not in "\r\n":
+            codes.add(ord(character))
+    return codes
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Converts BDF/TrueType fonts into the font format of the ILI9341 Fonts module.")
+    parser.add_argument("font", help="BDF or TrueType font to be converted")
+    parser.add_argument("--name", required=True, help="name of the C variable to be generated")
+    parser.add_argument("--size", type=float, help="size in pixels per em of TrueType fonts (required for them)")
+    parser.add_argument("--bpp", type=int, choices=[1, 2, 4], default=1,
+                        help="bits per pixel of the coverage of the glyphs of TrueType fonts (default: 1)")
+    parser.add_argument("--chars", help="characters to be kept (default: the printable ASCII characters)")
+    parser.add_argument("--chars-file", help="UTF-8 text file whose characters are to be kept, besides the ones of --chars")
+    parser.add_argument("--encoding", choices=["auto", "plain", "rle"], default="auto",
+                        help="encoding of the bitmaps, where auto picks the smaller one (default: auto)")
+    parser.add_argument("-o", "--output", help="C source file to be written (default: standard output)")
+    args = parser.parse_args()
+
+    try:
+        codes = parse_characters(args)
+        with open(args.font, "rb") as file:
+            data = file.read()
+        if data.startswith(b"STARTFONT"):
+            font, bpp = read_bdf(data, codes), 1
+        else:
+            if args.size is None:
+                raise ValueError("--size is required for TrueType fonts")
+            font, bpp = read_truetype(data, codes, args.size, 1 << args.bpp), args.bpp
+        missing = sorted(codes - set(font.glyphs))
+        if missing:
+            print("warning: the font has no glyph for %s" % ", ".join(describe(code) for code in missing), file=sys.stderr)
+        out = open(args.output, "w") if args.output else sys.stdout
+        try:
+            write_font(out, args.name, font, codes, bpp, args.encoding)
+        finally:
+            if args.output:
+                out.close()
+    except ValueError as error:
+        sys.exit("error: %s" % error)
+
+
+if __name__ == "__main__":
+    main()
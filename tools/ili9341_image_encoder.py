@@ -0,0 +1,379 @@
+#!/usr/bin/env python3
+"""ILI9341 Image Encoder host tool.
+
+This tool converts PNG or PPM images into the flash-resident image formats of the ILI9341 Images module (see
+"Inc/ili9341_images.h") and writes them as a C source file that can be added to the project, for example:
+
+    python3 tools/ili9341_image_encoder.py --format sprite --name icon_wifi wifi.png -o Src/icon_wifi.c
+    python3 tools/ili9341_image_encoder.py --format rle --name background background.png -o Src/background.c
+    python3 tools/ili9341_image_encoder.py --format qoi --bpp 18 --name photo photo.png -o Src/photo.c
+
+The generated C source defines a single const variable with the requested name, which has to be declared in the code
+that uses it (e.g., "extern const ILI9341_sprite_t icon_wifi;"). The size statistics of the encoded image are printed
+to the standard error output.
+
+Only the Python standard library is required. PNG images are supported with any color type, bit depth up to 16 bits
+and without interlacing, while PPM images are supported in their binary form (i.e., P6).
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+RLE_RUN_FLAG = 0x8000  # Bit of the header of an RLE token that tells that it is a run.
+RLE_MAX_COUNT = 0x8000  # Maximum number of pixels of a single RLE token.
+QOI_OP_INDEX = 0x00
+QOI_OP_DIFF = 0x40
+QOI_OP_LUMA = 0x80
+QOI_OP_RUN = 0xC0
+QOI_OP_PIXEL = 0xFE
+QOI_MAX_RUN = 62
+
+
+class Image:
+    """Image of RGBA pixels, where each pixel is a tuple of 4 values from 0 up to 255."""
+
+    def __init__(self, width, height, pixels):
+        self.width = width
+        self.height = height
+        self.pixels = pixels  # Row by row, from the top-left pixel.
+
+    def pixel(self, x, y):
+        return self.pixels[y * self.width + x]
+
+
+def read_png(data):
+    """Decodes a non-interlaced PNG image of any color type and bit depth."""
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError("not a PNG image")
+    offset = len(PNG_SIGNATURE)
+    idat = b""
+    palette = []
+    transparency = b""
+    while offset < len(data):
+        length, kind = struct.unpack(">I4s", data[offset:offset + 8])
+        body = data[offset + 8:offset + 8 + length]
+        offset += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if interlace:
+                raise ValueError("interlaced PNG images are not supported")
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            transparency = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    bits_per_pixel = channels * depth
+    stride = (width * bits_per_pixel + 7) // 8
+    step = max(1, bits_per_pixel // 8)
+    raw = zlib.decompress(idat)
+
+    # Undo the filter of each scanline.
+    rows = []
+    previous = bytearray(stride)
+    position = 0
+    for _ in range(height):
+        kind = raw[position]
+        row = bytearray(raw[position + 1:position + 1 + stride])
+        position += 1 + stride
+        for i in range(stride):
+            left = row[i - step] if i >= step else 0
+            up = previous[i]
+            up_left = previous[i - step] if i >= step else 0
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + up) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                estimate = left + up - up_left
+                distances = (abs(estimate - left), abs(estimate - up), abs(estimate - up_left))
+                predictor = left if distances[0] <= distances[1] and distances[0] <= distances[2] else (up if distances[1] <= distances[2] else up_left)
+                row[i] = (row[i] + predictor) & 0xFF
+        rows.append(row)
+        previous = row
+
+    # Unpack the samples of each pixel into RGBA.
+    def samples(row):
+        if depth == 8:
+            return list(row)
+        if depth == 16:
+            return [row[i] for i in range(0, len(row), 2)]  # Keep the Most Significant Byte of each sample.
+        per_byte = 8 // depth
+        mask = (1 << depth) - 1
+        return [(row[i // per_byte] >> (8 - depth * (i % per_byte + 1))) & mask for i in range(width * channels)]
+
+    scale = 255 // ((1 << depth) - 1) if depth < 8 else 1
+    key = None
+    if color_type == 0 and len(transparency) >= 2:
+        key = (struct.unpack(">H", transparency[:2])[0] >> (8 if depth == 16 else 0),)
+    elif color_type == 2 and len(transparency) >= 6:
+        key = tuple(v >> (8 if depth == 16 else 0) for v in struct.unpack(">HHH", transparency[:6]))
+    pixels = []
+    for row in rows:
+        values = samples(row)
+        for x in range(width):
+            sample = values[x * channels:(x + 1) * channels]
+            if color_type == 3:
+                index = sample[0]
+                alpha = transparency[index] if index < len(transparency) else 255
+                pixels.append(palette[index] + (alpha,))
+            elif color_type == 0:
+                gray = sample[0] * scale
+                pixels.append((gray, gray, gray, 0 if (key is not None and (sample[0],) == key) else 255))
+            elif color_type == 4:
+                pixels.append((sample[0], sample[0], sample[0], sample[1]))
+            elif color_type == 2:
+                pixels.append((sample[0], sample[1], sample[2], 0 if (key is not None and tuple(sample) == key) else 255))
+            else:
+                pixels.append(tuple(sample))
+    return Image(width, height, pixels)
+
+
+def read_ppm(data):
+    """Decodes a binary PPM image (i.e., P6) with a maximum value of up to 65535."""
+    fields = []
+    position = 2
+    while len(fields) < 3:
+        while data[position:position + 1].isspace():
+            position += 1
+        if data[position:position + 1] == b"#":
+            position = data.index(b"\n", position)
+            continue
+        start = position
+        while not data[position:position + 1].isspace():
+            position += 1
+        fields.append(int(data[start:position]))
+    width, height, maximum = fields
+    position += 1
+    size = 2 if maximum > 255 else 1
+    pixels = []
+    for i in range(width * height):
+        rgb = []
+        for c in range(3):
+            offset = position + (i * 3 + c) * size
+            value = struct.unpack(">H", data[offset:offset + 2])[0] if size == 2 else data[offset]
+            rgb.append(value * 255 // maximum)
+        pixels.append(tuple(rgb) + (255,))
+    return Image(width, height, pixels)
+
+
+def read_image(path):
+    with open(path, "rb") as file:
+        data = file.read()
+    if data.startswith(PNG_SIGNATURE):
+        return read_png(data)
+    if data.startswith(b"P6"):
+        return read_ppm(data)
+    raise ValueError("%s is neither a PNG nor a binary PPM image" % path)
+
+
+def to_rgb565(pixel):
+    """Converts an RGBA pixel into the 16 bits per pixel Bit Color Order of the ILI9341 Device."""
+    return ((pixel[0] >> 3) << 11) | ((pixel[1] >> 2) << 5) | (pixel[2] >> 3)
+
+
+def parse_color(text):
+    value = int(text.lstrip("#"), 16)
+    return ((value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF)
+
+
+def opaque_mask(image, key, alpha_threshold):
+    """Tells, for each pixel of the image, whether it is opaque."""
+    return [[(image.pixel(x, y)[3] >= alpha_threshold) and (key is None or image.pixel(x, y)[:3] != key) for x in range(image.width)]
+            for y in range(image.height)]
+
+
+def encode_sprite(image, mask):
+    """Encodes the opaque pixels of an image as runs, where the runs found at the same columns of consecutive rows are
+    merged into a single run of several rows so that the whole of it is drawn with a single Address Window."""
+    runs = []
+    open_runs = {}  # Maps (x, width) to the index in runs of the run that reached the previous row.
+    for y in range(image.height):
+        row_runs = []
+        x = 0
+        while x < image.width:
+            if not mask[y][x]:
+                x += 1
+                continue
+            start = x
+            while x < image.width and mask[y][x]:
+                x += 1
+            row_runs.append((start, x - start))
+        still_open = {}
+        for key in row_runs:
+            if key in open_runs:
+                runs[open_runs[key]][3] += 1
+                still_open[key] = open_runs[key]
+            else:
+                still_open[key] = len(runs)
+                runs.append([key[0], y, key[1], 1])
+        open_runs = still_open
+    pixels = []
+    for x, y, width, height in runs:
+        for row in range(y, y + height):
+            pixels.extend(to_rgb565(image.pixel(column, row)) for column in range(x, x + width))
+    return runs, pixels
+
+
+def encode_rle(image):
+    """Encodes all the pixels of an image, as a single stream that wraps from the end of each row into the start of the
+    next one, into run tokens (a header with the bit 15 set, followed by the repeated pixel) and literal tokens (a
+    header followed by the literal pixels). Only runs of at least 3 pixels are worth a token of their own, since a
+    shorter run costs as much as the literal pixels it would replace and it would also split the literal token."""
+    pixels = [to_rgb565(pixel) for pixel in image.pixels]
+    words = []
+    literal = []
+
+    def flush_literal():
+        for i in range(0, len(literal), RLE_MAX_COUNT):
+            chunk = literal[i:i + RLE_MAX_COUNT]
+            words.append(len(chunk) - 1)
+            words.extend(chunk)
+        del literal[:]
+
+    i = 0
+    while i < len(pixels):
+        j = i + 1
+        while j < len(pixels) and pixels[j] == pixels[i] and j - i < RLE_MAX_COUNT:
+            j += 1
+        if j - i >= 3:
+            flush_literal()
+            words.append(RLE_RUN_FLAG | (j - i - 1))
+            words.append(pixels[i])
+        else:
+            literal.extend(pixels[i:j])
+        i = j
+    flush_literal()
+    return words
+
+
+def encode_qoi(image, bpp):
+    """Encodes all the pixels of an image, quantized into 16 (i.e., 5, 6 and 5 bits channels) or 18 (i.e., 6 bits
+    channels) bits per pixel, with the QOI operations described in "Inc/ili9341_images.h"."""
+    red_blue_bits = 5 if bpp == 16 else 6
+    bits = (red_blue_bits, 6, red_blue_bits)
+
+    def wrap(value, channel):
+        """Maps a channel difference into the signed range of the bits of that channel."""
+        size = 1 << bits[channel]
+        value %= size
+        return value - size if value >= size // 2 else value
+
+    data = bytearray()
+    index = [(0, 0, 0)] * 64
+    previous = (0, 0, 0)
+    run = 0
+    for pixel in image.pixels:
+        pixel = tuple(value >> (8 - bits[channel]) for channel, value in enumerate(pixel[:3]))
+        if pixel == previous:
+            run += 1
+            if run == QOI_MAX_RUN:
+                data.append(QOI_OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run:
+            data.append(QOI_OP_RUN | (run - 1))
+            run = 0
+        position = (pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7) % 64
+        if index[position] == pixel:
+            data.append(QOI_OP_INDEX | position)
+        else:
+            index[position] = pixel
+            dr, dg, db = (wrap(pixel[c] - previous[c], c) for c in range(3))
+            dr_dg, db_dg = wrap(dr - dg, 0), wrap(db - dg, 2)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                data.append(QOI_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                data.append(QOI_OP_LUMA | (dg + 32))
+                data.append(((dr_dg + 8) << 4) | (db_dg + 8))
+            elif bpp == 16:
+                data.append(QOI_OP_PIXEL)
+                data.extend(struct.pack(">H", (pixel[0] << 11) | (pixel[1] << 5) | pixel[2]))
+            else:
+                data.append(QOI_OP_PIXEL)
+                data.extend(value << 2 for value in pixel)
+        previous = pixel
+    if run:
+        data.append(QOI_OP_RUN | (run - 1))
+    return data
+
+
+def format_array(values, per_line, digits):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join("0x%0*X" % (digits, v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines) if lines else "    0"
+
+
+def write_sprite(out, name, image, runs, pixels):
+    out.write("#include \"ili9341_images.h\"\n\n")
+    out.write("static const ILI9341_sprite_run_t %s_runs[%d] =\n{\n" % (name, max(1, len(runs))))
+    out.write("\n".join("    {%d, %d, %d, %d}," % tuple(run) for run in runs) or "    {0, 0, 0, 0}")
+    out.write("\n};\n\n")
+    out.write("static const uint16_t %s_pixels[%d] =\n{\n%s\n};\n\n" % (name, max(1, len(pixels)), format_array(pixels, 12, 4)))
+    out.write("const ILI9341_sprite_t %s =\n{\n    %d, %d, %d, %s_runs, %s_pixels\n};\n"
+              % (name, image.width, image.height, len(runs), name, name))
+    size = len(runs) * 8 + len(pixels) * 2 + 16
+    print("%s: %dx%d sprite, %d opaque pixels in %d runs, %d bytes (%.1f%% of the %d bytes of a plain bitmap)"
+          % (name, image.width, image.height, len(pixels), len(runs), size, 100.0 * size / (image.width * image.height * 2),
+             image.width * image.height * 2), file=sys.stderr)
+
+
+def write_rle(out, name, image, words):
+    out.write("#include \"ili9341_images.h\"\n\n")
+    out.write("static const uint16_t %s_data[%d] =\n{\n%s\n};\n\n" % (name, max(1, len(words)), format_array(words, 12, 4)))
+    out.write("const ILI9341_rle_image_t %s =\n{\n    %d, %d, %d, %s_data\n};\n" % (name, image.width, image.height, len(words), name))
+    size = len(words) * 2 + 12
+    print("%s: %dx%d RLE image, %d words, %d bytes (%.1f%% of the %d bytes of a plain bitmap)"
+          % (name, image.width, image.height, len(words), size, 100.0 * size / (image.width * image.height * 2),
+             image.width * image.height * 2), file=sys.stderr)
+
+
+def write_qoi(out, name, image, bpp, data):
+    out.write("#include \"ili9341_images.h\"\n\n")
+    out.write("static const uint8_t %s_data[%d] =\n{\n%s\n};\n\n" % (name, max(1, len(data)), format_array(data, 16, 2)))
+    out.write("const ILI9341_qoi_image_t %s =\n{\n    %d, %d, ILI9341_BPP_%d, %d, %s_data\n};\n"
+              % (name, image.width, image.height, bpp, len(data), name))
+    raw = image.width * image.height * (2 if bpp == 16 else 3)
+    print("%s: %dx%d QOI image in %d bits per pixel, %d bytes (%.1f%% of the %d bytes of a plain bitmap, %.2fx smaller)"
+          % (name, image.width, image.height, bpp, len(data), 100.0 * len(data) / raw, raw, raw / max(1, len(data))),
+          file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Converts PNG/PPM images into the image formats of the ILI9341 Images module.")
+    parser.add_argument("image", help="PNG or binary PPM image to be converted")
+    parser.add_argument("--format", choices=["sprite", "rle", "qoi"], default="sprite", help="image format to be generated")
+    parser.add_argument("--name", required=True, help="name of the C variable to be generated")
+    parser.add_argument("--bpp", type=int, choices=[16, 18], default=16, help="bits per pixel of QOI images (default: 16)")
+    parser.add_argument("--key", type=parse_color, help="RRGGBB color to be treated as transparent by sprites (e.g., FF00FF)")
+    parser.add_argument("--alpha-threshold", type=int, default=128, help="minimum alpha of an opaque pixel of sprites (default: 128)")
+    parser.add_argument("-o", "--output", help="C source file to be written (default: standard output)")
+    args = parser.parse_args()
+
+    image = read_image(args.image)
+    out = open(args.output, "w") if args.output else sys.stdout
+    try:
+        if args.format == "rle":
+            write_rle(out, args.name, image, encode_rle(image))
+        elif args.format == "qoi":
+            write_qoi(out, args.name, image, args.bpp, encode_qoi(image, args.bpp))
+        else:
+            runs, pixels = encode_sprite(image, opaque_mask(image, args.key, args.alpha_threshold))
+            write_sprite(out, args.name, image, runs, pixels)
+    finally:
+        if args.output:
+            out.close()
+
+
+if __name__ == "__main__":
+    main()